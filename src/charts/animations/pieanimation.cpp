@@ -53,6 +53,8 @@ ChartAnimation *PieAnimation::updateValue(PieSliceItem *sliceItem, const PieSlic
         animation->setDuration(m_animationDuration);
         animation->setEasingCurve(m_animationCurve);
         m_animations.insert(sliceItem, animation);
+        // the labels are culled by their final positions
+        connect(animation, SIGNAL(finished()), m_item, SLOT(scheduleLabelCulling()));
     } else {
         animation->stop();
     }
@@ -68,6 +70,7 @@ ChartAnimation *PieAnimation::addSlice(PieSliceItem *sliceItem, const PieSliceDa
     animation->setDuration(m_animationDuration);
     animation->setEasingCurve(m_animationCurve);
     m_animations.insert(sliceItem, animation);
+    connect(animation, SIGNAL(finished()), m_item, SLOT(scheduleLabelCulling()));
 
     PieSliceData startValue = sliceData;
     startValue.m_radius = 0;
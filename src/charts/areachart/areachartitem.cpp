@@ -34,6 +34,7 @@
 #include <private/chartpresenter_p.h>
 #include <private/abstractdomain_p.h>
 #include <private/chartdataset_p.h>
+#include <private/qxyseries_p.h>
 #include <QtGui/QPainter>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 #include <QtCore/QDebug>
@@ -48,7 +49,7 @@ AreaChartItem::AreaChartItem(QAreaSeries *areaSeries, QGraphicsItem* item)
       m_lower(0),
       m_pointsVisible(false),
       m_pointLabelsVisible(false),
-      m_pointLabelsFormat(areaSeries->pointLabelsFormat()),
+      m_pointLabelsFormat(areaSeries->pointLabelsFormat(), QXYSeriesPrivate::pointLabelTags()),
       m_pointLabelsFont(areaSeries->pointLabelsFont()),
       m_pointLabelsColor(areaSeries->pointLabelsColor()),
       m_pointLabelsClipping(true),
@@ -194,7 +195,10 @@ void AreaChartItem::handleUpdated()
     m_pointPen = m_series->pen();
     m_pointPen.setWidthF(2 * m_pointPen.width());
     setOpacity(m_series->opacity());
-    m_pointLabelsFormat = m_series->pointLabelsFormat();
+    if (m_pointLabelsFormat.format() != m_series->pointLabelsFormat()) {
+        m_pointLabelsFormat = LabelTemplate(m_series->pointLabelsFormat(),
+                                            QXYSeriesPrivate::pointLabelTags());
+    }
     m_pointLabelsVisible = m_series->pointLabelsVisible();
     m_pointLabelsFont = m_series->pointLabelsFont();
     m_pointLabelsColor = m_series->pointLabelsColor();
@@ -233,28 +237,28 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
     Q_UNUSED(option)
 
     painter->save();
-    painter->setPen(m_linePen);
+    painter->setPen(previewPen(m_linePen));
     painter->setBrush(m_brush);
     QRectF clipRect = QRectF(QPointF(0, 0), domain()->size());
     if (presenter()->chartType() == QChart::ChartTypePolar)
         painter->setClipRegion(QRegion(clipRect.toRect(), QRegion::Ellipse));
     else
-        painter->setClipRect(clipRect);
+        painter->setClipRect(mapFromPlotArea(clipRect));
 
     painter->drawPath(m_path);
     if (m_pointsVisible) {
-        painter->setPen(m_pointPen);
+        painter->setPen(previewPen(m_pointPen));
         if (m_upper)
             painter->drawPoints(m_upper->geometryPoints());
         if (m_lower)
             painter->drawPoints(m_lower->geometryPoints());
     }
 
-    // Draw series point label
-    if (m_pointLabelsVisible) {
-        static const QString xPointTag(QLatin1String("@xPoint"));
-        static const QString yPointTag(QLatin1String("@yPoint"));
+    // Draw series point label, except in interactive previews before the geometry is recalculated
+    if (m_pointLabelsVisible && !isPreviewTransformed()) {
         const int labelOffset = 2;
+        const bool hasX = m_pointLabelsFormat.containsTag(0);
+        const bool hasY = m_pointLabelsFormat.containsTag(1);
 
         if (m_pointLabelsClipping)
             painter->setClipping(true);
@@ -269,11 +273,10 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
 
         if (m_series->upperSeries()) {
             for (int i(0); i < m_series->upperSeries()->count(); i++) {
-                pointLabel = m_pointLabelsFormat;
-                pointLabel.replace(xPointTag,
-                                   presenter()->numberToString(m_series->upperSeries()->at(i).x()));
-                pointLabel.replace(yPointTag,
-                                   presenter()->numberToString(m_series->upperSeries()->at(i).y()));
+                const QPointF &point = m_series->upperSeries()->at(i);
+                pointLabel = m_pointLabelsFormat.expand(
+                            hasX ? presenter()->numberToString(point.x()) : QString(),
+                            hasY ? presenter()->numberToString(point.y()) : QString());
 
                 // Position text in relation to the point
                 int pointLabelWidth = fm.width(pointLabel);
@@ -287,11 +290,10 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
 
         if (m_series->lowerSeries()) {
             for (int i(0); i < m_series->lowerSeries()->count(); i++) {
-                pointLabel = m_pointLabelsFormat;
-                pointLabel.replace(xPointTag,
-                                   presenter()->numberToString(m_series->lowerSeries()->at(i).x()));
-                pointLabel.replace(yPointTag,
-                                   presenter()->numberToString(m_series->lowerSeries()->at(i).y()));
+                const QPointF &point = m_series->lowerSeries()->at(i);
+                pointLabel = m_pointLabelsFormat.expand(
+                            hasX ? presenter()->numberToString(point.x()) : QString(),
+                            hasY ? presenter()->numberToString(point.y()) : QString());
 
                 // Position text in relation to the point
                 int pointLabelWidth = fm.width(pointLabel);
@@ -41,6 +41,7 @@
 
 #include <QtCharts/QChartGlobal>
 #include <private/linechartitem_p.h>
+#include <private/labelformatter_p.h>
 #include <QtCharts/QAreaSeries>
 #include <QtGui/QPen>
 
@@ -55,6 +56,9 @@ public:
     AreaChartItem(QAreaSeries *areaSeries, QGraphicsItem* item = 0);
     ~AreaChartItem();
 
+    //from ChartItem
+    bool supportsPreviewTransform() const { return true; }
+
     //from QGraphicsItem
     QRectF boundingRect() const;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
@@ -103,7 +107,7 @@ private:
     bool m_pointsVisible;
 
     bool m_pointLabelsVisible;
-    QString m_pointLabelsFormat;
+    LabelTemplate m_pointLabelsFormat;
     QFont m_pointLabelsFont;
     QColor m_pointLabelsColor;
     bool m_pointLabelsClipping;
@@ -10,6 +10,7 @@ SOURCES += \
     $$PWD/chartaxiselement.cpp \
     $$PWD/cartesianchartaxis.cpp \
     $$PWD/qabstractaxis.cpp \
+    $$PWD/qaxissyncgroup.cpp \
     $$PWD/verticalaxis.cpp \
     $$PWD/horizontalaxis.cpp \
     $$PWD/valueaxis/chartvalueaxisx.cpp \
@@ -29,6 +30,7 @@ PRIVATE_HEADERS += \
     $$PWD/chartaxiselement_p.h \
     $$PWD/cartesianchartaxis_p.h \
     $$PWD/qabstractaxis_p.h \
+    $$PWD/qaxissyncgroup_p.h \
     $$PWD/verticalaxis_p.h \
     $$PWD/horizontalaxis_p.h \
     $$PWD/linearrowitem_p.h \
@@ -47,6 +49,7 @@ PRIVATE_HEADERS += \
 
 PUBLIC_HEADERS += \
     $$PWD/qabstractaxis.h \
+    $$PWD/qaxissyncgroup.h \
     $$PWD/valueaxis/qvalueaxis.h \
     $$PWD/barcategoryaxis/qbarcategoryaxis.h \
     $$PWD/categoryaxis/qcategoryaxis.h \
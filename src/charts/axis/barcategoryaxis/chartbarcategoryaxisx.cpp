@@ -131,8 +131,8 @@ QSizeF ChartBarCategoryAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constra
         case Qt::PreferredSize:{
             qreal labelHeight = 0.0;
             foreach (const QString& s, ticksList) {
-                QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
-                labelHeight = qMax(rect.height(), labelHeight);
+                QSizeF size = labelSize(s);
+                labelHeight = qMax(size.height(), labelHeight);
             }
             height = labelHeight + labelPadding() + base.height() + 1.0;
             sh = QSizeF(width, height);
@@ -131,8 +131,8 @@ QSizeF ChartBarCategoryAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constra
         case Qt::PreferredSize:{
             qreal labelWidth = 0.0;
             foreach (const QString& s, ticksList) {
-                QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
-                labelWidth = qMax(rect.width(), labelWidth);
+                QSizeF size = labelSize(s);
+                labelWidth = qMax(size.width(), labelWidth);
             }
             width = labelWidth + labelPadding() + base.width() + 1.0;
             if (base.width() > 0.0)
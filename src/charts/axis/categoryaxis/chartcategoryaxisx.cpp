@@ -103,8 +103,8 @@ QSizeF ChartCategoryAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constraint
     case Qt::PreferredSize: {
         qreal labelHeight = 0.0;
         foreach (const QString& s, ticksList) {
-            QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
-            labelHeight = qMax(rect.height(), labelHeight);
+            QSizeF size = labelSize(s);
+            labelHeight = qMax(size.height(), labelHeight);
         }
         height = labelHeight + labelPadding() + base.height() + 1.0;
         sh = QSizeF(width, height);
@@ -31,6 +31,8 @@
 #include <private/qabstractaxis_p.h>
 #include <private/chartpresenter_p.h>
 #include <private/abstractchartlayout_p.h>
+#include <private/qvalueaxis_p.h>
+#include <private/qlogvalueaxis_p.h>
 #include <QtCharts/QCategoryAxis>
 #include <QtCore/QtMath>
 #include <QtCore/QDateTime>
@@ -39,20 +41,7 @@
 
 QT_CHARTS_BEGIN_NAMESPACE
 
-static const char *labelFormatMatchString = "%[\\-\\+#\\s\\d\\.\\'lhjztL]*([dicuoxfegXFEG])";
-static const char *labelFormatMatchLocalizedString = "^([^%]*)%\\.(\\d+)([defgiEG])(.*)$";
-static QRegExp *labelFormatMatcher = 0;
-static QRegExp *labelFormatMatcherLocalized = 0;
-class StaticLabelFormatMatcherDeleter
-{
-public:
-    StaticLabelFormatMatcherDeleter() {}
-    ~StaticLabelFormatMatcherDeleter() {
-        delete labelFormatMatcher;
-        delete labelFormatMatcherLocalized;
-    }
-};
-static StaticLabelFormatMatcherDeleter staticLabelFormatMatcherDeleter;
+static const int maxLabelSizeCacheCount = 4096;
 
 ChartAxisElement::ChartAxisElement(QAbstractAxis *axis, QGraphicsItem *item, bool intervalAxis)
     : ChartElement(item),
@@ -179,6 +168,8 @@ void ChartAxisElement::handleLabelsAngleChanged(int angle)
 {
     foreach (QGraphicsItem *item, m_labels->childItems())
         item->setRotation(angle);
+    m_labelSizeCache.clear();
+    resetLayoutLabels();
 
     QGraphicsLayoutItem::updateGeometry();
     presenter()->layout()->invalidate();
@@ -194,6 +185,8 @@ void ChartAxisElement::handleLabelsFontChanged(const QFont &font)
 {
     foreach (QGraphicsItem *item, m_labels->childItems())
         static_cast<QGraphicsTextItem *>(item)->setFont(font);
+    m_labelSizeCache.clear();
+    resetLayoutLabels();
     QGraphicsLayoutItem::updateGeometry();
     presenter()->layout()->invalidate();
 }
@@ -259,6 +252,14 @@ void ChartAxisElement::handleRangeChanged(qreal min, qreal max)
     if (!isEmpty()) {
         QVector<qreal> layout = calculateLayout();
         updateLayout(layout);
+
+        // Labels that are not larger than the ones the current chart layout was computed with
+        // still fit, so repositioning the ticks and labels above is all that is needed.
+        // An animated axis only updates its labels as the animation progresses, so the labels
+        // are not known yet and the size hints have to be compared instead.
+        if (!animation() && labelsFitLayout(m_labelsList))
+            return;
+
         QSizeF before = effectiveSizeHint(Qt::PreferredSize);
         QSizeF after = sizeHint(Qt::PreferredSize);
 
@@ -267,11 +268,74 @@ void ChartAxisElement::handleRangeChanged(qreal min, qreal max)
             // We don't want to call invalidate on layout, since it will change minimum size of
             // component, which we would like to avoid since it causes nasty flips when scrolling
             // or zooming, instead recalculate layout and use plotArea for extra space.
-            presenter()->layout()->setGeometry(presenter()->layout()->geometry());
+            // The pass is deferred so that range changes of several axes share one layout.
+            presenter()->scheduleLayout();
         }
+        if (animation())
+            resetLayoutLabels();
+        else
+            setLayoutLabels(m_labelsList, after);
+    }
+}
+
+QSizeF ChartAxisElement::labelSize(const QString &text) const
+{
+    QHash<QString, QSizeF>::const_iterator it = m_labelSizeCache.constFind(text);
+    if (it != m_labelSizeCache.constEnd())
+        return it.value();
+
+    if (m_labelSizeCache.size() >= maxLabelSizeCacheCount)
+        m_labelSizeCache.clear();
+    QSizeF size = ChartPresenter::textBoundingRect(axis()->labelsFont(), text,
+                                                   axis()->labelsAngle()).size();
+    m_labelSizeCache.insert(text, size);
+    return size;
+}
+
+// maxSize is the largest label width and height, edgeSize the larger of the first and
+// the last label, which determine how far labels can extend past the end ticks.
+void ChartAxisElement::labelsExtent(const QStringList &labels, QSizeF &maxSize,
+                                    QSizeF &edgeSize) const
+{
+    maxSize = QSizeF(0.0, 0.0);
+    edgeSize = QSizeF(0.0, 0.0);
+    for (int i = 0; i < labels.size(); i++) {
+        const QSizeF size = labelSize(labels.at(i));
+        maxSize = maxSize.expandedTo(size);
+        if (i == 0 || i == labels.size() - 1)
+            edgeSize = edgeSize.expandedTo(size);
     }
 }
 
+bool ChartAxisElement::labelsFitLayout(const QStringList &labels) const
+{
+    // The size hint may have been recalculated for some other reason since the labels were
+    // last checked, in which case the stored extents no longer describe the layout.
+    if (!m_layoutSizeHint.isValid() || effectiveSizeHint(Qt::PreferredSize) != m_layoutSizeHint)
+        return false;
+
+    QSizeF maxSize;
+    QSizeF edgeSize;
+    labelsExtent(labels, maxSize, edgeSize);
+    return maxSize.width() <= m_layoutLabelsSize.width()
+            && maxSize.height() <= m_layoutLabelsSize.height()
+            && edgeSize.width() <= m_layoutEdgeLabelsSize.width()
+            && edgeSize.height() <= m_layoutEdgeLabelsSize.height();
+}
+
+void ChartAxisElement::setLayoutLabels(const QStringList &labels, const QSizeF &sizeHint)
+{
+    labelsExtent(labels, m_layoutLabelsSize, m_layoutEdgeLabelsSize);
+    m_layoutSizeHint = sizeHint;
+}
+
+void ChartAxisElement::resetLayoutLabels()
+{
+    m_layoutLabelsSize = QSizeF();
+    m_layoutEdgeLabelsSize = QSizeF();
+    m_layoutSizeHint = QSizeF();
+}
+
 void ChartAxisElement::handleReverseChanged(bool reverse)
 {
     Q_UNUSED(reverse);
@@ -297,84 +361,39 @@ qreal ChartAxisElement::max() const
     return m_axis->d_ptr->max();
 }
 
-QString ChartAxisElement::formatLabel(const QString &formatSpec, const QByteArray &array,
-                                      qreal value, int precision, const QString &preStr,
-                                      const QString &postStr) const
-{
-    QString retVal;
-    if (!formatSpec.isEmpty()) {
-        if (formatSpec.at(0) == QLatin1Char('d')
-            || formatSpec.at(0) == QLatin1Char('i')
-            || formatSpec.at(0) == QLatin1Char('c')) {
-            if (presenter()->localizeNumbers())
-                retVal = preStr + presenter()->locale().toString(qint64(value)) + postStr;
-            else
-                retVal = QString().sprintf(array, qint64(value));
-        } else if (formatSpec.at(0) == QLatin1Char('u')
-                 || formatSpec.at(0) == QLatin1Char('o')
-                 || formatSpec.at(0) == QLatin1Char('x')
-                 || formatSpec.at(0) == QLatin1Char('X')) {
-            // These formats are not supported by localized numbers
-            retVal = QString().sprintf(array, quint64(value));
-        } else if (formatSpec.at(0) == QLatin1Char('f')
-                   || formatSpec.at(0) == QLatin1Char('F')
-                   || formatSpec.at(0) == QLatin1Char('e')
-                   || formatSpec.at(0) == QLatin1Char('E')
-                   || formatSpec.at(0) == QLatin1Char('g')
-                   || formatSpec.at(0) == QLatin1Char('G')) {
-            if (presenter()->localizeNumbers()) {
-                retVal = preStr
-                        + presenter()->locale().toString(value, formatSpec.at(0).toLatin1(),
-                                                         precision)
-                        + postStr;
-            } else {
-                retVal = QString().sprintf(array, value);
-            }
-        }
+const LabelFormatter &ChartAxisElement::labelFormatter() const
+{
+    static const LabelFormatter nullFormatter;
+    switch (m_axis->type()) {
+    case QAbstractAxis::AxisTypeValue:
+        return static_cast<QValueAxisPrivate *>(m_axis->d_ptr.data())->labelFormatter();
+    case QAbstractAxis::AxisTypeLogValue:
+        return static_cast<QLogValueAxisPrivate *>(m_axis->d_ptr.data())->labelFormatter();
+    default:
+        return nullFormatter;
     }
-    return retVal;
 }
 
 QStringList ChartAxisElement::createValueLabels(qreal min, qreal max, int ticks,
-                                                const QString &format) const
+                                                const LabelFormatter &formatter) const
 {
     QStringList labels;
 
     if (max <= min || ticks < 1)
         return labels;
 
-    if (format.isNull()) {
+    if (formatter.isNull()) {
         int n = qMax(int(-qFloor(std::log10((max - min) / (ticks - 1)))), 0) + 1;
         for (int i = 0; i < ticks; i++) {
             qreal value = min + (i * (max - min) / (ticks - 1));
             labels << presenter()->numberToString(value, 'f', n);
         }
     } else {
-        QByteArray array = format.toLatin1();
-        QString formatSpec;
-        QString preStr;
-        QString postStr;
-        int precision = 6; // Six is the default precision in Qt API
-        if (presenter()->localizeNumbers()) {
-            if (!labelFormatMatcherLocalized)
-                labelFormatMatcherLocalized
-                        = new QRegExp(QString::fromLatin1(labelFormatMatchLocalizedString));
-            if (labelFormatMatcherLocalized->indexIn(format, 0) != -1) {
-                preStr = labelFormatMatcherLocalized->cap(1);
-                if (!labelFormatMatcherLocalized->cap(2).isEmpty())
-                    precision = labelFormatMatcherLocalized->cap(2).toInt();
-                formatSpec = labelFormatMatcherLocalized->cap(3);
-                postStr = labelFormatMatcherLocalized->cap(4);
-            }
-        } else {
-            if (!labelFormatMatcher)
-                labelFormatMatcher = new QRegExp(QString::fromLatin1(labelFormatMatchString));
-            if (labelFormatMatcher->indexIn(format, 0) != -1)
-                formatSpec = labelFormatMatcher->cap(1);
-        }
+        const bool localize = presenter()->localizeNumbers();
+        const QLocale &locale = presenter()->locale();
         for (int i = 0; i < ticks; i++) {
             qreal value = min + (i * (max - min) / (ticks - 1));
-            labels << formatLabel(formatSpec, array, value, precision, preStr, postStr);
+            labels << formatter.toString(value, localize, locale);
         }
     }
 
@@ -382,7 +401,7 @@ QStringList ChartAxisElement::createValueLabels(qreal min, qreal max, int ticks,
 }
 
 QStringList ChartAxisElement::createLogValueLabels(qreal min, qreal max, qreal base, int ticks,
-                                                   const QString &format) const
+                                                   const LabelFormatter &formatter) const
 {
     QStringList labels;
 
@@ -395,7 +414,7 @@ QStringList ChartAxisElement::createLogValueLabels(qreal min, qreal max, qreal b
     else
         firstTick = qCeil(std::log10(max) / std::log10(base));
 
-    if (format.isNull()) {
+    if (formatter.isNull()) {
         int n = 0;
         if (ticks > 1)
             n = qMax(int(-qFloor(std::log10((max - min) / (ticks - 1)))), 0);
@@ -405,31 +424,11 @@ QStringList ChartAxisElement::createLogValueLabels(qreal min, qreal max, qreal b
             labels << presenter()->numberToString(value, 'f', n);
         }
     } else {
-        QByteArray array = format.toLatin1();
-        QString formatSpec;
-        QString preStr;
-        QString postStr;
-        int precision = 6; // Six is the default precision in Qt API
-        if (presenter()->localizeNumbers()) {
-            if (!labelFormatMatcherLocalized)
-                labelFormatMatcherLocalized =
-                        new QRegExp(QString::fromLatin1(labelFormatMatchLocalizedString));
-            if (labelFormatMatcherLocalized->indexIn(format, 0) != -1) {
-                preStr = labelFormatMatcherLocalized->cap(1);
-                if (!labelFormatMatcherLocalized->cap(2).isEmpty())
-                    precision = labelFormatMatcherLocalized->cap(2).toInt();
-                formatSpec = labelFormatMatcherLocalized->cap(3);
-                postStr = labelFormatMatcherLocalized->cap(4);
-            }
-        } else {
-            if (!labelFormatMatcher)
-                labelFormatMatcher = new QRegExp(QString::fromLatin1(labelFormatMatchString));
-            if (labelFormatMatcher->indexIn(format, 0) != -1)
-                formatSpec = labelFormatMatcher->cap(1);
-        }
+        const bool localize = presenter()->localizeNumbers();
+        const QLocale &locale = presenter()->locale();
         for (int i = firstTick; i < ticks + firstTick; i++) {
             qreal value = qPow(base, i);
-            labels << formatLabel(formatSpec, array, value, precision, preStr, postStr);
+            labels << formatter.toString(value, localize, locale);
         }
     }
 
@@ -42,9 +42,11 @@
 #include <QtCharts/QChartGlobal>
 #include <private/chartelement_p.h>
 #include <private/axisanimation_p.h>
+#include <private/labelformatter_p.h>
 #include <QtWidgets/QGraphicsItem>
 #include <QtWidgets/QGraphicsLayoutItem>
 #include <QtGui/QFont>
+#include <QtCore/QHash>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -86,11 +88,14 @@ public:
     //this flag indicates that axis is used to show intervals it means labels are in between ticks
     bool intervalAxis() const { return m_intervalAxis; }
 
-    QStringList createValueLabels(qreal max, qreal min, int ticks, const QString &format) const;
+    QStringList createValueLabels(qreal max, qreal min, int ticks,
+                                  const LabelFormatter &formatter) const;
     QStringList createLogValueLabels(qreal min, qreal max, qreal base, int ticks,
-                                     const QString &format) const;
+                                     const LabelFormatter &formatter) const;
     QStringList createDateTimeLabels(qreal max, qreal min, int ticks, const QString &format) const;
 
+    QSizeF labelSize(const QString &text) const;
+
     // from QGraphicsLayoutItem
     QRectF boundingRect() const
     {
@@ -112,6 +117,7 @@ protected:
     QList<QGraphicsItem *> shadeItems() { return m_shades->childItems(); }
     QList<QGraphicsItem *> arrowItems() { return m_arrow->childItems(); }
     QList<QGraphicsItem *> minorArrowItems() { return m_minorArrow->childItems(); }
+    const LabelFormatter &labelFormatter() const;
     QGraphicsTextItem *titleItem() const { return m_title.data(); }
     QGraphicsItemGroup *gridGroup() { return m_grid.data(); }
     QGraphicsItemGroup *minorGridGroup() { return m_minorGrid.data(); }
@@ -152,9 +158,10 @@ Q_SIGNALS:
 
 private:
     void connectSlots();
-    QString formatLabel(const QString &formatSpec, const QByteArray &array,
-                        qreal value, int precision, const QString &preStr,
-                        const QString &postStr) const;
+    void labelsExtent(const QStringList &labels, QSizeF &maxSize, QSizeF &edgeSize) const;
+    bool labelsFitLayout(const QStringList &labels) const;
+    void setLayoutLabels(const QStringList &labels, const QSizeF &sizeHint);
+    void resetLayoutLabels();
 
     QAbstractAxis *m_axis;
     AxisAnimation *m_animation;
@@ -169,6 +176,11 @@ private:
     QScopedPointer<QGraphicsItemGroup> m_labels;
     QScopedPointer<QGraphicsTextItem> m_title;
     bool m_intervalAxis;
+    mutable QHash<QString, QSizeF> m_labelSizeCache;
+    // Label extents the chart layout was last computed with, see handleRangeChanged()
+    QSizeF m_layoutLabelsSize;
+    QSizeF m_layoutEdgeLabelsSize;
+    QSizeF m_layoutSizeHint;
 };
 
 QT_CHARTS_END_NAMESPACE
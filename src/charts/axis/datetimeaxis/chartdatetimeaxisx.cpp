@@ -119,9 +119,9 @@ QSizeF ChartDateTimeAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constraint
         qreal labelHeight = 0.0;
         qreal firstWidth = -1.0;
         foreach (const QString& s, ticksList) {
-            QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
-            labelHeight = qMax(rect.height(), labelHeight);
-            width = rect.width();
+            QSizeF size = labelSize(s);
+            labelHeight = qMax(size.height(), labelHeight);
+            width = size.width();
             if (firstWidth < 0.0)
                 firstWidth = width;
         }
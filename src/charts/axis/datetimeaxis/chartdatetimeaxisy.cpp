@@ -120,9 +120,9 @@ QSizeF ChartDateTimeAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constraint
             qreal labelWidth = 0.0;
             qreal firstHeight = -1.0;
             foreach (const QString& s, ticksList) {
-                QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
-                labelWidth = qMax(rect.width(), labelWidth);
-                height = rect.height();
+                QSizeF size = labelSize(s);
+                labelWidth = qMax(size.width(), labelWidth);
+                height = size.height();
                 if (firstHeight < 0.0)
                     firstHeight = height;
             }
@@ -69,7 +69,7 @@ QVector<qreal> ChartLogValueAxisX::calculateLayout() const
 void ChartLogValueAxisX::updateGeometry()
 {
     const QVector<qreal>& layout = ChartAxisElement::layout();
-    setLabels(createLogValueLabels(m_axis->min(), m_axis->max(), m_axis->base(), layout.size(), m_axis->labelFormat()));
+    setLabels(createLogValueLabels(m_axis->min(), m_axis->max(), m_axis->base(), layout.size(), labelFormatter()));
     HorizontalAxis::updateGeometry();
 }
 
@@ -105,7 +105,7 @@ QSizeF ChartLogValueAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constraint
         tickCount++;
 
     if (m_axis->max() > m_axis->min() && tickCount > 0)
-        ticksList = createLogValueLabels(m_axis->min(), m_axis->max(), m_axis->base(), tickCount, m_axis->labelFormat());
+        ticksList = createLogValueLabels(m_axis->min(), m_axis->max(), m_axis->base(), tickCount, labelFormatter());
     else
         ticksList.append(QStringLiteral(" "));
     // Width of horizontal axis sizeHint indicates the maximum distance labels can extend past
@@ -127,9 +127,9 @@ QSizeF ChartLogValueAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constraint
         qreal labelHeight = 0.0;
         qreal firstWidth = -1.0;
         foreach (const QString& s, ticksList) {
-            QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
-            labelHeight = qMax(rect.height(), labelHeight);
-            width = rect.width();
+            QSizeF size = labelSize(s);
+            labelHeight = qMax(size.height(), labelHeight);
+            width = size.width();
             if (firstWidth < 0.0)
                 firstWidth = width;
         }
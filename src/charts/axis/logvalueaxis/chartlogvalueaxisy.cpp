@@ -70,7 +70,7 @@ QVector<qreal> ChartLogValueAxisY::calculateLayout() const
 void ChartLogValueAxisY::updateGeometry()
 {
     const QVector<qreal> &layout = ChartAxisElement::layout();
-    setLabels(createLogValueLabels(m_axis->min(), m_axis->max(), m_axis->base(), layout.size(), m_axis->labelFormat()));
+    setLabels(createLogValueLabels(m_axis->min(), m_axis->max(), m_axis->base(), layout.size(), labelFormatter()));
     VerticalAxis::updateGeometry();
 }
 
@@ -106,7 +106,7 @@ QSizeF ChartLogValueAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constraint
         tickCount++;
 
     if (m_axis->max() > m_axis->min() && tickCount > 0)
-        ticksList = createLogValueLabels(m_axis->min(), m_axis->max(), m_axis->base(), tickCount, m_axis->labelFormat());
+        ticksList = createLogValueLabels(m_axis->min(), m_axis->max(), m_axis->base(), tickCount, labelFormatter());
     else
         ticksList.append(QStringLiteral(" "));
     qreal width = 0;
@@ -128,9 +128,9 @@ QSizeF ChartLogValueAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constraint
         qreal labelWidth = 0.0;
         qreal firstHeight = -1.0;
         foreach (const QString& s, ticksList) {
-            QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
-            labelWidth = qMax(rect.width(), labelWidth);
-            height = rect.height();
+            QSizeF size = labelSize(s);
+            labelWidth = qMax(size.width(), labelWidth);
+            height = size.height();
             if (firstHeight < 0.0)
                 firstHeight = height;
         }
@@ -74,7 +74,7 @@ void PolarChartLogValueAxisAngular::createAxisLabels(const QVector<qreal> &layou
                                    logValueAxis->max(),
                                    logValueAxis->base(),
                                    layout.size(),
-                                   logValueAxis->labelFormat()));
+                                   labelFormatter()));
 }
 
 void PolarChartLogValueAxisAngular::handleBaseChanged(qreal base)
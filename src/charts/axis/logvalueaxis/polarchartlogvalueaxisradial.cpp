@@ -73,7 +73,7 @@ void PolarChartLogValueAxisRadial::createAxisLabels(const QVector<qreal> &layout
                                    logValueAxis->max(),
                                    logValueAxis->base(),
                                    layout.size(),
-                                   logValueAxis->labelFormat()));
+                                   labelFormatter()));
 }
 
 void PolarChartLogValueAxisRadial::handleBaseChanged(qreal base)
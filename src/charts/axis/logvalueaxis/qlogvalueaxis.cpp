@@ -304,17 +304,17 @@ void QLogValueAxis::setLabelFormat(const QString &format)
 {
     Q_D(QLogValueAxis);
 
-    if (d->m_labelFormat == format)
+    if (d->m_labelFormatter.format() == format)
         return;
 
-    d->m_labelFormat = format;
-    emit labelFormatChanged(d->m_labelFormat);
+    d->m_labelFormatter.setFormat(format);
+    emit labelFormatChanged(format);
 }
 
 QString QLogValueAxis::labelFormat() const
 {
     Q_D(const QLogValueAxis);
-    return d->m_labelFormat;
+    return d->m_labelFormatter.format();
 }
 
 void QLogValueAxis::setBase(qreal base)
@@ -379,8 +379,7 @@ QLogValueAxisPrivate::QLogValueAxisPrivate(QLogValueAxis *q)
       m_max(1),
       m_base(10),
       m_tickCount(0),
-      m_minorTickCount(0),
-      m_labelFormat(QString::null)
+      m_minorTickCount(0)
 {
 }
 
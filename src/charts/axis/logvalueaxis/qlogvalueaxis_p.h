@@ -41,6 +41,7 @@
 
 #include <QtCharts/qlogvalueaxis.h>
 #include <private/qabstractaxis_p.h>
+#include <private/labelformatter_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -61,6 +62,8 @@ class QLogValueAxisPrivate : public QAbstractAxisPrivate
 
     void updateTickCount();
 
+    const LabelFormatter &labelFormatter() const { return m_labelFormatter; }
+
     protected:
     void setMin(const QVariant &min);
     void setMax(const QVariant &max);
@@ -72,7 +75,7 @@ class QLogValueAxisPrivate : public QAbstractAxisPrivate
     qreal m_base;
     int m_tickCount;
     int m_minorTickCount;
-    QString m_labelFormat;
+    LabelFormatter m_labelFormatter;
     Q_DECLARE_PUBLIC(QLogValueAxis)
 };
 
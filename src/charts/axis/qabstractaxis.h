@@ -208,6 +208,9 @@ protected:
     friend class AbstractDomain;
     friend class ChartAxisElement;
     friend class XYChart;
+    friend class QXYSeriesPrivate;
+    friend class QAxisSyncGroup;
+    friend class QAxisSyncGroupPrivate;
 
 private:
     Q_DISABLE_COPY(QAbstractAxis)
@@ -0,0 +1,180 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCharts/QAxisSyncGroup>
+#include <private/qaxissyncgroup_p.h>
+#include <QtCharts/QAbstractAxis>
+#include <private/qabstractaxis_p.h>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QAxisSyncGroup
+    \inmodule Qt Charts
+    \brief The QAxisSyncGroup class keeps the ranges of several axes in sync.
+
+    Axes added to a group, typically in different charts, share one range. When the range of
+    any member axis changes, for example because the user zooms or scrolls its chart, the
+    group applies the new range to all other members.
+
+    Range changes are coalesced: however many times the ranges change within one event loop
+    iteration, the members are updated once, in a single pass, with the last range set. This
+    keeps linked charts from triggering chained domain updates and layouts in each other while
+    panning.
+
+    The group does not convert between axis types, so all members should be of the same type.
+*/
+
+/*!
+    \fn void QAxisSyncGroup::rangeSynchronized(qreal min, qreal max)
+    This signal is emitted after the range from \a min to \a max has been applied to all
+    member axes.
+*/
+
+/*!
+    Constructs an empty axis sync group that is a child of \a parent.
+*/
+QAxisSyncGroup::QAxisSyncGroup(QObject *parent)
+    : QObject(parent),
+      d_ptr(new QAxisSyncGroupPrivate(this))
+{
+}
+
+/*!
+    Destroys the group. The member axes are not affected.
+*/
+QAxisSyncGroup::~QAxisSyncGroup()
+{
+}
+
+/*!
+    Adds \a axis to the group. If the group already has members, the axis takes over their
+    range. An axis deleted while in the group is removed from it automatically.
+*/
+void QAxisSyncGroup::addAxis(QAbstractAxis *axis)
+{
+    Q_D(QAxisSyncGroup);
+    if (!axis || d->m_axes.contains(axis))
+        return;
+
+    if (!d->m_axes.isEmpty()) {
+        if (!d->m_syncScheduled) {
+            d->m_min = d->m_axes.first()->d_ptr->min();
+            d->m_max = d->m_axes.first()->d_ptr->max();
+        }
+        d->m_syncing = true;
+        axis->d_ptr->setRange(d->m_min, d->m_max);
+        d->m_syncing = false;
+    }
+
+    d->m_axes.append(axis);
+    connect(axis->d_ptr.data(), SIGNAL(rangeChanged(qreal,qreal)),
+            d, SLOT(handleRangeChanged(qreal,qreal)));
+    connect(axis, SIGNAL(destroyed(QObject*)), d, SLOT(handleAxisDestroyed(QObject*)));
+}
+
+/*!
+    Removes \a axis from the group. The axis keeps its current range.
+*/
+void QAxisSyncGroup::removeAxis(QAbstractAxis *axis)
+{
+    Q_D(QAxisSyncGroup);
+    if (!d->m_axes.removeOne(axis))
+        return;
+
+    disconnect(axis->d_ptr.data(), SIGNAL(rangeChanged(qreal,qreal)),
+               d, SLOT(handleRangeChanged(qreal,qreal)));
+    disconnect(axis, SIGNAL(destroyed(QObject*)), d, SLOT(handleAxisDestroyed(QObject*)));
+}
+
+/*!
+    Returns the axes in the group.
+*/
+QList<QAbstractAxis *> QAxisSyncGroup::axes() const
+{
+    Q_D(const QAxisSyncGroup);
+    return d->m_axes;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+QAxisSyncGroupPrivate::QAxisSyncGroupPrivate(QAxisSyncGroup *q)
+    : q_ptr(q),
+      m_min(0),
+      m_max(0),
+      m_syncScheduled(false),
+      m_syncing(false)
+{
+}
+
+QAxisSyncGroupPrivate::~QAxisSyncGroupPrivate()
+{
+}
+
+/*
+ * Records the latest range of a member axis and queues a single pass applying it to all members.
+ * Range changes caused by the pass itself are ignored, so members cannot feed back into each other.
+ */
+void QAxisSyncGroupPrivate::handleRangeChanged(qreal min, qreal max)
+{
+    if (m_syncing)
+        return;
+
+    m_min = min;
+    m_max = max;
+    if (!m_syncScheduled) {
+        m_syncScheduled = true;
+        QMetaObject::invokeMethod(this, "handleScheduledSync", Qt::QueuedConnection);
+    }
+}
+
+void QAxisSyncGroupPrivate::handleAxisDestroyed(QObject *object)
+{
+    m_axes.removeOne(static_cast<QAbstractAxis *>(object));
+}
+
+void QAxisSyncGroupPrivate::handleScheduledSync()
+{
+    Q_Q(QAxisSyncGroup);
+    if (!m_syncScheduled)
+        return;
+
+    m_syncScheduled = false;
+    m_syncing = true;
+    foreach (QAbstractAxis *axis, m_axes)
+        axis->d_ptr->setRange(m_min, m_max);
+    m_syncing = false;
+
+    emit q->rangeSynchronized(m_min, m_max);
+}
+
+#include "moc_qaxissyncgroup.cpp"
+#include "moc_qaxissyncgroup_p.cpp"
+
+QT_CHARTS_END_NAMESPACE
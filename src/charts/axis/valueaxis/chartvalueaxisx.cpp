@@ -74,7 +74,7 @@ void ChartValueAxisX::updateGeometry()
     const QVector<qreal>& layout = ChartAxisElement::layout();
     if (layout.isEmpty())
         return;
-    setLabels(createValueLabels(min(), max(), layout.size(), m_axis->labelFormat()));
+    setLabels(createValueLabels(min(), max(), layout.size(), labelFormatter()));
     HorizontalAxis::updateGeometry();
 }
 
@@ -107,7 +107,7 @@ QSizeF ChartValueAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constraint) c
     QSizeF sh;
 
     QSizeF base = HorizontalAxis::sizeHint(which, constraint);
-    QStringList ticksList = createValueLabels(min(),max(),m_axis->tickCount(),m_axis->labelFormat());
+    QStringList ticksList = createValueLabels(min(),max(),m_axis->tickCount(),labelFormatter());
     // Width of horizontal axis sizeHint indicates the maximum distance labels can extend past
     // first and last ticks. Base width is irrelevant.
     qreal width = 0;
@@ -127,9 +127,9 @@ QSizeF ChartValueAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constraint) c
             qreal labelHeight = 0.0;
             qreal firstWidth = -1.0;
             foreach (const QString& s, ticksList) {
-                QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
-                labelHeight = qMax(rect.height(), labelHeight);
-                width = rect.width();
+                QSizeF size = labelSize(s);
+                labelHeight = qMax(size.height(), labelHeight);
+                width = size.width();
                 if (firstWidth < 0.0)
                     firstWidth = width;
             }
@@ -75,7 +75,7 @@ void ChartValueAxisY::updateGeometry()
     const QVector<qreal> &layout = ChartAxisElement::layout();
     if (layout.isEmpty())
         return;
-    setLabels(createValueLabels(min(),max(),layout.size(),m_axis->labelFormat()));
+    setLabels(createValueLabels(min(),max(),layout.size(),labelFormatter()));
     VerticalAxis::updateGeometry();
 }
 
@@ -107,7 +107,7 @@ QSizeF ChartValueAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constraint) c
 
     QSizeF sh;
     QSizeF base = VerticalAxis::sizeHint(which, constraint);
-    QStringList ticksList = createValueLabels(min(),max(),m_axis->tickCount(),m_axis->labelFormat());
+    QStringList ticksList = createValueLabels(min(),max(),m_axis->tickCount(),labelFormatter());
     qreal width = 0;
     // Height of vertical axis sizeHint indicates the maximum distance labels can extend past
     // first and last ticks. Base height is irrelevant.
@@ -127,9 +127,9 @@ QSizeF ChartValueAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constraint) c
         qreal labelWidth = 0.0;
         qreal firstHeight = -1.0;
         foreach (const QString& s, ticksList) {
-            QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
-            labelWidth = qMax(rect.width(), labelWidth);
-            height = rect.height();
+            QSizeF size = labelSize(s);
+            labelWidth = qMax(size.width(), labelWidth);
+            height = size.height();
             if (firstHeight < 0.0)
                 firstHeight = height;
         }
@@ -66,7 +66,7 @@ QVector<qreal> PolarChartValueAxisRadial::calculateLayout() const
 
 void PolarChartValueAxisRadial::createAxisLabels(const QVector<qreal> &layout)
 {
-    setLabels(createValueLabels(min(), max(), layout.size(), static_cast<QValueAxis *>(axis())->labelFormat()));
+    setLabels(createValueLabels(min(), max(), layout.size(), labelFormatter()));
 }
 
 void PolarChartValueAxisRadial::handleTickCountChanged(int tick)
@@ -38,6 +38,7 @@
 #include <private/chartpresenter_p.h>
 #include <private/charttheme_p.h>
 #include <private/charthelpers_p.h>
+#include <private/qxyseries_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 /*!
@@ -164,6 +165,53 @@ QT_CHARTS_BEGIN_NAMESPACE
   \sa QString::asprintf()
 */
 
+/*!
+  \property QValueAxis::autoRange
+  \brief Whether the axis range follows the data of the attached line, spline, and scatter
+  series.
+
+  When automatic range is enabled, the range is expanded whenever data points are added
+  outside of it, leaving autoRangeHeadroom of extra space on the side that was exceeded.
+  The range is shrunk only when the data covers clearly less of the range than it used to,
+  as controlled by autoRangeHysteresis. Setting the range explicitly while automatic range is
+  enabled is allowed, but the range is adjusted again when the data next leaves it.
+  The default value is \c false.
+
+  \sa autoRangeHeadroom, autoRangeHysteresis
+*/
+/*!
+  \qmlproperty bool ValueAxis::autoRange
+  Whether the axis range follows the data of the attached line, spline, and scatter series.
+  The default value is \c false.
+*/
+
+/*!
+  \property QValueAxis::autoRangeHeadroom
+  \brief The extra space added beyond the data when the automatic range is expanded, as a
+  fraction of the data span. The default value is 0.1.
+
+  \sa autoRange
+*/
+/*!
+  \qmlproperty real ValueAxis::autoRangeHeadroom
+  The extra space added beyond the data when the automatic range is expanded, as a fraction of
+  the data span. The default value is 0.1.
+*/
+
+/*!
+  \property QValueAxis::autoRangeHysteresis
+  \brief How much of the automatic range may be left unused before the range is shrunk to fit
+  the data again, as a fraction of the range. The value is between 0 and 1, where 1 means
+  that the range is never shrunk. The default value is 0.5.
+
+  \sa autoRange
+*/
+/*!
+  \qmlproperty real ValueAxis::autoRangeHysteresis
+  How much of the automatic range may be left unused before the range is shrunk to fit the
+  data again, as a fraction of the range. The default value is 0.5.
+*/
+
 /*!
   \fn void QValueAxis::minChanged(qreal min)
   This signal is emitted when the minimum value of the axis, specified by \a min, changes.
@@ -204,6 +252,22 @@ QT_CHARTS_BEGIN_NAMESPACE
   This signal is emitted when the \a format of axis labels changes.
 */
 
+/*!
+  \fn void QValueAxis::autoRangeChanged(bool autoRange)
+  This signal is emitted when automatic range handling is enabled or disabled, as specified by
+  \a autoRange.
+*/
+
+/*!
+  \fn void QValueAxis::autoRangeHeadroomChanged(qreal headroom)
+  This signal is emitted when the automatic range \a headroom changes.
+*/
+
+/*!
+  \fn void QValueAxis::autoRangeHysteresisChanged(qreal hysteresis)
+  This signal is emitted when the automatic range \a hysteresis changes.
+*/
+
 /*!
     Constructs an axis object that is a child of \a parent.
 */
@@ -299,14 +363,64 @@ int QValueAxis::minorTickCount() const
 void QValueAxis::setLabelFormat(const QString &format)
 {
     Q_D(QValueAxis);
-    d->m_format = format;
+    d->m_labelFormatter.setFormat(format);
     emit labelFormatChanged(format);
 }
 
 QString QValueAxis::labelFormat() const
 {
     Q_D(const QValueAxis);
-    return d->m_format;
+    return d->m_labelFormatter.format();
+}
+
+void QValueAxis::setAutoRange(bool autoRange)
+{
+    Q_D(QValueAxis);
+    if (d->m_autoRange != autoRange) {
+        d->m_autoRange = autoRange;
+        emit autoRangeChanged(autoRange);
+        d->updateAutoRange(true);
+    }
+}
+
+bool QValueAxis::isAutoRange() const
+{
+    Q_D(const QValueAxis);
+    return d->m_autoRange;
+}
+
+void QValueAxis::setAutoRangeHeadroom(qreal headroom)
+{
+    Q_D(QValueAxis);
+    headroom = qMax(qreal(0.0), headroom);
+    if (d->m_autoRangeHeadroom != headroom) {
+        d->m_autoRangeHeadroom = headroom;
+        emit autoRangeHeadroomChanged(headroom);
+        d->updateAutoRange(true);
+    }
+}
+
+qreal QValueAxis::autoRangeHeadroom() const
+{
+    Q_D(const QValueAxis);
+    return d->m_autoRangeHeadroom;
+}
+
+void QValueAxis::setAutoRangeHysteresis(qreal hysteresis)
+{
+    Q_D(QValueAxis);
+    hysteresis = qBound(qreal(0.0), hysteresis, qreal(1.0));
+    if (d->m_autoRangeHysteresis != hysteresis) {
+        d->m_autoRangeHysteresis = hysteresis;
+        emit autoRangeHysteresisChanged(hysteresis);
+        d->updateAutoRange();
+    }
+}
+
+qreal QValueAxis::autoRangeHysteresis() const
+{
+    Q_D(const QValueAxis);
+    return d->m_autoRangeHysteresis;
 }
 
 /*!
@@ -354,8 +468,11 @@ QValueAxisPrivate::QValueAxisPrivate(QValueAxis *q)
       m_max(0),
       m_tickCount(5),
       m_minorTickCount(0),
-      m_format(QString::null),
-      m_applying(false)
+      m_applying(false),
+      m_autoRange(false),
+      m_autoRangeBlocked(false),
+      m_autoRangeHeadroom(0.1),
+      m_autoRangeHysteresis(0.5)
 {
 
 }
@@ -438,6 +555,70 @@ void QValueAxisPrivate::setRange(qreal min, qreal max)
     }
 }
 
+/*
+ * Adjusts the range to the bounds of the attached xy series. The range only changes when data
+ * has left it, or when the data covers less of the range than the hysteresis allows. If fit is
+ * true, the range is always set to the data bounds plus headroom.
+ */
+void QValueAxisPrivate::updateAutoRange(bool fit)
+{
+    if (!m_autoRange || m_autoRangeBlocked)
+        return;
+
+    bool found = false;
+    qreal dataMin = 0;
+    qreal dataMax = 0;
+    foreach (QAbstractSeries *series, m_series) {
+        if (series->type() != QAbstractSeries::SeriesTypeLine
+            && series->type() != QAbstractSeries::SeriesTypeSpline
+            && series->type() != QAbstractSeries::SeriesTypeScatter) {
+            continue;
+        }
+        const QXYSeriesPrivate *d = static_cast<const QXYSeriesPrivate *>(series->d_ptr.data());
+        qreal minX;
+        qreal maxX;
+        qreal minY;
+        qreal maxY;
+        if (!d->bounds(minX, maxX, minY, maxY))
+            continue;
+        const qreal seriesMin = orientation() == Qt::Vertical ? minY : minX;
+        const qreal seriesMax = orientation() == Qt::Vertical ? maxY : maxX;
+        dataMin = found ? qMin(dataMin, seriesMin) : seriesMin;
+        dataMax = found ? qMax(dataMax, seriesMax) : seriesMax;
+        found = true;
+    }
+
+    if (!found)
+        return;
+
+    qreal span = dataMax - dataMin;
+    if (qFuzzyIsNull(span))
+        span = qFuzzyIsNull(dataMax) ? 1.0 : qAbs(dataMax);
+    const qreal headroom = span * m_autoRangeHeadroom;
+
+    qreal min = m_min;
+    qreal max = m_max;
+    const bool empty = qFuzzyIsNull(m_max - m_min);
+    if (fit || empty) {
+        min = dataMin - headroom;
+        max = dataMax + headroom;
+    } else if (dataMin < m_min || dataMax > m_max) {
+        // Expand only the side the data has left, so that a growing series does not
+        // move the other end of the range
+        if (dataMin < m_min)
+            min = dataMin - headroom;
+        if (dataMax > m_max)
+            max = dataMax + headroom;
+    } else if (m_autoRangeHysteresis < 1.0
+               && (dataMax - dataMin) + 2.0 * headroom < (m_max - m_min) * (1.0 - m_autoRangeHysteresis)) {
+        min = dataMin - headroom;
+        max = dataMax + headroom;
+    }
+
+    if (min != m_min || max != m_max)
+        setRange(min, max);
+}
+
 void QValueAxisPrivate::initializeGraphics(QGraphicsItem *parent)
 {
     Q_Q(QValueAxis);
@@ -462,6 +643,17 @@ void QValueAxisPrivate::initializeGraphics(QGraphicsItem *parent)
 }
 
 
+/*
+ * Suspends the auto range updates while many series are attached to the axis, so that the range
+ * is fitted once to all of them when unblocked.
+ */
+void QValueAxisPrivate::setAutoRangeBlocked(bool blocked)
+{
+    m_autoRangeBlocked = blocked;
+    if (!blocked)
+        updateAutoRange(true);
+}
+
 void QValueAxisPrivate::initializeDomain(AbstractDomain *domain)
 {
     if (orientation() == Qt::Vertical) {
@@ -476,6 +668,7 @@ void QValueAxisPrivate::initializeDomain(AbstractDomain *domain)
         else
             setRange(domain->minX(), domain->maxX());
     }
+    updateAutoRange(true);
 }
 
 #include "moc_qvalueaxis.cpp"
@@ -44,6 +44,9 @@ class QT_CHARTS_EXPORT QValueAxis : public QAbstractAxis
     Q_PROPERTY(qreal max READ max WRITE setMax NOTIFY maxChanged)
     Q_PROPERTY(QString labelFormat READ labelFormat WRITE setLabelFormat NOTIFY labelFormatChanged)
     Q_PROPERTY(int minorTickCount READ minorTickCount WRITE setMinorTickCount NOTIFY minorTickCountChanged)
+    Q_PROPERTY(bool autoRange READ isAutoRange WRITE setAutoRange NOTIFY autoRangeChanged)
+    Q_PROPERTY(qreal autoRangeHeadroom READ autoRangeHeadroom WRITE setAutoRangeHeadroom NOTIFY autoRangeHeadroomChanged)
+    Q_PROPERTY(qreal autoRangeHysteresis READ autoRangeHysteresis WRITE setAutoRangeHysteresis NOTIFY autoRangeHysteresisChanged)
 
 public:
     explicit QValueAxis(QObject *parent = Q_NULLPTR);
@@ -71,6 +74,14 @@ public:
     void setLabelFormat(const QString &format);
     QString labelFormat() const;
 
+    //automatic range handling
+    void setAutoRange(bool autoRange);
+    bool isAutoRange() const;
+    void setAutoRangeHeadroom(qreal headroom);
+    qreal autoRangeHeadroom() const;
+    void setAutoRangeHysteresis(qreal hysteresis);
+    qreal autoRangeHysteresis() const;
+
 public Q_SLOTS:
     void applyNiceNumbers();
 
@@ -81,6 +92,9 @@ Q_SIGNALS:
     void tickCountChanged(int tickCount);
     void minorTickCountChanged(int tickCount);
     void labelFormatChanged(const QString &format);
+    void autoRangeChanged(bool autoRange);
+    void autoRangeHeadroomChanged(qreal headroom);
+    void autoRangeHysteresisChanged(qreal hysteresis);
 
 private:
     Q_DECLARE_PRIVATE(QValueAxis)
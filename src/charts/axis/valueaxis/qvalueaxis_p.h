@@ -41,6 +41,7 @@
 
 #include <QtCharts/QValueAxis>
 #include <private/qabstractaxis_p.h>
+#include <private/labelformatter_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -59,6 +60,11 @@ public:
     qreal max() { return m_max; }
     void setRange(qreal min,qreal max);
 
+    const LabelFormatter &labelFormatter() const { return m_labelFormatter; }
+
+    void updateAutoRange(bool fit = false);
+    void setAutoRangeBlocked(bool blocked);
+
 protected:
     void setMin(const QVariant &min);
     void setMax(const QVariant &max);
@@ -69,8 +75,12 @@ private:
     qreal m_max;
     int m_tickCount;
     int m_minorTickCount;
-    QString m_format;
+    LabelFormatter m_labelFormatter;
     bool m_applying;
+    bool m_autoRange;
+    bool m_autoRangeBlocked;
+    qreal m_autoRangeHeadroom;
+    qreal m_autoRangeHysteresis;
     Q_DECLARE_PUBLIC(QValueAxis)
 };
 
@@ -39,11 +39,15 @@
 #include <private/baranimation_p.h>
 #include <private/chartdataset_p.h>
 #include <QtCore/QtMath>
+#include <QtCore/QHash>
 #include <QtGui/QPainter>
-#include <QtGui/QTextDocument>
+#include <QtWidgets/QGraphicsSceneEvent>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Above this many bars, the bars are painted in batches by the chart item itself
+static const int batchedBarThreshold = 1000;
+
 AbstractBarChartItem::AbstractBarChartItem(QAbstractBarSeries *series, QGraphicsItem* item) :
     ChartItem(series->d_func(),item),
     m_animation(0),
@@ -51,13 +55,21 @@ AbstractBarChartItem::AbstractBarChartItem(QAbstractBarSeries *series, QGraphics
     m_firstCategory(-1),
     m_lastCategory(-2),
     m_categoryCount(0),
-    m_labelItemsMissing(false),
     m_orientation(Qt::Horizontal),
-    m_resetAnimation(true)
+    m_resetAnimation(true),
+    m_batched(false),
+    m_hoveredSet(0),
+    m_hoveredCategory(-1),
+    m_pressedSet(0),
+    m_pressedCategory(-1),
+    m_bucketSize(1),
+    m_bucketCount(0)
 {
 
     setFlag(ItemClipsChildrenToShape);
     setFlag(QGraphicsItem::ItemIsSelectable);
+    // Bar items handle the mouse unless the bars are batched
+    setAcceptedMouseButtons(Qt::NoButton);
     connect(series->d_func(), SIGNAL(updatedLayout()), this, SLOT(handleLayoutChanged()));
     connect(series->d_func(), SIGNAL(updatedBars()), this, SLOT(handleUpdatedBars()));
     connect(series->d_func(), SIGNAL(labelsVisibleChanged(bool)), this, SLOT(handleLabelsVisibleChanged(bool)));
@@ -68,6 +80,8 @@ AbstractBarChartItem::AbstractBarChartItem(QAbstractBarSeries *series, QGraphics
             this, &AbstractBarChartItem::handleBarValueAdd);
     connect(series->d_func(), &QAbstractBarSeriesPrivate::setValueRemoved,
             this, &AbstractBarChartItem::handleBarValueRemove);
+    connect(series->d_func(), &QAbstractBarSeriesPrivate::setValuesReplaced,
+            this, &AbstractBarChartItem::handleBarValuesReplace);
     connect(series, SIGNAL(visibleChanged()), this, SLOT(handleVisibleChanged()));
     connect(series, SIGNAL(opacityChanged()), this, SLOT(handleOpacityChanged()));
     connect(series, SIGNAL(labelsFormatChanged(QString)), this, SLOT(handleUpdatedBars()));
@@ -90,9 +104,84 @@ AbstractBarChartItem::~AbstractBarChartItem()
 
 void AbstractBarChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    Q_UNUSED(painter);
     Q_UNUSED(option);
     Q_UNUSED(widget);
+
+    const bool labelsVisible = m_series->isLabelsVisible() && m_labels.size() == m_layout.size();
+    if ((!m_batched && !labelsVisible) || !m_series->isVisible())
+        return;
+
+    painter->save();
+    painter->setClipRect(m_rect);
+    painter->setOpacity(painter->opacity() * m_series->opacity());
+
+    if (m_batched) {
+        // Paint all bars of a set with a single call
+        const int setCount = m_layoutSets.size();
+        const bool bucketed = m_bucketSize > 1 && m_bucketLayout.size() == setCount * m_bucketCount;
+        QVector<QRectF> rects;
+        rects.reserve(bucketed ? m_bucketCount : m_categoryCount);
+        for (int set = 0; set < setCount; set++) {
+            QBarSet *barSet = m_layoutSets.at(set);
+            if (!barSet)
+                continue;
+            QBarSetPrivate *barSetP = barSet->d_ptr.data();
+            rects.resize(0);
+            if (bucketed) {
+                for (int bucket = 0; bucket < m_bucketCount; bucket++) {
+                    const QRectF &rect = m_bucketLayout.at(set * m_bucketCount + bucket);
+                    if (!rect.isEmpty())
+                        rects.append(rect);
+                }
+            } else {
+                for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+                    const QRectF &rect = m_layout.at(barLayoutIndex(set, category));
+                    if (!rect.isEmpty())
+                        rects.append(rect);
+                }
+            }
+            painter->setPen(barSetP->m_pen);
+            painter->setBrush(barSetP->m_brush);
+            painter->drawRects(rects);
+        }
+    }
+
+    // Labels are painted on top of all bars, bar items stack behind this item
+    if (labelsVisible)
+        paintLabels(painter);
+
+    painter->restore();
+}
+
+void AbstractBarChartItem::paintLabels(QPainter *painter)
+{
+    const qreal angle = m_series->d_func()->labelsAngle();
+    const QPointF margin(ChartPresenter::textMargin(), ChartPresenter::textMargin());
+    const int setCount = m_layoutSets.size();
+    for (int set = 0; set < setCount; set++) {
+        QBarSet *barSet = m_layoutSets.at(set);
+        if (!barSet)
+            continue;
+        QBarSetPrivate *barSetP = barSet->d_ptr.data();
+        painter->setFont(barSetP->m_labelFont);
+        painter->setPen(barSetP->m_labelBrush.color());
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const BarLabel &label = m_labels.at(barLayoutIndex(set, category));
+            if (!label.visible)
+                continue;
+            if (angle == 0.0) {
+                painter->drawStaticText(label.pos + margin, label.text);
+            } else {
+                // Rotate around the label center
+                const QPointF halfSize(label.size.width() / 2.0, label.size.height() / 2.0);
+                painter->save();
+                painter->translate(label.pos + halfSize);
+                painter->rotate(angle);
+                painter->drawStaticText(margin - halfSize, label.text);
+                painter->restore();
+            }
+        }
+    }
 }
 
 QRectF AbstractBarChartItem::boundingRect() const
@@ -100,19 +189,27 @@ QRectF AbstractBarChartItem::boundingRect() const
     return m_rect;
 }
 
+bool AbstractBarChartItem::contains(const QPointF &point) const
+{
+    if (m_batched) {
+        int set;
+        int category;
+        return batchedBarAt(point, set, category);
+    }
+    return ChartItem::contains(point);
+}
+
 void AbstractBarChartItem::initializeFullLayout()
 {
     qreal setCount = m_series->count();
 
     for (int set = 0; set < setCount; set++) {
-        QBarSet *barSet = m_series->barSets().at(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < bars.size(); i++) {
-            Bar *bar = bars.at(i);
-            initializeLayout(set, bar->index(), bar->layoutIndex(), true);
-            // Make bar initially hidden to avoid artifacts, layout setting will show it
-            bar->setVisible(false);
-        }
+        for (int category = m_firstCategory; category <= m_lastCategory; category++)
+            initializeLayout(set, category, barLayoutIndex(set, category), true);
+        // Make bars initially hidden to avoid artifacts, layout setting will show them
+        const QList<Bar *> bars = m_barMap.value(m_series->barSets().at(set));
+        for (int i = 0; i < bars.size(); i++)
+            bars.at(i)->setVisible(false);
     }
 }
 
@@ -155,6 +252,7 @@ void AbstractBarChartItem::setLayout(const QVector<QRectF> &layout)
         return;
 
     m_layout = layout;
+    updateBuckets();
 
     const bool visible = m_series->isVisible();
     for (int set = 0; set < setCount; set++) {
@@ -170,6 +268,8 @@ void AbstractBarChartItem::setLayout(const QVector<QRectF> &layout)
         }
     }
 
+    if (m_batched)
+        update();
     positionLabels();
 }
 
@@ -202,17 +302,11 @@ void AbstractBarChartItem::handleLayoutChanged()
 
 void AbstractBarChartItem::handleLabelsVisibleChanged(bool visible)
 {
+    // Hidden labels are not kept up to date, so drop them
+    if (!visible)
+        m_labels.clear();
+
     bool newVisible = visible && m_series->isVisible();
-    QMapIterator<QBarSet *, QList<Bar *> > i(m_barMap);
-    while (i.hasNext()) {
-        i.next();
-        const QList<Bar *> &bars = i.value();
-        for (int j = 0; j < bars.size(); j++) {
-            QGraphicsTextItem *label = bars.at(j)->labelItem();
-            if (label)
-                label->setVisible(newVisible);
-        }
-    }
     if (newVisible) {
         handleUpdatedBars();
         positionLabels();
@@ -240,12 +334,18 @@ void AbstractBarChartItem::handleVisibleChanged()
             bar->setVisible(visible && i.key()->at(bar->index()) != 0.0);
         }
     }
+    if (m_batched) {
+        if (!visible)
+            setHoveredBar(0, -1);
+        update();
+    }
 }
 
 void AbstractBarChartItem::handleOpacityChanged()
 {
     foreach (QGraphicsItem *item, childItems())
         item->setOpacity(m_series->opacity());
+    update();
 }
 
 void AbstractBarChartItem::handleUpdatedBars()
@@ -260,7 +360,8 @@ void AbstractBarChartItem::handleUpdatedBars()
         const bool updateLabels =
                 m_series->isLabelsVisible() && m_series->isVisible() && presenter();
         if (updateLabels) {
-            createLabelItems();
+            if (m_labels.size() != m_layout.size())
+                m_labels = QVector<BarLabel>(m_layout.size());
             m_series->d_func()->setLabelsDirty(false);
         }
 
@@ -268,11 +369,7 @@ void AbstractBarChartItem::handleUpdatedBars()
             QBarSet *barSet = m_series->d_func()->barsetAt(set);
             QBarSetPrivate *barSetP = barSet->d_ptr.data();
             const bool setVisualsDirty = barSetP->visualsDirty();
-            const bool setLabelsDirty = barSetP->labelsDirty();
             barSetP->setVisualsDirty(false);
-            if (updateLabels)
-                barSetP->setLabelsDirty(false);
-            const int actualBarCount = barSet->count();
             const QList<Bar *> bars = m_barMap.value(barSet);
             for (int i = 0; i < bars.size(); i++) {
                 Bar *bar = bars.at(i);
@@ -282,26 +379,45 @@ void AbstractBarChartItem::handleUpdatedBars()
                     bar->setVisualsDirty(false);
                     bar->update();
                 }
-                if (updateLabels && actualBarCount > bar->index()) {
-                    if (seriesLabelsDirty || setLabelsDirty || bar->labelDirty()) {
-                        bar->setLabelDirty(false);
-                        QGraphicsTextItem *label = bar->labelItem();
-                        QString valueLabel;
-                        qreal value = barSetP->value(bar->index());
-                        if (value == 0.0) {
-                            label->setVisible(false);
-                        } else {
-                            label->setVisible(m_series->isLabelsVisible());
-                            valueLabel = generateLabelText(set, bar->index(), value);
-                        }
-                        label->setHtml(valueLabel);
-                        label->setFont(barSetP->m_labelFont);
-                        label->setDefaultTextColor(barSetP->m_labelBrush.color());
-                        label->update();
+            }
+        }
+
+        bool labelsChanged = false;
+        if (updateLabels) {
+            // Only the labels whose text may have changed are laid out again
+            const qreal margin = 2.0 * ChartPresenter::textMargin();
+            for (int set = 0; set < m_layoutSets.size(); set++) {
+                QBarSet *barSet = m_layoutSets.at(set);
+                if (!barSet)
+                    continue;
+                QBarSetPrivate *barSetP = barSet->d_ptr.data();
+                const bool setLabelsDirty = barSetP->labelsDirty();
+                barSetP->setLabelsDirty(false);
+                const int actualBarCount = barSet->count();
+                for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+                    BarLabel &label = m_labels[barLayoutIndex(set, category)];
+                    if (!seriesLabelsDirty && !setLabelsDirty && !label.dirty)
+                        continue;
+                    label.dirty = false;
+                    labelsChanged = true;
+                    const qreal value = category < actualBarCount ? barSetP->value(category) : 0.0;
+                    if (value == 0.0) {
+                        label.text.setText(QString());
+                        label.size = QSizeF();
+                        continue;
                     }
+                    label.text.setText(generateLabelText(set, category, value));
+                    label.text.setTextFormat(Qt::RichText);
+                    label.text.prepare(QTransform(), barSetP->m_labelFont);
+                    label.size = label.text.size() + QSizeF(margin, margin);
                 }
             }
         }
+        // Label sizes may have changed, so they need to be positioned and culled again
+        if (labelsChanged)
+            positionLabels();
+        else if (m_batched)
+            update();
     }
 }
 
@@ -315,62 +431,60 @@ void AbstractBarChartItem::positionLabels()
     // By default position labels on horizontal bar series
     // Vertical bar series overload positionLabels() to call positionLabelsVertical()
 
-    if (!m_series->isLabelsVisible())
+    if (!m_series->isLabelsVisible() || m_labels.size() != m_layout.size())
         return;
-    createLabelItems();
 
     QTransform transform;
     const qreal angle = m_series->d_func()->labelsAngle();
     if (angle != 0.0)
         transform.rotate(angle);
 
-    int setCount = m_series->count();
+    int setCount = m_layoutSets.size();
     for (int set = 0; set < setCount; set++) {
-        QBarSet *barSet = m_series->d_func()->barsetAt(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < bars.size(); i++) {
-            Bar *bar = bars.at(i);
-            QGraphicsTextItem *label = bar->labelItem();
-
-            QRectF labelRect = label->boundingRect();
+        QBarSet *barSet = m_layoutSets.at(set);
+        if (!barSet)
+            continue;
+        int offset = barSet->d_ptr->m_pen.width() / 2 + 2;
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const int layoutIndex = barLayoutIndex(set, category);
+            const QRectF &barRect = m_layout.at(layoutIndex);
+            BarLabel &label = m_labels[layoutIndex];
+
+            QRectF labelRect(QPointF(), label.size);
             QPointF center = labelRect.center();
 
             qreal xPos = 0;
-            qreal yPos = m_layout.at(bar->layoutIndex()).center().y() - center.y();
+            qreal yPos = barRect.center().y() - center.y();
 
             int xDiff = 0;
             if (angle != 0.0) {
-                label->setTransformOriginPoint(center.x(), center.y());
-                label->setRotation(m_series->d_func()->labelsAngle());
                 qreal oldWidth = labelRect.width();
                 labelRect = transform.mapRect(labelRect);
                 xDiff = (labelRect.width() - oldWidth) / 2;
             }
 
-            int offset = bar->pen().width() / 2 + 2;
-
             switch (m_series->labelsPosition()) {
             case QAbstractBarSeries::LabelsCenter:
-                xPos = m_layout.at(bar->layoutIndex()).center().x() - center.x();
+                xPos = barRect.center().x() - center.x();
                 break;
             case QAbstractBarSeries::LabelsInsideEnd:
-                xPos = m_layout.at(bar->layoutIndex()).right() - labelRect.width() - offset + xDiff;
+                xPos = barRect.right() - labelRect.width() - offset + xDiff;
                 break;
             case QAbstractBarSeries::LabelsInsideBase:
-                xPos = m_layout.at(bar->layoutIndex()).left() + offset + xDiff;
+                xPos = barRect.left() + offset + xDiff;
                 break;
             case QAbstractBarSeries::LabelsOutsideEnd:
-                xPos = m_layout.at(bar->layoutIndex()).right() + offset + xDiff;
+                xPos = barRect.right() + offset + xDiff;
                 break;
             default:
                 // Invalid position, never comes here
                 break;
             }
 
-            label->setPos(xPos, yPos);
-            label->setZValue(zValue() + 1);
+            label.pos = QPointF(xPos, yPos);
         }
     }
+    cullLabels();
 }
 
 void AbstractBarChartItem::handleBarValueChange(int index, QtCharts::QBarSet *barset)
@@ -397,6 +511,12 @@ void AbstractBarChartItem::handleBarValueRemove(int index, int count, QBarSet *b
     handleLayoutChanged();
 }
 
+void AbstractBarChartItem::handleBarValuesReplace(QBarSet *barset)
+{
+    markLabelsDirty(barset, 0, -1);
+    handleLayoutChanged();
+}
+
 void AbstractBarChartItem::handleSeriesAdded(QAbstractSeries *series)
 {
     Q_UNUSED(series)
@@ -427,84 +547,123 @@ void AbstractBarChartItem::handleSeriesRemoved(QAbstractSeries *series)
 
 void AbstractBarChartItem::positionLabelsVertical()
 {
-    if (!m_series->isLabelsVisible())
+    if (!m_series->isLabelsVisible() || m_labels.size() != m_layout.size())
         return;
-    createLabelItems();
 
     QTransform transform;
     const qreal angle = m_series->d_func()->labelsAngle();
     if (angle != 0.0)
         transform.rotate(angle);
 
-    int setCount = m_series->count();
+    int setCount = m_layoutSets.size();
     for (int set = 0; set < setCount; set++) {
-        QBarSet *barSet = m_series->d_func()->barsetAt(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < bars.size(); i++) {
-            Bar *bar = bars.at(i);
-            QGraphicsTextItem *label = bar->labelItem();
-
-            QRectF labelRect = label->boundingRect();
+        QBarSet *barSet = m_layoutSets.at(set);
+        if (!barSet)
+            continue;
+        int offset = barSet->d_ptr->m_pen.width() / 2 + 2;
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const int layoutIndex = barLayoutIndex(set, category);
+            const QRectF &barRect = m_layout.at(layoutIndex);
+            BarLabel &label = m_labels[layoutIndex];
+
+            QRectF labelRect(QPointF(), label.size);
             QPointF center = labelRect.center();
 
-            qreal xPos = m_layout.at(bar->layoutIndex()).center().x() - center.x();
+            qreal xPos = barRect.center().x() - center.x();
             qreal yPos = 0;
 
             int yDiff = 0;
             if (angle != 0.0) {
-                label->setTransformOriginPoint(center.x(), center.y());
-                label->setRotation(m_series->d_func()->labelsAngle());
                 qreal oldHeight = labelRect.height();
                 labelRect = transform.mapRect(labelRect);
                 yDiff = (labelRect.height() - oldHeight) / 2;
             }
 
-            int offset = bar->pen().width() / 2 + 2;
-
             switch (m_series->labelsPosition()) {
             case QAbstractBarSeries::LabelsCenter:
-                yPos = m_layout.at(bar->layoutIndex()).center().y() - center.y();
+                yPos = barRect.center().y() - center.y();
                 break;
             case QAbstractBarSeries::LabelsInsideEnd:
-                yPos = m_layout.at(bar->layoutIndex()).top() + offset + yDiff;
+                yPos = barRect.top() + offset + yDiff;
                 break;
             case QAbstractBarSeries::LabelsInsideBase:
-                yPos = m_layout.at(bar->layoutIndex()).bottom() - labelRect.height() - offset + yDiff;
+                yPos = barRect.bottom() - labelRect.height() - offset + yDiff;
                 break;
             case QAbstractBarSeries::LabelsOutsideEnd:
-                yPos = m_layout.at(bar->layoutIndex()).top() - labelRect.height() - offset + yDiff;
+                yPos = barRect.top() - labelRect.height() - offset + yDiff;
                 break;
             default:
                 // Invalid position, never comes here
                 break;
             }
 
-            label->setPos(xPos, yPos);
-            label->setZValue(zValue() + 1);
+            label.pos = QPointF(xPos, yPos);
         }
     }
+    cullLabels();
 }
 
-void AbstractBarChartItem::createLabelItems()
+// Hides the labels that are outside the plot area or that would overlap a label accepted before
+// them, so that dense series don't paint unreadable clutter. Labels partially outside the plot
+// area are painted clipped to it.
+void AbstractBarChartItem::cullLabels()
 {
-    if (!m_labelItemsMissing)
-        return;
+    QTransform transform;
+    const qreal angle = m_series->d_func()->labelsAngle();
+    if (angle != 0.0)
+        transform.rotate(angle);
 
-    m_labelItemsMissing = false;
+    // Find the painted rects of the labels that are at least partially in the plot area
+    QVector<QRectF> labelRects(m_labels.size());
+    QSizeF cellSize(0.0, 0.0);
+    for (int i = 0; i < m_labels.size(); i++) {
+        BarLabel &label = m_labels[i];
+        label.visible = false;
+        if (label.size.isEmpty())
+            continue;
+        QRectF rect(label.pos, label.size);
+        if (angle != 0.0) {
+            const QPointF center = rect.center();
+            rect.moveCenter(QPointF());
+            rect = transform.mapRect(rect).translated(center);
+        }
+        if (!m_rect.intersects(rect))
+            continue;
+        labelRects[i] = rect;
+        cellSize = cellSize.expandedTo(rect.size());
+        label.visible = true;
+    }
 
-    QMapIterator<QBarSet *, QList<Bar *> > i(m_barMap);
-    while (i.hasNext()) {
-        i.next();
-        const QList<Bar *> &bars = i.value();
-        for (int j = 0; j < bars.size(); j++) {
-            QGraphicsTextItem *label = bars.at(j)->labelItem();
-            if (!label) {
-                QGraphicsTextItem *newLabel = new QGraphicsTextItem(this);
-                newLabel->document()->setDocumentMargin(ChartPresenter::textMargin());
-                bars.at(j)->setLabelItem(newLabel);
+    // Accepted labels are bucketed by their top left corner into cells as large as the largest
+    // label, so a label can only overlap the labels in its own or the adjacent cells. The top
+    // left corner can be up to one cell before the plot area, hence the extra cells.
+    if (!cellSize.isEmpty()) {
+        const int columns = qCeil(m_rect.width() / cellSize.width()) + 3;
+        QHash<int, QVector<int> > cells;
+        for (int i = 0; i < m_labels.size(); i++) {
+            BarLabel &label = m_labels[i];
+            if (!label.visible)
+                continue;
+            const QRectF &rect = labelRects.at(i);
+            const int column = qFloor((rect.left() - m_rect.left()) / cellSize.width()) + 1;
+            const int row = qFloor((rect.top() - m_rect.top()) / cellSize.height()) + 1;
+            for (int r = row - 1; r <= row + 1 && label.visible; r++) {
+                for (int c = column - 1; c <= column + 1 && label.visible; c++) {
+                    const QVector<int> accepted = cells.value(r * columns + c);
+                    for (int j = 0; j < accepted.size(); j++) {
+                        if (labelRects.at(accepted.at(j)).intersects(rect)) {
+                            label.visible = false;
+                            break;
+                        }
+                    }
+                }
             }
+            if (label.visible)
+                cells[row * columns + column].append(i);
         }
     }
+
+    update();
 }
 
 // This function is called whenever barsets change
@@ -515,9 +674,18 @@ void AbstractBarChartItem::handleSetStructureChange()
 
     // Remove obsolete sets
     for (int i = 0; i < oldSets.size(); i++) {
-        if (!newSets.contains(oldSets.at(i))) {
-            qDeleteAll(m_barMap.value(oldSets.at(i)));
-            m_barMap.remove(oldSets.at(i));
+        QBarSet *set = oldSets.at(i);
+        if (!newSets.contains(set)) {
+            qDeleteAll(m_barMap.value(set));
+            m_barMap.remove(set);
+            if (m_hoveredSet == set)
+                setHoveredBar(0, -1);
+            if (m_pressedSet == set)
+                m_pressedSet = 0;
+            // The set may be deleted, so make sure its old layout is not used for new sets
+            const int layoutSet = m_layoutSets.indexOf(set);
+            if (layoutSet >= 0)
+                m_layoutSets[layoutSet] = 0;
         }
     }
 
@@ -541,15 +709,12 @@ QString AbstractBarChartItem::generateLabelText(int set, int category, qreal val
 {
     Q_UNUSED(set);
     Q_UNUSED(category);
-    static const QString valueTag(QLatin1String("@value"));
-    QString valueLabel;
-    if (m_series->labelsFormat().isEmpty()) {
-        valueLabel = presenter()->numberToString(value);
-    } else {
-        valueLabel = m_series->labelsFormat();
-        valueLabel.replace(valueTag, presenter()->numberToString(value));
-    }
-    return valueLabel;
+    const LabelTemplate &labelsTemplate = m_series->d_func()->labelsTemplate();
+    if (labelsTemplate.isEmpty())
+        return presenter()->numberToString(value);
+    if (!labelsTemplate.containsTag(0))
+        return labelsTemplate.format();
+    return labelsTemplate.expand(presenter()->numberToString(value));
 }
 
 void AbstractBarChartItem::updateBarItems()
@@ -565,6 +730,8 @@ void AbstractBarChartItem::updateBarItems()
     }
 
     int lastBarIndex = m_series->d_func()->categoryCount() - 1;
+    const int oldFirstCategory = m_firstCategory;
+    const int oldCategoryCount = m_categoryCount;
 
     if (lastBarIndex < 0) {
         // Indicate invalid categories by negatives
@@ -578,94 +745,289 @@ void AbstractBarChartItem::updateBarItems()
         m_categoryCount = m_lastCategory - m_firstCategory + 1;
     }
 
-    QList<QBarSet *> newSets = m_series->barSets();
-    QList<QBarSet *> oldSets = m_barMap.keys();
+    const QList<QBarSet *> newSets = m_series->barSets();
+    Q_ASSERT(newSets.size() == m_barMap.size());
 
-    Q_ASSERT(newSets.size() == oldSets.size());
+    // Bucket adjacent categories when there are more of them than pixels along the category axis
+    const qreal categoryExtent = m_orientation == Qt::Vertical ? m_rect.width() : m_rect.height();
+    if (categoryExtent >= 1.0 && m_categoryCount > categoryExtent) {
+        m_bucketSize = qCeil(m_categoryCount / categoryExtent);
+        m_bucketCount = m_lastCategory / m_bucketSize - m_firstCategory / m_bucketSize + 1;
+    } else {
+        m_bucketSize = 1;
+        m_bucketCount = m_categoryCount;
+    }
 
-    int layoutSize = m_categoryCount * newSets.size();
+    const int layoutSize = m_categoryCount * newSets.size();
+    const bool batched = layoutSize > batchedBarThreshold || m_bucketSize > 1;
+    if (batched != m_batched) {
+        m_batched = batched;
+        setHoveredBar(0, -1);
+        m_pressedSet = 0;
+        setAcceptHoverEvents(batched);
+        setAcceptedMouseButtons(batched ? Qt::LeftButton | Qt::RightButton : Qt::NoButton);
+        update();
+    }
 
-    QVector<QRectF> oldLayout = m_layout;
-    if (layoutSize != m_layout.size())
-        m_layout.resize(layoutSize);
+    const QVector<QRectF> oldLayout = m_layout;
+    m_layout = QVector<QRectF>(layoutSize);
+    const QVector<BarLabel> oldLabels = m_labels;
+    if (oldLabels.size() == oldLayout.size() && m_series->isLabelsVisible())
+        m_labels = QVector<BarLabel>(layoutSize);
+    else
+        m_labels.clear();
 
-    // Create new graphic items for bars or remove excess ones
-    int layoutIndex = 0;
+    // Create new graphic items for bars or remove excess ones. Bars that are still within the
+    // category range keep their category, so that their old layout can be reused.
     for (int s = 0; s < newSets.size(); s++) {
         QBarSet *set = newSets.at(s);
+        const int oldSet = m_layoutSets.indexOf(set);
         QList<Bar *> bars = m_barMap.value(set);
-        int addCount = m_categoryCount - bars.size();
-        if (addCount > 0) {
-            for (int c = 0; c < addCount; c++) {
-                Bar *bar = new Bar(set, this);
-                bars.append(bar);
-                connect(bar, &Bar::clicked, m_series, &QAbstractBarSeries::clicked);
-                connect(bar, &Bar::hovered, m_series, &QAbstractBarSeries::hovered);
-                connect(bar, &Bar::pressed, m_series, &QAbstractBarSeries::pressed);
-                connect(bar, &Bar::released, m_series, &QAbstractBarSeries::released);
-                connect(bar, &Bar::doubleClicked, m_series, &QAbstractBarSeries::doubleClicked);
-
-                connect(bar, &Bar::clicked, set, &QBarSet::clicked);
-                connect(bar, &Bar::hovered, set, &QBarSet::hovered);
-                connect(bar, &Bar::pressed, set, &QBarSet::pressed);
-                connect(bar, &Bar::released, set, &QBarSet::released);
-                connect(bar, &Bar::doubleClicked, set, &QBarSet::doubleClicked);
-
-                m_labelItemsMissing = true;
+        QVector<Bar *> categoryBars(m_categoryCount, nullptr);
+        QList<Bar *> unassignedBars;
+        for (int i = 0; i < bars.size(); i++) {
+            Bar *bar = bars.at(i);
+            if (m_batched) {
+                delete bar;
+            } else if (bar->index() < m_firstCategory || bar->index() > m_lastCategory) {
+                unassignedBars.append(bar);
+            } else {
+                categoryBars[bar->index() - m_firstCategory] = bar;
             }
         }
-        // Update bar indexes
-        QHash<int, Bar*> indexMap;
-        QVector<Bar *> unassignedBars(m_categoryCount, nullptr);
-        int unassignedIndex(0);
+
         QList<Bar *> newBars;
-        newBars.reserve(m_categoryCount);
-        for (int c = 0; c < bars.size(); c++) {
-            Bar *bar = bars.at(c);
-            if (bar->index() < m_firstCategory || bar->index() > m_lastCategory) {
-                // Delete excess unassigned bars first
-                if (addCount < 0) {
-                    addCount++;
-                    delete bar;
-                    bar = nullptr;
-                } else {
-                    unassignedBars[unassignedIndex++] = bar;
-                    bar->setLayoutIndex(layoutIndex);
-                    newBars.append(bar);
-                    layoutIndex++;
+        if (!m_batched)
+            newBars.reserve(m_categoryCount);
+        for (int c = m_firstCategory; c <= m_lastCategory; c++) {
+            const int layoutIndex = barLayoutIndex(s, c);
+            const bool oldCategory = oldSet >= 0 && c >= oldFirstCategory
+                    && c < oldFirstCategory + oldCategoryCount;
+            if (oldCategory) {
+                const int oldLayoutIndex = oldSet * oldCategoryCount + c - oldFirstCategory;
+                m_layout[layoutIndex] = oldLayout.at(oldLayoutIndex);
+                if (!m_labels.isEmpty())
+                    m_labels[layoutIndex] = oldLabels.at(oldLayoutIndex);
+            }
+
+            Bar *bar = nullptr;
+            if (!m_batched) {
+                bar = categoryBars.at(c - m_firstCategory);
+                if (!bar) {
+                    bar = unassignedBars.isEmpty() ? createBar(set) : unassignedBars.takeLast();
+                    bar->setIndex(c);
                 }
-            } else {
-                indexMap.insert(bar->index(), bar);
-                newBars.append(bar);
-                m_layout[layoutIndex] = oldLayout.at(bar->layoutIndex());
                 bar->setLayoutIndex(layoutIndex);
-                layoutIndex++;
+                newBars.append(bar);
             }
-        }
-        unassignedIndex = 0;
-        for (int c = m_firstCategory; c <= m_lastCategory; c++) {
-            Bar *bar = indexMap.value(c);
-            if (!bar) {
-                bar = unassignedBars.at(unassignedIndex++);
-                bar->setIndex(c);
-                indexMap.insert(bar->index(), bar);
+
+            if (m_animation && !oldCategory) {
+                initializeLayout(s, c, layoutIndex, m_resetAnimation);
+                if (bar) {
+                    bar->setRect(m_layout.at(layoutIndex));
+                    // Make bar initially hidden to avoid artifacts, layout setting will show it
+                    bar->setVisible(false);
+                }
             }
         }
+        qDeleteAll(unassignedBars);
 
-        m_indexForBarMap.insert(set, indexMap);
+        m_barMap.insert(set, newBars);
+    }
+    m_layoutSets = newSets;
+}
 
-        if (m_animation) {
-            for (int i = 0; i < unassignedIndex; i++) {
-                Bar *bar = unassignedBars.at(i);
-                initializeLayout(s, bar->index(), bar->layoutIndex(), m_resetAnimation);
-                bar->setRect(m_layout.at(bar->layoutIndex()));
-                // Make bar initially hidden to avoid artifacts, layout setting will show it
-                bar->setVisible(false);
+Bar *AbstractBarChartItem::createBar(QBarSet *barset)
+{
+    Bar *bar = new Bar(barset, this);
+    // Labels are painted by this item on top of the bars
+    bar->setFlag(QGraphicsItem::ItemStacksBehindParent);
+    connect(bar, &Bar::clicked, m_series, &QAbstractBarSeries::clicked);
+    connect(bar, &Bar::hovered, m_series, &QAbstractBarSeries::hovered);
+    connect(bar, &Bar::pressed, m_series, &QAbstractBarSeries::pressed);
+    connect(bar, &Bar::released, m_series, &QAbstractBarSeries::released);
+    connect(bar, &Bar::doubleClicked, m_series, &QAbstractBarSeries::doubleClicked);
+
+    connect(bar, &Bar::clicked, barset, &QBarSet::clicked);
+    connect(bar, &Bar::hovered, barset, &QBarSet::hovered);
+    connect(bar, &Bar::pressed, barset, &QBarSet::pressed);
+    connect(bar, &Bar::released, barset, &QBarSet::released);
+    connect(bar, &Bar::doubleClicked, barset, &QBarSet::doubleClicked);
+
+    return bar;
+}
+
+bool AbstractBarChartItem::batchedBarAt(const QPointF &point, int &set, int &category) const
+{
+    if (!m_batched || !m_series->isVisible() || m_categoryCount <= 0 || !m_rect.contains(point))
+        return false;
+
+    // Bars never extend beyond half a category from their category, so the category under the
+    // point and its neighbors are the only candidates
+    const QPointF value = domain()->calculateDomainPoint(point);
+    const qreal position = (m_orientation == Qt::Vertical ? value.x() : value.y())
+            - m_seriesPosAdjustment;
+    if (!(position > m_firstCategory - 1) || !(position < m_lastCategory + 1))
+        return false;
+    const int nearest = qRound(position);
+
+    if (m_bucketSize > 1 && m_bucketLayout.size() == m_layoutSets.size() * m_bucketCount) {
+        // Merged bars are wider than the bars of their categories, so find the bucket first and
+        // then the bar in it that reaches the point
+        const int firstBucket = m_firstCategory / m_bucketSize;
+        const int bucket = qBound(m_firstCategory, nearest, m_lastCategory) / m_bucketSize
+                - firstBucket;
+        for (int s = m_layoutSets.size() - 1; s >= 0; s--) {
+            if (!m_layoutSets.at(s))
+                continue;
+            for (int b = qMax(bucket - 1, 0); b <= qMin(bucket + 1, m_bucketCount - 1); b++) {
+                if (!m_bucketLayout.at(s * m_bucketCount + b).contains(point))
+                    continue;
+                const int firstInBucket = qMax((firstBucket + b) * m_bucketSize, m_firstCategory);
+                const int lastInBucket = qMin(firstInBucket + m_bucketSize - 1, m_lastCategory);
+                set = s;
+                category = firstInBucket;
+                for (int c = firstInBucket; c <= lastInBucket; c++) {
+                    const QRectF &rect = m_layout.at(barLayoutIndex(s, c));
+                    const bool reaches = m_orientation == Qt::Vertical
+                            ? rect.top() <= point.y() && point.y() <= rect.bottom()
+                            : rect.left() <= point.x() && point.x() <= rect.right();
+                    if (!rect.isEmpty() && reaches) {
+                        category = c;
+                        break;
+                    }
+                }
+                return true;
             }
         }
+        return false;
+    }
 
-        m_barMap.insert(set, newBars);
+    const int first = qMax(nearest - 1, m_firstCategory);
+    const int last = qMin(nearest + 1, m_lastCategory);
+
+    // Later sets are painted on top of earlier ones
+    for (int s = m_layoutSets.size() - 1; s >= 0; s--) {
+        if (!m_layoutSets.at(s))
+            continue;
+        for (int c = first; c <= last; c++) {
+            const QRectF &rect = m_layout.at(barLayoutIndex(s, c));
+            if (!rect.isEmpty() && rect.contains(point)) {
+                set = s;
+                category = c;
+                return true;
+            }
+        }
     }
+    return false;
+}
+
+// Merges the bars of each bucket into their bounding rect, set by set. The merged bar reaches the
+// largest value in the bucket, and for stacked series the highest stack, so extremes stay visible.
+void AbstractBarChartItem::updateBuckets()
+{
+    if (m_bucketSize <= 1) {
+        m_bucketLayout.clear();
+        return;
+    }
+
+    const int firstBucket = m_firstCategory / m_bucketSize;
+    const int setCount = m_layoutSets.size();
+    m_bucketLayout = QVector<QRectF>(setCount * m_bucketCount);
+    for (int set = 0; set < setCount; set++) {
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const QRectF &rect = m_layout.at(barLayoutIndex(set, category));
+            if (!rect.isEmpty())
+                m_bucketLayout[set * m_bucketCount + category / m_bucketSize - firstBucket] |= rect;
+        }
+    }
+}
+
+void AbstractBarChartItem::setHoveredBar(QBarSet *barset, int category)
+{
+    if (barset == m_hoveredSet && category == m_hoveredCategory)
+        return;
+
+    if (m_hoveredSet) {
+        emit m_series->hovered(false, m_hoveredCategory, m_hoveredSet);
+        emit m_hoveredSet->hovered(false, m_hoveredCategory);
+    }
+    m_hoveredSet = barset;
+    m_hoveredCategory = category;
+    if (m_hoveredSet) {
+        emit m_series->hovered(true, m_hoveredCategory, m_hoveredSet);
+        emit m_hoveredSet->hovered(true, m_hoveredCategory);
+    }
+}
+
+void AbstractBarChartItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
+{
+    hoverMoveEvent(event);
+}
+
+void AbstractBarChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    int set;
+    int category;
+    if (batchedBarAt(event->pos(), set, category))
+        setHoveredBar(m_layoutSets.at(set), category);
+    else
+        setHoveredBar(0, -1);
+}
+
+void AbstractBarChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    Q_UNUSED(event)
+    setHoveredBar(0, -1);
+}
+
+void AbstractBarChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    int set;
+    int category;
+    if (!batchedBarAt(event->pos(), set, category)) {
+        if (m_batched)
+            event->ignore();
+        else
+            ChartItem::mousePressEvent(event);
+        return;
+    }
+
+    m_pressedSet = m_layoutSets.at(set);
+    m_pressedCategory = category;
+    emit m_series->pressed(category, m_pressedSet);
+    emit m_pressedSet->pressed(category);
+    event->accept();
+}
+
+void AbstractBarChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
+{
+    if (!m_pressedSet) {
+        ChartItem::mouseReleaseEvent(event);
+        return;
+    }
+
+    // Like bar items, report the release and click on the pressed bar
+    QBarSet *barset = m_pressedSet;
+    m_pressedSet = 0;
+    emit m_series->released(m_pressedCategory, barset);
+    emit barset->released(m_pressedCategory);
+    emit m_series->clicked(m_pressedCategory, barset);
+    emit barset->clicked(m_pressedCategory);
+}
+
+void AbstractBarChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    int set;
+    int category;
+    if (!batchedBarAt(event->pos(), set, category)) {
+        ChartItem::mouseDoubleClickEvent(event);
+        return;
+    }
+
+    QBarSet *barset = m_layoutSets.at(set);
+    emit m_series->doubleClicked(category, barset);
+    emit barset->doubleClicked(category);
 }
 
 void AbstractBarChartItem::markLabelsDirty(QBarSet *barset, int index, int count)
@@ -675,13 +1037,13 @@ void AbstractBarChartItem::markLabelsDirty(QBarSet *barset, int index, int count
     if (index <= 0 && count < 0) {
         barset->d_ptr.data()->setLabelsDirty(true);
     } else {
-        const QList<Bar *> bars = m_barMap.value(barset);
-        const int maxIndex = count > 0 ? index + count : barset->count();
-        for (int i = 0; i < bars.size(); i++) {
-            Bar *bar = bars.at(i);
-            if (bar->index() >= index && bar->index() < maxIndex)
-                bar->setLabelDirty(true);
-        }
+        const int set = m_layoutSets.indexOf(barset);
+        if (set < 0 || m_labels.size() != m_layout.size())
+            return;
+        const int first = qMax(index, m_firstCategory);
+        const int last = count > 0 ? qMin(index + count - 1, m_lastCategory) : m_lastCategory;
+        for (int category = first; category <= last; category++)
+            m_labels[barLayoutIndex(set, category)].dirty = true;
     }
 }
 
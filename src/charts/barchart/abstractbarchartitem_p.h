@@ -44,6 +44,7 @@
 #include <QtCharts/QAbstractBarSeries>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
+#include <QtGui/QStaticText>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -64,6 +65,7 @@ public:
 public:
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
     QRectF boundingRect() const;
+    bool contains(const QPointF &point) const;
 
     virtual QVector<QRectF> calculateLayout() = 0;
     void initializeFullLayout();
@@ -87,35 +89,81 @@ public Q_SLOTS:
     void handleBarValueChange(int index, QBarSet *barset);
     void handleBarValueAdd(int index, int count, QBarSet *barset);
     void handleBarValueRemove(int index, int count, QBarSet *barset);
+    void handleBarValuesReplace(QBarSet *barset);
     void handleSeriesAdded(QAbstractSeries *series);
     void handleSeriesRemoved(QAbstractSeries *series);
 
 protected:
+    // Label of a single bar, cached until its value or the label settings change
+    struct BarLabel
+    {
+        BarLabel() : dirty(true), visible(false) {}
+        QStaticText text;
+        QSizeF size;
+        QPointF pos; // Top left corner of the unrotated label
+        bool dirty;
+        bool visible;
+    };
+
+    void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event);
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
+    void mousePressEvent(QGraphicsSceneMouseEvent *event);
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
+
+    // Bars are stored in m_layout set by set, in category order
+    int barLayoutIndex(int set, int category) const
+    {
+        return set * m_categoryCount + category - m_firstCategory;
+    }
+    bool batchedBarAt(const QPointF &point, int &set, int &category) const;
+    void updateBuckets();
+    void setHoveredBar(QBarSet *barset, int category);
+
     void positionLabelsVertical();
-    void createLabelItems();
+    void cullLabels();
+    void paintLabels(QPainter *painter);
     void handleSetStructureChange();
     virtual QString generateLabelText(int set, int category, qreal value);
     void updateBarItems();
+    Bar *createBar(QBarSet *barset);
     virtual void markLabelsDirty(QBarSet *barset, int index, int count);
     void calculateSeriesPositionAdjustmentAndWidth();
 
     QRectF m_rect;
     QVector<QRectF> m_layout;
+    // Labels are stored like m_layout, and only while the labels are visible
+    QVector<BarLabel> m_labels;
 
     BarAnimation *m_animation;
 
     QAbstractBarSeries *m_series; // Not owned.
     QMap<QBarSet *, QList<Bar *> > m_barMap;
-    QMap<QBarSet *, QHash<int, Bar *> > m_indexForBarMap;
+    // Sets in the order their bars are stored in m_layout
+    QList<QBarSet *> m_layoutSets;
     int m_firstCategory;
     int m_lastCategory;
     int m_categoryCount;
     QSizeF m_oldSize;
-    bool m_labelItemsMissing;
     Qt::Orientation m_orientation;
     bool m_resetAnimation;
     qreal m_seriesPosAdjustment;
     qreal m_seriesWidth;
+
+    // When there are lots of bars, they are painted by this item directly from m_layout instead of
+    // having a Bar item for each of them.
+    bool m_batched;
+    QBarSet *m_hoveredSet;
+    int m_hoveredCategory;
+    QBarSet *m_pressedSet;
+    int m_pressedCategory;
+
+    // When there are more categories than pixels, the batched bars of each bucket of adjacent
+    // categories are painted as one bar per set, stored set by set in m_bucketLayout
+    int m_bucketSize;
+    int m_bucketCount;
+    QVector<QRectF> m_bucketLayout;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -41,7 +41,6 @@
 
 #include <QtCharts/QChartGlobal>
 #include <QtWidgets/QGraphicsRectItem>
-#include <QtWidgets/QGraphicsTextItem>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -65,11 +64,6 @@ public:
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget = 0);
     void setVisualsDirty(bool dirty) { m_visualsDirty = dirty; }
     bool visualsDirty() const { return m_visualsDirty; }
-    void setLabelDirty(bool dirty) { m_labelDirty = dirty; }
-    bool labelDirty() const { return m_labelDirty; }
-
-    void setLabelItem(QGraphicsTextItem *labelItem) { m_labelItem = labelItem; }
-    QGraphicsTextItem *labelItem() const { return m_labelItem; }
 
     void setIndex(int index) { m_index = index; }
     int index() const { return m_index; }
@@ -87,11 +81,9 @@ private:
     int m_index;
     int m_layoutIndex;
     QBarSet *m_barset;
-    QGraphicsTextItem *m_labelItem;
     bool m_hovering;
     bool m_mousePressed;
     bool m_visualsDirty;
-    bool m_labelDirty;
 };
 
 QT_CHARTS_END_NAMESPACE
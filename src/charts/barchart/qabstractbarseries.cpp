@@ -585,8 +585,8 @@ bool QAbstractBarSeries::isLabelsVisible() const
 void QAbstractBarSeries::setLabelsFormat(const QString &format)
 {
     Q_D(QAbstractBarSeries);
-    if (d->m_labelsFormat != format) {
-        d->m_labelsFormat = format;
+    if (d->m_labelsFormat.format() != format) {
+        d->m_labelsFormat = LabelTemplate(format, QStringList() << QStringLiteral("@value"));
         d->setLabelsDirty(true);
         emit labelsFormatChanged(format);
     }
@@ -595,7 +595,7 @@ void QAbstractBarSeries::setLabelsFormat(const QString &format)
 QString QAbstractBarSeries::labelsFormat() const
 {
     Q_D(const QAbstractBarSeries);
-    return d->m_labelsFormat;
+    return d->m_labelsFormat.format();
 }
 
 void QAbstractBarSeries::setLabelsAngle(qreal angle)
@@ -641,7 +641,8 @@ QAbstractBarSeriesPrivate::QAbstractBarSeriesPrivate(QAbstractBarSeries *q) :
     m_labelsPosition(QAbstractBarSeries::LabelsCenter),
     m_labelsAngle(0),
     m_visualsDirty(true),
-    m_labelsDirty(true)
+    m_labelsDirty(true),
+    m_stacksValid(false)
 {
 }
 
@@ -695,12 +696,10 @@ qreal QAbstractBarSeriesPrivate::min()
     qreal min = INT_MAX;
 
     for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->at(j);
-            if (temp < min)
-                min = temp;
-        }
+        qreal setMin;
+        qreal setMax;
+        if (m_barSets.at(i)->d_ptr->valueRange(setMin, setMax) && setMin < min)
+            min = setMin;
     }
     return min;
 }
@@ -713,12 +712,10 @@ qreal QAbstractBarSeriesPrivate::max()
     qreal max = INT_MIN;
 
     for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->at(j);
-            if (temp > max)
-                max = temp;
-        }
+        qreal setMin;
+        qreal setMax;
+        if (m_barSets.at(i)->d_ptr->valueRange(setMin, setMax) && setMax > max)
+            max = setMax;
     }
 
     return max;
@@ -751,24 +748,14 @@ qreal QAbstractBarSeriesPrivate::percentageAt(int set, int category)
 
 qreal QAbstractBarSeriesPrivate::categorySum(int category)
 {
-    qreal sum(0);
-    int count = m_barSets.count(); // Count sets
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count())
-            sum += m_barSets.at(set)->at(category);
-    }
-    return sum;
+    const CategoryStack *stack = categoryStack(category);
+    return stack ? stack->sum : 0;
 }
 
 qreal QAbstractBarSeriesPrivate::absoluteCategorySum(int category)
 {
-    qreal sum(0);
-    int count = m_barSets.count(); // Count sets
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count())
-            sum += qAbs(m_barSets.at(set)->at(category));
-    }
-    return sum;
+    const CategoryStack *stack = categoryStack(category);
+    return stack ? stack->absolute : 0;
 }
 
 qreal QAbstractBarSeriesPrivate::maxCategorySum()
@@ -788,17 +775,8 @@ qreal QAbstractBarSeriesPrivate::minX()
     if (m_barSets.count() <= 0)
         return 0;
 
-    qreal min = INT_MAX;
-
-    for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->d_ptr.data()->m_values.at(j).x();
-            if (temp < min)
-                min = temp;
-        }
-    }
-    return min;
+    // Values are positioned at their index in the set
+    return categoryCount() > 0 ? 0 : INT_MAX;
 }
 
 qreal QAbstractBarSeriesPrivate::maxX()
@@ -806,52 +784,24 @@ qreal QAbstractBarSeriesPrivate::maxX()
     if (m_barSets.count() <= 0)
         return 0;
 
-    qreal max = INT_MIN;
-
-    for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->d_ptr.data()->m_values.at(j).x();
-            if (temp > max)
-                max = temp;
-        }
-    }
-
-    return max;
+    const int count = categoryCount();
+    return count > 0 ? count - 1 : INT_MIN;
 }
 
 qreal QAbstractBarSeriesPrivate::categoryTop(int category)
 {
     // Returns top (sum of all positive values) of category.
     // Returns 0, if all values are negative
-    qreal top(0);
-    int count = m_barSets.count();
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count()) {
-            qreal temp = m_barSets.at(set)->at(category);
-            if (temp > 0) {
-                top += temp;
-            }
-        }
-    }
-    return top;
+    const CategoryStack *stack = categoryStack(category);
+    return stack ? stack->top : 0;
 }
 
 qreal QAbstractBarSeriesPrivate::categoryBottom(int category)
 {
     // Returns bottom (sum of all negative values) of category
     // Returns 0, if all values are positive
-    qreal bottom(0);
-    int count = m_barSets.count();
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count()) {
-            qreal temp = m_barSets.at(set)->at(category);
-            if (temp < 0) {
-                bottom += temp;
-            }
-        }
-    }
-    return bottom;
+    const CategoryStack *stack = categoryStack(category);
+    return stack ? stack->bottom : 0;
 }
 
 qreal QAbstractBarSeriesPrivate::top()
@@ -880,6 +830,63 @@ qreal QAbstractBarSeriesPrivate::bottom()
     return bottom;
 }
 
+qreal QAbstractBarSeriesPrivate::stackOffset(int set, int category)
+{
+    // Returns the value where the bar of the set starts when stacked, i.e. the sum of the values
+    // of the previous sets that stack to the same side. Negative values stack to the negative side.
+    if ((set < 0) || (set >= m_barSets.count()) || !categoryStack(category))
+        return 0;
+    return m_stackOffsets.at(category * m_barSets.count() + set);
+}
+
+const QAbstractBarSeriesPrivate::CategoryStack *QAbstractBarSeriesPrivate::categoryStack(int category)
+{
+    const int setCount = m_barSets.count();
+    if (!m_stacksValid) {
+        const CategoryStack dirtyStack = { 0, 0, 0, 0, true };
+        m_categoryStacks.fill(dirtyStack, categoryCount());
+        m_stackOffsets.fill(0, m_categoryStacks.size() * setCount);
+        m_stacksValid = true;
+    }
+    if ((category < 0) || (category >= m_categoryStacks.size()))
+        return 0;
+
+    CategoryStack &stack = m_categoryStacks[category];
+    if (stack.dirty) {
+        stack.sum = 0;
+        stack.top = 0;
+        stack.bottom = 0;
+        stack.absolute = 0;
+        qreal *offsets = m_stackOffsets.data() + category * setCount;
+        for (int set = 0; set < setCount; set++) {
+            const QVector<qreal> &values = m_barSets.at(set)->d_ptr->m_values;
+            const qreal value = category < values.count() ? values.at(category) : 0;
+            if (value < 0) {
+                offsets[set] = stack.bottom;
+                stack.bottom += value;
+            } else {
+                offsets[set] = stack.top;
+                stack.top += value;
+            }
+            stack.sum += value;
+            stack.absolute += qAbs(value);
+        }
+        stack.dirty = false;
+    }
+    return &stack;
+}
+
+void QAbstractBarSeriesPrivate::invalidateStacks()
+{
+    m_stacksValid = false;
+}
+
+void QAbstractBarSeriesPrivate::invalidateStack(int category)
+{
+    if (category >= 0 && category < m_categoryStacks.size())
+        m_categoryStacks[category].dirty = true;
+}
+
 bool QAbstractBarSeriesPrivate::blockBarUpdate()
 {
     return m_blockBarUpdate;
@@ -910,16 +917,28 @@ void QAbstractBarSeriesPrivate::initializeDomain()
 
 QList<QLegendMarker*> QAbstractBarSeriesPrivate::createLegendMarkers(QLegend* legend)
 {
-    Q_Q(QAbstractBarSeries);
     QList<QLegendMarker*> markers;
 
-    foreach(QBarSet* set, q->barSets()) {
-        QBarLegendMarker* marker = new QBarLegendMarker(q,set,legend);
-        markers << marker;
-    }
+    foreach (QBarSet *set, m_barSets)
+        markers << createLegendMarker(set, legend);
     return markers;
 }
 
+QList<QObject *> QAbstractBarSeriesPrivate::legendMarkerObjects()
+{
+    QList<QObject *> objects;
+    objects.reserve(m_barSets.count());
+    foreach (QBarSet *set, m_barSets)
+        objects << set;
+    return objects;
+}
+
+QLegendMarker *QAbstractBarSeriesPrivate::createLegendMarker(QObject *object, QLegend *legend)
+{
+    Q_Q(QAbstractBarSeries);
+    return new QBarLegendMarker(q, static_cast<QBarSet *>(object), legend);
+}
+
 
 bool QAbstractBarSeriesPrivate::append(QBarSet *set)
 {
@@ -935,7 +954,10 @@ bool QAbstractBarSeriesPrivate::append(QBarSet *set)
                      this, &QAbstractBarSeriesPrivate::handleSetValueAdd);
     QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valueRemoved,
                      this, &QAbstractBarSeriesPrivate::handleSetValueRemove);
+    QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valuesReplaced,
+                     this, &QAbstractBarSeriesPrivate::handleSetValuesReplace);
 
+    invalidateStacks();
     emit restructuredBars(); // this notifies barchartitem
     return true;
 }
@@ -954,7 +976,10 @@ bool QAbstractBarSeriesPrivate::remove(QBarSet *set)
                         this, &QAbstractBarSeriesPrivate::handleSetValueAdd);
     QObject::disconnect(set->d_ptr.data(), &QBarSetPrivate::valueRemoved,
                         this, &QAbstractBarSeriesPrivate::handleSetValueRemove);
+    QObject::disconnect(set->d_ptr.data(), &QBarSetPrivate::valuesReplaced,
+                        this, &QAbstractBarSeriesPrivate::handleSetValuesReplace);
 
+    invalidateStacks();
     emit restructuredBars(); // this notifies barchartitem
     return true;
 }
@@ -978,8 +1003,11 @@ bool QAbstractBarSeriesPrivate::append(QList<QBarSet * > sets)
                          this, &QAbstractBarSeriesPrivate::handleSetValueAdd);
         QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valueRemoved,
                          this, &QAbstractBarSeriesPrivate::handleSetValueRemove);
+        QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valuesReplaced,
+                         this, &QAbstractBarSeriesPrivate::handleSetValuesReplace);
     }
 
+    invalidateStacks();
     emit restructuredBars(); // this notifies barchartitem
     return true;
 }
@@ -1006,8 +1034,11 @@ bool QAbstractBarSeriesPrivate::remove(QList<QBarSet * > sets)
                             this, &QAbstractBarSeriesPrivate::handleSetValueAdd);
         QObject::disconnect(set->d_ptr.data(), &QBarSetPrivate::valueRemoved,
                             this, &QAbstractBarSeriesPrivate::handleSetValueRemove);
+        QObject::disconnect(set->d_ptr.data(), &QBarSetPrivate::valuesReplaced,
+                            this, &QAbstractBarSeriesPrivate::handleSetValuesReplace);
     }
 
+    invalidateStacks();
     emit restructuredBars();        // this notifies barchartitem
 
     return true;
@@ -1027,7 +1058,10 @@ bool QAbstractBarSeriesPrivate::insert(int index, QBarSet *set)
                      this, &QAbstractBarSeriesPrivate::handleSetValueAdd);
     QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valueRemoved,
                      this, &QAbstractBarSeriesPrivate::handleSetValueRemove);
+    QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valuesReplaced,
+                     this, &QAbstractBarSeriesPrivate::handleSetValuesReplace);
 
+    invalidateStacks();
     emit restructuredBars();      // this notifies barchartitem
     return true;
 }
@@ -1095,6 +1129,7 @@ QAbstractAxis::AxisType QAbstractBarSeriesPrivate::defaultAxisType(Qt::Orientati
 
 void QAbstractBarSeriesPrivate::handleSetValueChange(int index)
 {
+    invalidateStack(index);
     QBarSetPrivate *priv = qobject_cast<QBarSetPrivate *>(sender());
     if (priv)
         emit setValueChanged(index, priv->q_ptr);
@@ -1102,6 +1137,7 @@ void QAbstractBarSeriesPrivate::handleSetValueChange(int index)
 
 void QAbstractBarSeriesPrivate::handleSetValueAdd(int index, int count)
 {
+    invalidateStacks();
     QBarSetPrivate *priv = qobject_cast<QBarSetPrivate *>(sender());
     if (priv)
         emit setValueAdded(index, count, priv->q_ptr);
@@ -1109,11 +1145,20 @@ void QAbstractBarSeriesPrivate::handleSetValueAdd(int index, int count)
 
 void QAbstractBarSeriesPrivate::handleSetValueRemove(int index, int count)
 {
+    invalidateStacks();
     QBarSetPrivate *priv = qobject_cast<QBarSetPrivate *>(sender());
     if (priv)
         emit setValueRemoved(index, count, priv->q_ptr);
 }
 
+void QAbstractBarSeriesPrivate::handleSetValuesReplace()
+{
+    invalidateStacks();
+    QBarSetPrivate *priv = qobject_cast<QBarSetPrivate *>(sender());
+    if (priv)
+        emit setValuesReplaced(priv->q_ptr);
+}
+
 void QAbstractBarSeriesPrivate::populateCategories(QBarCategoryAxis *axis)
 {
     QStringList categories;
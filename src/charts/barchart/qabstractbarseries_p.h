@@ -41,7 +41,9 @@
 
 #include <QtCharts/QAbstractBarSeries>
 #include <private/qabstractseries_p.h>
+#include <private/labelformatter_p.h>
 #include <QtCore/QStringList>
+#include <QtCore/QVector>
 #include <QtCharts/QAbstractSeries>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -69,6 +71,8 @@ public:
     void initializeTheme(int index, ChartTheme* theme, bool forced = false);
 
     QList<QLegendMarker*> createLegendMarkers(QLegend *legend);
+    QList<QObject *> legendMarkerObjects();
+    QLegendMarker *createLegendMarker(QObject *object, QLegend *legend);
 
     virtual QAbstractAxis::AxisType defaultAxisType(Qt::Orientation orientation) const;
     QAbstractAxis* createDefaultAxis(Qt::Orientation orientation) const;
@@ -93,6 +97,7 @@ public:
     qreal categoryBottom(int category);
     qreal top();
     qreal bottom();
+    qreal stackOffset(int set, int category);
 
     bool blockBarUpdate();
 
@@ -101,6 +106,7 @@ public:
     bool visualsDirty() const { return m_visualsDirty; }
     void setLabelsDirty(bool dirty) { m_labelsDirty = dirty; }
     bool labelsDirty() const { return m_labelsDirty; }
+    const LabelTemplate &labelsTemplate() const { return m_labelsFormat; }
 
 Q_SIGNALS:
     void clicked(int index, QBarSet *barset);
@@ -115,14 +121,29 @@ Q_SIGNALS:
     void setValueChanged(int index, QBarSet *barset);
     void setValueAdded(int index, int count, QBarSet *barset);
     void setValueRemoved(int index, int count, QBarSet *barset);
+    void setValuesReplaced(QBarSet *barset);
 
 private Q_SLOTS:
     void handleSetValueChange(int index);
     void handleSetValueAdd(int index, int count);
     void handleSetValueRemove(int index, int count);
+    void handleSetValuesReplace();
 
 private:
+    // Cached sums of each category over all sets. Stacks are recalculated lazily, one category
+    // at a time, when a value in that category changes.
+    struct CategoryStack {
+        qreal sum;
+        qreal top;
+        qreal bottom;
+        qreal absolute;
+        bool dirty;
+    };
+
     void populateCategories(QBarCategoryAxis *axis);
+    void invalidateStacks();
+    void invalidateStack(int category);
+    const CategoryStack *categoryStack(int category);
 
 protected:
     QList<QBarSet *> m_barSets;
@@ -130,12 +151,19 @@ protected:
     bool m_labelsVisible;
     bool m_visible;
     bool m_blockBarUpdate;
-    QString m_labelsFormat;
+    LabelTemplate m_labelsFormat;
     QAbstractBarSeries::LabelsPosition m_labelsPosition;
     qreal m_labelsAngle;
     bool m_visualsDirty;
     bool m_labelsDirty;
 
+private:
+    QVector<CategoryStack> m_categoryStacks;
+    // Value at which the bar of each set starts in its category stack, indexed by
+    // category * set count + set.
+    QVector<qreal> m_stackOffsets;
+    bool m_stacksValid;
+
 private:
     Q_DECLARE_PUBLIC(QAbstractBarSeries)
     friend class HorizontalBarChartItem;
@@ -33,6 +33,7 @@
 #include <QtCharts/QBarSet>
 #include <QtCharts/QChart>
 #include <QtCore/QAbstractItemModel>
+#include <private/qnumericcolumnaccess_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -46,6 +47,34 @@ QT_CHARTS_BEGIN_NAMESPACE
     as a data source for a chart.
 */
 
+/*!
+    \property QBarModelMapper::backgroundLoading
+    \brief Whether large models are read in the background.
+
+    When enabled, the initial read of a model that maps at least 10000 values, and the reread
+    after the model is reset, are done in a worker thread, so that the application stays
+    responsive. The series keeps its previous bar sets until all the values have been read. The
+    new bar sets are then created and appended to the series at once.
+
+    Only models that provide all the mapped sections with QNumericColumnAccess can be read in
+    the background, other models are always read at once through QAbstractItemModel::data().
+
+    When the model announces a change while it is being loaded, the mapper waits for the worker
+    thread, passes the bar sets to the series, and then applies the change. Changes to the series
+    restart the loading.
+
+    By default, background loading is disabled.
+
+    \sa isLoading(), loadingFinished()
+*/
+
+/*!
+    \fn void QBarModelMapper::loadingFinished()
+    This signal is emitted when the bar sets read in the background have been passed to the
+    series.
+    \sa backgroundLoading
+*/
+
 QBarModelMapper::QBarModelMapper(QObject *parent) :
     QObject(parent),
     d_ptr(new QBarModelMapperPrivate(this))
@@ -78,6 +107,13 @@ void QBarModelMapper::setModel(QAbstractItemModel *model)
     connect(d->m_model, SIGNAL(columnsInserted(QModelIndex,int,int)), d, SLOT(modelColumnsAdded(QModelIndex,int,int)));
     connect(d->m_model, SIGNAL(columnsRemoved(QModelIndex,int,int)), d, SLOT(modelColumnsRemoved(QModelIndex,int,int)));
     connect(d->m_model, SIGNAL(destroyed()), d, SLOT(handleModelDestroyed()));
+    // the values read in the background must not change under the loader
+    connect(d->m_model, SIGNAL(rowsAboutToBeInserted(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(rowsAboutToBeRemoved(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(columnsAboutToBeInserted(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(columnsAboutToBeRemoved(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(modelAboutToBeReset()), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(layoutAboutToBeChanged()), d, SLOT(waitForLoading()));
 }
 
 QAbstractBarSeries *QBarModelMapper::series() const
@@ -208,6 +244,28 @@ void QBarModelMapper::setLastBarSetSection(int lastBarSetSection)
     d->initializeBarFromModel();
 }
 
+bool QBarModelMapper::backgroundLoading() const
+{
+    Q_D(const QBarModelMapper);
+    return d->m_backgroundLoading;
+}
+
+void QBarModelMapper::setBackgroundLoading(bool enabled)
+{
+    Q_D(QBarModelMapper);
+    d->m_backgroundLoading = enabled;
+}
+
+/*!
+    Returns true if the values of the model are being read in the background.
+    \sa backgroundLoading
+*/
+bool QBarModelMapper::isLoading() const
+{
+    Q_D(const QBarModelMapper);
+    return d->isLoading();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QBarModelMapperPrivate::QBarModelMapperPrivate(QBarModelMapper *q) :
@@ -221,12 +279,23 @@ QBarModelMapperPrivate::QBarModelMapperPrivate(QBarModelMapper *q) :
     m_lastBarSetSection(-1),
     m_seriesSignalsBlock(false),
     m_modelSignalsBlock(false),
+    m_backgroundLoading(false),
+    m_loader(0),
     q_ptr(q)
 {
 }
 
+QBarModelMapperPrivate::~QBarModelMapperPrivate()
+{
+    stopLoading();
+}
+
 void QBarModelMapperPrivate::blockModelSignals(bool block)
 {
+    // The series is written to the model. The loading in progress would be overwritten by the
+    // reinitialization that follows, so it is cancelled before the model changes.
+    if (block)
+        stopLoading();
     m_modelSignalsBlock = block;
 }
 
@@ -267,6 +336,7 @@ QModelIndex QBarModelMapperPrivate::barModelIndex(int barSection, int posInBar)
 
 void QBarModelMapperPrivate::handleSeriesDestroyed()
 {
+    stopLoading();
     m_series = 0;
 }
 
@@ -281,6 +351,8 @@ void QBarModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex botto
     if (m_modelSignalsBlock)
         return;
 
+    waitForLoading();
+
     blockSeriesSignals();
     QModelIndex index;
     for (int row = topLeft.row(); row <= bottomRight.row(); row++) {
@@ -306,6 +378,8 @@ void QBarModelMapperPrivate::modelHeaderDataUpdated(Qt::Orientation orientation,
     if (m_modelSignalsBlock)
         return;
 
+    waitForLoading();
+
     blockSeriesSignals();
     if (orientation != m_orientation) {
         for (int section = first; section <= last; section++) {
@@ -377,9 +451,21 @@ void QBarModelMapperPrivate::modelColumnsRemoved(QModelIndex parent, int start,
 
 void QBarModelMapperPrivate::handleModelDestroyed()
 {
+    stopLoading();
     m_model = 0;
 }
 
+// The model is about to change the values the loader reads: the bar sets are passed to the
+// series before the change is applied
+void QBarModelMapperPrivate::waitForLoading()
+{
+    if (!m_loader)
+        return;
+
+    m_loader->wait();
+    handleLoadingFinished();
+}
+
 void QBarModelMapperPrivate::insertData(int start, int end)
 {
     Q_UNUSED(end)
@@ -540,11 +626,53 @@ void QBarModelMapperPrivate::barValueChanged(int index)
     initializeBarFromModel();
 }
 
+void QBarModelMapperPrivate::barValuesReplaced()
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    int barSetIndex = m_barSets.indexOf(qobject_cast<QBarSet *>(QObject::sender()));
+    QBarSet *barSet = m_barSets.at(barSetIndex);
+
+    // The mapped area is resized to the new values, like when values are added or removed.
+    // Rows (columns) are shared by all bar sets, so this resizes the other bar sets too.
+    const int sectionCount = m_orientation == Qt::Vertical ? m_model->rowCount() : m_model->columnCount();
+    int mappedCount = qMax(0, sectionCount - m_first);
+    if (m_count != -1)
+        mappedCount = qMin(mappedCount, m_count);
+    const int difference = barSet->count() - mappedCount;
+
+    blockModelSignals();
+    if (difference > 0) {
+        if (m_orientation == Qt::Vertical)
+            m_model->insertRows(mappedCount + m_first, difference);
+        else
+            m_model->insertColumns(mappedCount + m_first, difference);
+    } else if (difference < 0) {
+        if (m_orientation == Qt::Vertical)
+            m_model->removeRows(barSet->count() + m_first, -difference);
+        else
+            m_model->removeColumns(barSet->count() + m_first, -difference);
+    }
+    if (m_count != -1)
+        m_count += difference;
+
+    for (int i = 0; i < barSet->count(); i++)
+        m_model->setData(barModelIndex(barSetIndex + m_firstBarSetSection, i), barSet->at(i));
+    blockModelSignals(false);
+    initializeBarFromModel();
+}
+
 void QBarModelMapperPrivate::initializeBarFromModel()
 {
+    stopLoading();
+
     if (m_model == 0 || m_series == 0)
         return;
 
+    if (m_backgroundLoading && startLoading())
+        return;
+
     blockSeriesSignals();
     // clear current content
     m_series->clear();
@@ -556,16 +684,20 @@ void QBarModelMapperPrivate::initializeBarFromModel()
         QModelIndex barIndex = barModelIndex(i, posInBar);
         // check if there is such model index
         if (barIndex.isValid()) {
-            QBarSet *barSet = new QBarSet(m_model->headerData(i, m_orientation == Qt::Vertical ? Qt::Horizontal : Qt::Vertical).toString());
-            while (barIndex.isValid()) {
-                barSet->append(m_model->data(barIndex, Qt::DisplayRole).toDouble());
+            QVector<qreal> values;
+            NumericSection section(m_model, m_orientation, i);
+            if (section.isValid()) {
+                const int count = numericCount(section);
+                values.reserve(count);
+                for (; posInBar < count; posInBar++)
+                    values.append(section.at(posInBar + m_first));
+            }
+            while (!section.isValid() && barIndex.isValid()) {
+                values.append(m_model->data(barIndex, Qt::DisplayRole).toDouble());
                 posInBar++;
                 barIndex = barModelIndex(i, posInBar);
             }
-            connect(barSet, SIGNAL(valuesAdded(int,int)), this, SLOT(valuesAdded(int,int)));
-            connect(barSet, SIGNAL(valuesRemoved(int,int)), this, SLOT(valuesRemoved(int,int)));
-            connect(barSet, SIGNAL(valueChanged(int)), this, SLOT(barValueChanged(int)));
-            connect(barSet, SIGNAL(labelChanged()), this, SLOT(barLabelChanged()));
+            QBarSet *barSet = createBarSet(i, values);
             m_series->append(barSet);
             m_barSets.append(barSet);
         } else {
@@ -575,6 +707,87 @@ void QBarModelMapperPrivate::initializeBarFromModel()
     blockSeriesSignals(false);
 }
 
+QBarSet *QBarModelMapperPrivate::createBarSet(int section, const QVector<qreal> &values)
+{
+    QBarSet *barSet = new QBarSet(m_model->headerData(section, m_orientation == Qt::Vertical ? Qt::Horizontal : Qt::Vertical).toString());
+    barSet->replace(values);
+    connect(barSet, SIGNAL(valuesAdded(int,int)), this, SLOT(valuesAdded(int,int)));
+    connect(barSet, SIGNAL(valuesRemoved(int,int)), this, SLOT(valuesRemoved(int,int)));
+    connect(barSet, SIGNAL(valueChanged(int)), this, SLOT(barValueChanged(int)));
+    connect(barSet, SIGNAL(valuesReplaced()), this, SLOT(barValuesReplaced()));
+    connect(barSet, SIGNAL(labelChanged()), this, SLOT(barLabelChanged()));
+    return barSet;
+}
+
+// Returns the number of mapped values a numeric section provides
+int QBarModelMapperPrivate::numericCount(const NumericSection &section) const
+{
+    const int sectionCount = m_orientation == Qt::Vertical ? m_model->rowCount() : m_model->columnCount();
+    int count = qMin(section.count(), sectionCount) - m_first;
+    if (m_count != -1)
+        count = qMin(count, m_count);
+    return qMax(count, 0);
+}
+
+// Starts reading the bar sets in a worker thread. Returns false if the model is read at once,
+// because it is small or does not provide numeric access to all the mapped sections.
+bool QBarModelMapperPrivate::startLoading()
+{
+    ModelLoader *loader = new ModelLoader(this);
+    for (int i = m_firstBarSetSection; i <= m_lastBarSetSection; i++) {
+        if (!barModelIndex(i, 0).isValid())
+            break;
+        NumericSection section(m_model, m_orientation, i);
+        if (!section.isValid()) {
+            delete loader;
+            return false;
+        }
+        loader->addSection(section, m_first, numericCount(section));
+    }
+
+    if (loader->valueCount() < backgroundLoadingThreshold) {
+        delete loader;
+        return false;
+    }
+
+    m_loader = loader;
+    connect(m_loader, SIGNAL(finished()), this, SLOT(handleLoadingFinished()));
+    m_loader->start();
+    return true;
+}
+
+// Cancels the loading in progress. Returns true if the model was being loaded.
+bool QBarModelMapperPrivate::stopLoading()
+{
+    if (!m_loader)
+        return false;
+
+    delete m_loader;
+    m_loader = 0;
+    return true;
+}
+
+void QBarModelMapperPrivate::handleLoadingFinished()
+{
+    // The finished() signal of a loader already handled by waitForLoading() is ignored
+    if (!m_loader || !m_loader->isFinished())
+        return;
+
+    QList<QBarSet *> barSets;
+    for (int i = 0; i < m_loader->sectionCount(); i++)
+        barSets.append(createBarSet(m_firstBarSetSection + i, m_loader->values(i)));
+    stopLoading();
+
+    blockSeriesSignals();
+    m_series->clear();
+    m_series->append(barSets);
+    m_barSets = barSets;
+    blockSeriesSignals(false);
+
+    Q_Q(QBarModelMapper);
+    emit q->loadingFinished();
+}
+
 #include "moc_qbarmodelmapper.cpp"
 #include "moc_qbarmodelmapper_p.cpp"
 
@@ -41,6 +41,7 @@
 
 #include <QtCore/QObject>
 #include <QtCharts/QBarModelMapper>
+#include <private/modelloader_p.h>
 
 QT_BEGIN_NAMESPACE
 class QModelIndex;
@@ -55,6 +56,9 @@ class QBarModelMapperPrivate : public QObject
     Q_OBJECT
 public:
     explicit QBarModelMapperPrivate(QBarModelMapper *q);
+    ~QBarModelMapperPrivate();
+
+    bool isLoading() const { return m_loader != 0; }
 
 public Q_SLOTS:
     // for the model
@@ -65,6 +69,7 @@ public Q_SLOTS:
     void modelColumnsAdded(QModelIndex parent, int start, int end);
     void modelColumnsRemoved(QModelIndex parent, int start, int end);
     void handleModelDestroyed();
+    void waitForLoading();
 
     // for the series
     void barSetsAdded(QList<QBarSet *> sets);
@@ -73,9 +78,11 @@ public Q_SLOTS:
     void valuesRemoved(int index, int count);
     void barLabelChanged();
     void barValueChanged(int index);
+    void barValuesReplaced();
     void handleSeriesDestroyed();
 
     void initializeBarFromModel();
+    void handleLoadingFinished();
 
 private:
     QBarSet *barSet(QModelIndex index);
@@ -84,6 +91,10 @@ private:
     void removeData(int start, int end);
     void blockModelSignals(bool block = true);
     void blockSeriesSignals(bool block = true);
+    QBarSet *createBarSet(int section, const QVector<qreal> &values);
+    int numericCount(const NumericSection &section) const;
+    bool startLoading();
+    bool stopLoading();
 
 private:
     QAbstractBarSeries *m_series;
@@ -96,6 +107,8 @@ private:
     int m_lastBarSetSection;
     bool m_seriesSignalsBlock;
     bool m_modelSignalsBlock;
+    bool m_backgroundLoading;
+    ModelLoader *m_loader;
 
 private:
     QBarModelMapper *q_ptr;
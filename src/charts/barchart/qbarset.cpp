@@ -256,6 +256,12 @@ QT_CHARTS_BEGIN_NAMESPACE
     This signal is emitted when the value at the position specified by \a index is modified.
     \sa at()
 */
+
+/*!
+    \fn void QBarSet::valuesReplaced()
+    This signal is emitted when all values of the bar set are replaced with other values.
+    \sa replace()
+*/
 /*!
     \qmlsignal BarSet::valueChanged(int index)
     This signal is emitted when the value at the position specified by \a index is modified.
@@ -332,9 +338,8 @@ QString QBarSet::label() const
 */
 void QBarSet::append(const qreal value)
 {
-    // Convert to QPointF
     int index = d_ptr->m_values.count();
-    d_ptr->append(QPointF(d_ptr->m_values.count(), value));
+    d_ptr->append(value);
     emit valuesAdded(index, 1);
 }
 
@@ -412,6 +417,32 @@ void QBarSet::replace(const int index, const qreal value)
     }
 }
 
+/*!
+    Replaces the current values of the bar set with the values specified by \a values.
+    \note This is much faster than replacing values one by one, or first removing all values
+    and then appending the new ones. Emits QBarSet::valuesReplaced() when the values have been
+    replaced. However, note that using the overload that takes \c{QVector<qreal>} as parameter
+    is faster than using this overload.
+    \sa valuesReplaced()
+*/
+void QBarSet::replace(const QList<qreal> &values)
+{
+    replace(values.toVector());
+}
+
+/*!
+    Replaces the current values of the bar set with the values specified by \a values.
+    \note This is much faster than replacing values one by one, or first removing all values
+    and then appending the new ones. Emits QBarSet::valuesReplaced() when the values have been
+    replaced.
+    \sa valuesReplaced()
+*/
+void QBarSet::replace(const QVector<qreal> &values)
+{
+    d_ptr->replace(values);
+    emit valuesReplaced();
+}
+
 /*!
     \qmlmethod BarSet::at(int index)
     Returns the value specified by \a index from the bar set.
@@ -426,7 +457,7 @@ qreal QBarSet::at(const int index) const
 {
     if (index < 0 || index >= d_ptr->m_values.count())
         return 0;
-    return d_ptr->m_values.at(index).y();
+    return d_ptr->m_values.at(index);
 }
 
 /*!
@@ -452,8 +483,10 @@ int QBarSet::count() const
 qreal QBarSet::sum() const
 {
     qreal total(0);
-    for (int i = 0; i < d_ptr->m_values.count(); i++)
-        total += d_ptr->m_values.at(i).y();
+    const qreal *values = d_ptr->m_values.constData();
+    const int count = d_ptr->m_values.count();
+    for (int i = 0; i < count; i++)
+        total += values[i];
     return total;
 }
 
@@ -639,7 +672,7 @@ QBarSetPrivate::~QBarSetPrivate()
 {
 }
 
-void QBarSetPrivate::append(QPointF value)
+void QBarSetPrivate::append(const qreal value)
 {
     if (isValidValue(value)) {
         m_values.append(value);
@@ -647,9 +680,10 @@ void QBarSetPrivate::append(QPointF value)
     }
 }
 
-void QBarSetPrivate::append(QList<QPointF> values)
+void QBarSetPrivate::append(const QList<qreal> &values)
 {
     int originalIndex = m_values.count();
+    m_values.reserve(originalIndex + values.count());
     for (int i = 0; i < values.count(); i++) {
         if (isValidValue(values.at(i)))
             m_values.append(values.at(i));
@@ -657,26 +691,7 @@ void QBarSetPrivate::append(QList<QPointF> values)
     emit valueAdded(originalIndex, values.size());
 }
 
-void QBarSetPrivate::append(QList<qreal> values)
-{
-    int originalIndex = m_values.count();
-    int index = originalIndex;
-    for (int i = 0; i < values.count(); i++) {
-        if (isValidValue(values.at(i))) {
-            m_values.append(QPointF(index, values.at(i)));
-            index++;
-        }
-    }
-    emit valueAdded(originalIndex, values.size());
-}
-
 void QBarSetPrivate::insert(const int index, const qreal value)
-{
-    m_values.insert(index, QPointF(index, value));
-    emit valueAdded(index, 1);
-}
-
-void QBarSetPrivate::insert(const int index, const QPointF value)
 {
     m_values.insert(index, value);
     emit valueAdded(index, 1);
@@ -691,33 +706,52 @@ int QBarSetPrivate::remove(const int index, const int count)
     else if ((index + count) > m_values.count())
         removeCount = m_values.count() - index; // Trying to remove more items than list has. Limit amount to be removed.
 
-    int c = 0;
-    while (c < removeCount) {
-        m_values.removeAt(index);
-        c++;
-    }
+    m_values.remove(index, removeCount);
     emit valueRemoved(index, removeCount);
     return removeCount;
 }
 
 void QBarSetPrivate::replace(const int index, const qreal value)
 {
-    m_values.replace(index, QPointF(index, value));
+    m_values.replace(index, value);
     emit valueChanged(index);
 }
 
-qreal QBarSetPrivate::pos(const int index)
+void QBarSetPrivate::replace(const QVector<qreal> &values)
 {
-    if (index < 0 || index >= m_values.count())
-        return 0;
-    return m_values.at(index).x();
+    // Shares the data with the caller unless there are invalid values to drop
+    m_values = values;
+    for (int i = m_values.count() - 1; i >= 0; i--) {
+        if (!isValidValue(m_values.at(i)))
+            m_values.remove(i);
+    }
+    emit valuesReplaced();
 }
 
 qreal QBarSetPrivate::value(const int index)
 {
     if (index < 0 || index >= m_values.count())
         return 0;
-    return m_values.at(index).y();
+    return m_values.at(index);
+}
+
+bool QBarSetPrivate::valueRange(qreal &min, qreal &max) const
+{
+    // Scans the contiguous value array once. Returns false, if the set has no values.
+    const int count = m_values.count();
+    if (count == 0)
+        return false;
+
+    const qreal *values = m_values.constData();
+    min = values[0];
+    max = values[0];
+    for (int i = 1; i < count; i++) {
+        if (values[i] < min)
+            min = values[i];
+        else if (values[i] > max)
+            max = values[i];
+    }
+    return true;
 }
 
 #include "moc_qbarset.cpp"
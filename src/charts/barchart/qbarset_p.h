@@ -41,6 +41,7 @@
 
 #include <QtCharts/QBarSet>
 #include <QtCore/QMap>
+#include <QtCore/QVector>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
 #include <QtGui/QFont>
@@ -55,18 +56,17 @@ public:
     QBarSetPrivate(const QString label, QBarSet *parent);
     ~QBarSetPrivate();
 
-    void append(QPointF value);
-    void append(QList<QPointF> values);
-    void append(QList<qreal> values);
+    void append(const qreal value);
+    void append(const QList<qreal> &values);
 
     void insert(const int index, const qreal value);
-    void insert(const int index, const QPointF value);
     int remove(const int index, const int count);
 
     void replace(const int index, const qreal value);
+    void replace(const QVector<qreal> &values);
 
-    qreal pos(const int index);
     qreal value(const int index);
+    bool valueRange(qreal &min, qreal &max) const;
 
     void setVisualsDirty(bool dirty) { m_visualsDirty = dirty; }
     bool visualsDirty() const { return m_visualsDirty; }
@@ -78,11 +78,12 @@ Q_SIGNALS:
     void valueChanged(int index);
     void valueAdded(int index, int count);
     void valueRemoved(int index, int count);
+    void valuesReplaced();
 
 public:
     QBarSet * const q_ptr;
     QString m_label;
-    QList<QPointF> m_values;
+    QVector<qreal> m_values;
     QPen m_pen;
     QBrush m_brush;
     QBrush m_labelBrush;
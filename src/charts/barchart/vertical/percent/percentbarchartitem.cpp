@@ -28,7 +28,6 @@
 ****************************************************************************/
 
 #include <private/percentbarchartitem_p.h>
-#include <private/bar_p.h>
 #include <private/qabstractbarseries_p.h>
 #include <QtCharts/QBarSet>
 #include <private/qbarset_p.h>
@@ -48,16 +47,15 @@ QString PercentBarChartItem::generateLabelText(int set, int category, qreal valu
 {
     Q_UNUSED(value)
 
-    static const QString valueTag(QLatin1String("@value"));
+    const LabelTemplate &labelsTemplate = m_series->d_func()->labelsTemplate();
     qreal p = m_series->d_func()->percentageAt(set, category) * 100.0;
     QString vString(presenter()->numberToString(p, 'f', 0));
     QString valueLabel;
-    if (m_series->labelsFormat().isEmpty()) {
+    if (labelsTemplate.isEmpty()) {
         vString.append(QStringLiteral("%"));
         valueLabel = vString;
     } else {
-        valueLabel = m_series->labelsFormat();
-        valueLabel.replace(valueTag, vString);
+        valueLabel = labelsTemplate.expand(vString);
     }
 
     return valueLabel;
@@ -72,9 +70,7 @@ void PercentBarChartItem::initializeLayout(int set, int category,
     QRectF rect;
 
     if (set > 0) {
-        QBarSet *barSet = m_series->barSets().at(set - 1);
-        Bar *bar = m_indexForBarMap.value(barSet).value(category);
-        rect = m_layout.at(bar->layoutIndex());
+        rect = m_layout.at(barLayoutIndex(set - 1, category));
         rect.setBottom(rect.top());
     } else {
         QPointF topLeft;
@@ -134,10 +130,8 @@ QVector<QRectF> PercentBarChartItem::calculateLayout()
 
     for (int set = 0; set < setCount; set++) {
         QBarSet *barSet = m_series->barSets().at(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < m_categoryCount; i++) {
-            Bar *bar = bars.at(i);
-            const int category = bar->index();
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const int layoutIndex = barLayoutIndex(set, category);
             qreal &sum = tempSums[category - m_firstCategory];
             const qreal &categorySum = categorySums.at(category - m_firstCategory);
             qreal value = barSet->at(category);
@@ -163,7 +157,7 @@ QVector<QRectF> PercentBarChartItem::calculateLayout()
 
             rect.setTopLeft(topLeft);
             rect.setBottomRight(bottomRight);
-            layout[bar->layoutIndex()] = rect.normalized();
+            layout[layoutIndex] = rect.normalized();
             sum = newSum;
         }
     }
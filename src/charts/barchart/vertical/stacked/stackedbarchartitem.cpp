@@ -28,7 +28,6 @@
 ****************************************************************************/
 
 #include <private/stackedbarchartitem_p.h>
-#include <private/bar_p.h>
 #include <private/qbarset_p.h>
 #include <private/qabstractbarseries_p.h>
 #include <QtCharts/QBarSet>
@@ -47,56 +46,27 @@ StackedBarChartItem::StackedBarChartItem(QAbstractBarSeries *series, QGraphicsIt
 void StackedBarChartItem::initializeLayout(int set, int category,
                                            int layoutIndex, bool resetAnimation)
 {
-    Q_UNUSED(set)
     Q_UNUSED(resetAnimation)
 
     QRectF rect;
-
-    if (set > 0) {
-        const QBarSet *barSet = m_series->barSets().at(set);
-        const qreal value = barSet->at(category);
-        int checkIndex = set;
-        bool found = false;
-        // Negative values stack to negative side and positive values to positive side, so we need
-        // to find the previous set that stacks to the same side
-        while (checkIndex > 0 && !found) {
-            checkIndex--;
-            QBarSet *checkSet = m_series->barSets().at(checkIndex);
-            const qreal checkValue = checkSet->at(category);
-            if (value < 0.0 == checkValue < 0.0) {
-                Bar *checkBar = m_indexForBarMap.value(checkSet).value(category);
-                rect = m_layout.at(checkBar->layoutIndex());
-                found = true;
-                break;
-            }
-        }
-        // If we didn't find a previous set to the same direction, just stack next to the first set
-        if (!found) {
-            QBarSet *firsSet = m_series->barSets().at(0);
-            Bar *firstBar = m_indexForBarMap.value(firsSet).value(category);
-            rect = m_layout.at(firstBar->layoutIndex());
-        }
-        if (value < 0)
-            rect.setTop(rect.bottom());
-        else
-            rect.setBottom(rect.top());
+    QPointF topLeft;
+    QPointF bottomRight;
+    const qreal barWidth = m_series->d_func()->barWidth() * m_seriesWidth;
+    // Bars grow from the end of the stack of the previous sets that stack to the same side
+    const qreal offset = m_series->d_func()->stackOffset(set, category);
+    if (offset == 0.0
+            && (domain()->type() == AbstractDomain::XLogYDomain
+                || domain()->type() == AbstractDomain::LogXLogYDomain)) {
+        topLeft = topLeftPoint(category, barWidth, domain()->minY());
+        bottomRight = bottomRightPoint(category, barWidth, domain()->minY());
     } else {
-        QPointF topLeft;
-        QPointF bottomRight;
-        const qreal barWidth = m_series->d_func()->barWidth() * m_seriesWidth;
-        if (domain()->type() == AbstractDomain::XLogYDomain
-                || domain()->type() == AbstractDomain::LogXLogYDomain) {
-            topLeft = topLeftPoint(category, barWidth, domain()->minY());
-            bottomRight = bottomRightPoint(category, barWidth, domain()->minY());
-        } else {
-            topLeft = topLeftPoint(category, barWidth, 0.0);
-            bottomRight = bottomRightPoint(category, barWidth, 0.0);
-        }
+        topLeft = topLeftPoint(category, barWidth, offset);
+        bottomRight = bottomRightPoint(category, barWidth, offset);
+    }
 
-        if (m_validData) {
-            rect.setTopLeft(topLeft);
-            rect.setBottomRight(bottomRight);
-        }
+    if (m_validData) {
+        rect.setTopLeft(topLeft);
+        rect.setBottomRight(bottomRight);
     }
     m_layout[layoutIndex] = rect.normalized();
 }
@@ -126,10 +96,8 @@ QVector<QRectF> StackedBarChartItem::calculateLayout()
 
     for (int set = 0; set < setCount; set++) {
         QBarSet *barSet = m_series->barSets().at(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < m_categoryCount; i++) {
-            Bar *bar = bars.at(i);
-            const int category = bar->index();
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const int layoutIndex = barLayoutIndex(set, category);
             qreal &positiveSum = positiveSums[category - m_firstCategory];
             qreal &negativeSum = negativeSums[category - m_firstCategory];
             qreal value = barSet->at(category);
@@ -161,17 +129,17 @@ QVector<QRectF> StackedBarChartItem::calculateLayout()
             rect.setTopLeft(topLeft);
             rect.setBottomRight(bottomRight);
             rect = rect.normalized();
-            layout[bar->layoutIndex()] = rect;
+            layout[layoutIndex] = rect;
 
             // If animating, we need to reinitialize ~zero size bars with non-zero values
             // so the bar growth animation starts at correct spot. We shouldn't reset if rect
             // is already at correct position vertically, so we check for that.
             if (m_animation && value != 0.0) {
-                const QRectF &checkRect = m_layout.at(bar->layoutIndex());
+                const QRectF &checkRect = m_layout.at(layoutIndex);
                 if (checkRect.isEmpty() &&
                         (value < 0.0 && !qFuzzyCompare(checkRect.top(), rect.top())
                          || value > 0.0 && !qFuzzyCompare(checkRect.bottom(), rect.bottom()))) {
-                    initializeLayout(set, category, bar->layoutIndex(), true);
+                    initializeLayout(set, category, layoutIndex, true);
                 }
             }
         }
@@ -34,15 +34,23 @@
 #include <private/qabstractbarseries_p.h>
 #include <QtCharts/QBoxSet>
 #include <private/boxwhiskers_p.h>
+#include <QtCore/QtMath>
 #include <QtGui/QPainter>
+#include <QtWidgets/QGraphicsSceneMouseEvent>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
 BoxPlotChartItem::BoxPlotChartItem(QBoxPlotSeries *series, QGraphicsItem *item) :
     ChartItem(series->d_func(), item),
     m_series(series),
-    m_animation(0)
+    m_animation(0),
+    m_hoveredIndex(-1),
+    m_pressedIndex(-1)
 {
+    // Only the boxes of rows are part of the shape, see shape()
+    setAcceptHoverEvents(true);
+    setAcceptedMouseButtons(Qt::MouseButtonMask);
+
     connect(series, SIGNAL(boxsetsRemoved(QList<QBoxSet *>)), this, SLOT(handleBoxsetRemove(QList<QBoxSet *>)));
     connect(series->d_func(), SIGNAL(restructuredBoxes()), this, SLOT(handleDataStructureChanged()));
     connect(series->d_func(), SIGNAL(updatedLayout()), this, SLOT(handleLayoutChanged()));
@@ -56,11 +64,51 @@ BoxPlotChartItem::~BoxPlotChartItem()
 {
 }
 
+// Rows have no box-and-whiskers items, so this item paints the visible ones the way the items
+// would, with the pen and brush of the series
 void BoxPlotChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    Q_UNUSED(painter);
     Q_UNUSED(option);
     Q_UNUSED(widget);
+
+    int first;
+    int last;
+    visibleRows(first, last);
+    if (first > last)
+        return;
+
+    const QPen pen = m_series->pen();
+    QPen medianPen = pen;
+    medianPen.setCapStyle(Qt::FlatCap);
+    QPen outlinePen = pen;
+    outlinePen.setStyle(Qt::SolidLine);
+    outlinePen.setColor(m_series->brush().color());
+    const qreal halfLine = pen.widthF() / 2.0;
+
+    painter->save();
+    painter->setClipRect(m_boundingRect);
+    painter->setBrush(m_series->brush());
+    for (int i = first; i <= last; i++) {
+        QRectF box;
+        qreal upperExtreme;
+        qreal lowerExtreme;
+        qreal median;
+        if (!rowGeometry(i, box, upperExtreme, lowerExtreme, median))
+            continue;
+
+        const qreal center = box.center().x();
+        painter->setPen(pen);
+        painter->drawLine(QLineF(box.left(), upperExtreme, box.right(), upperExtreme));
+        painter->drawLine(QLineF(center, upperExtreme, center, box.top()));
+        painter->drawLine(QLineF(box.left(), lowerExtreme, box.right(), lowerExtreme));
+        painter->drawLine(QLineF(center, box.bottom(), center, lowerExtreme));
+        if (!m_series->boxOutlineVisible())
+            painter->setPen(outlinePen);
+        painter->drawRect(box);
+        painter->setPen(medianPen);
+        painter->drawLine(QLineF(box.left() - halfLine, median, box.right() + halfLine, median));
+    }
+    painter->restore();
 }
 
 void BoxPlotChartItem::setAnimation(BoxPlotAnimation *animation)
@@ -75,7 +123,7 @@ void BoxPlotChartItem::setAnimation(BoxPlotAnimation *animation)
 
 void BoxPlotChartItem::handleDataStructureChanged()
 {
-    int setCount = m_series->count();
+    int setCount = m_series->d_func()->m_boxSets.count();
 
     for (int s = 0; s < setCount; s++) {
         QBoxSet *set = m_series->d_func()->boxSetAt(s);
@@ -96,6 +144,13 @@ void BoxPlotChartItem::handleDataStructureChanged()
             connect(box, SIGNAL(pressed(QBoxSet *)), set, SIGNAL(pressed()));
             connect(box, SIGNAL(released(QBoxSet *)), set, SIGNAL(released()));
             connect(box, SIGNAL(doubleClicked(QBoxSet *)), set, SIGNAL(doubleClicked()));
+            connect(box, SIGNAL(clicked(QBoxSet *)), this, SLOT(handleBoxClicked(QBoxSet *)));
+            connect(box, SIGNAL(hovered(bool, QBoxSet *)),
+                    this, SLOT(handleBoxHovered(bool, QBoxSet *)));
+            connect(box, SIGNAL(pressed(QBoxSet *)), this, SLOT(handleBoxPressed(QBoxSet *)));
+            connect(box, SIGNAL(released(QBoxSet *)), this, SLOT(handleBoxReleased(QBoxSet *)));
+            connect(box, SIGNAL(doubleClicked(QBoxSet *)),
+                    this, SLOT(handleBoxDoubleClicked(QBoxSet *)));
 
             // Set the decorative issues for the newly created box
             // so that the brush and pen already defined for the set are kept.
@@ -118,6 +173,12 @@ void BoxPlotChartItem::handleDataStructureChanged()
             m_animation->addBox(box);
     }
 
+    // End the hover and press of a row, which may no longer exist
+    if (m_hoveredIndex != -1)
+        emit m_series->boxHovered(false, m_hoveredIndex);
+    m_hoveredIndex = -1;
+    m_pressedIndex = -1;
+
     handleDomainUpdated();
 }
 
@@ -136,6 +197,7 @@ void BoxPlotChartItem::handleUpdatedBars()
         if (set->pen().style() != Qt::NoPen)
             m_boxTable.value(set)->setPen(set->pen());
     }
+    update();
 }
 
 void BoxPlotChartItem::handleBoxsetRemove(QList<QBoxSet*> barSets)
@@ -155,6 +217,7 @@ void BoxPlotChartItem::handleDomainUpdated()
     // Set my bounding rect to same as domain size. Add one pixel at the top (-1.0) and the bottom as 0.0 would
     // snip a bit off from the whisker at the grid line
     m_boundingRect.setRect(0.0, -1.0, domain()->size().width(), domain()->size().height() + 1.0);
+    update();
 
     foreach (BoxWhiskers *item, m_boxTable.values()) {
         item->updateGeometry(domain());
@@ -179,6 +242,7 @@ void BoxPlotChartItem::handleLayoutChanged()
         else
             item->updateGeometry(domain());
     }
+    update();
 }
 
 QRectF BoxPlotChartItem::boundingRect() const
@@ -186,6 +250,186 @@ QRectF BoxPlotChartItem::boundingRect() const
     return m_boundingRect;
 }
 
+// The item itself only reacts to the mouse on the boxes of rows, as sets have their own
+// box-and-whiskers items
+QPainterPath BoxPlotChartItem::shape() const
+{
+    QPainterPath path;
+    int first;
+    int last;
+    visibleRows(first, last);
+    for (int i = first; i <= last; i++) {
+        QRectF box;
+        qreal upperExtreme;
+        qreal lowerExtreme;
+        qreal median;
+        if (rowGeometry(i, box, upperExtreme, lowerExtreme, median))
+            path.addRect(QRectF(box.left(), upperExtreme, box.width(), lowerExtreme - upperExtreme));
+    }
+    return path;
+}
+
+// Returns the range of series indexes of the rows within the visible range
+void BoxPlotChartItem::visibleRows(int &first, int &last) const
+{
+    const QBoxPlotSeriesPrivate *series = m_series->d_func();
+    first = qMax(series->m_boxSets.count(), qFloor(domain()->minX()));
+    last = qMin(series->m_boxSets.count() + series->m_rows.count() - 1, qCeil(domain()->maxX()));
+}
+
+// Calculates the geometry of the box of a row like BoxWhiskers::updateGeometry() does
+bool BoxPlotChartItem::rowGeometry(int index, QRectF &box, qreal &upperExtreme,
+                                   qreal &lowerExtreme, qreal &median) const
+{
+    const QBoxPlotSeriesPrivate *series = m_series->d_func();
+    const qreal *values = series->m_rows.at(index - series->m_boxSets.count()).values;
+
+    const qreal columnWidth = 1.0 / qMax(m_seriesCount, 1);
+    const qreal left = ((1.0 - series->m_boxWidth) / 2.0) * columnWidth
+            + columnWidth * m_seriesIndex + index - 0.5;
+    const qreal boxWidth = series->m_boxWidth * columnWidth;
+
+    bool validData;
+    QPointF geometryPoint = domain()->calculateGeometryPoint(
+                QPointF(left, values[QBoxSet::UpperExtreme]), validData);
+    if (!validData)
+        return false;
+    const qreal geometryLeft = geometryPoint.x();
+    upperExtreme = geometryPoint.y();
+    geometryPoint = domain()->calculateGeometryPoint(
+                QPointF(left + boxWidth, values[QBoxSet::UpperQuartile]), validData);
+    if (!validData)
+        return false;
+    const qreal geometryRight = geometryPoint.x();
+    const qreal upperQuartile = geometryPoint.y();
+    const qreal lowerQuartile = domain()->calculateGeometryPoint(
+                QPointF(left, values[QBoxSet::LowerQuartile]), validData).y();
+    if (!validData)
+        return false;
+    lowerExtreme = domain()->calculateGeometryPoint(
+                QPointF(left, values[QBoxSet::LowerExtreme]), validData).y();
+    if (!validData)
+        return false;
+    median = domain()->calculateGeometryPoint(
+                QPointF(left, values[QBoxSet::Median]), validData).y();
+    if (!validData)
+        return false;
+
+    box.setCoords(geometryLeft, upperQuartile, geometryRight, lowerQuartile);
+    return true;
+}
+
+// Returns the series index of the row whose box is at pos, or -1
+int BoxPlotChartItem::rowAt(const QPointF &pos) const
+{
+    // Boxes stay within the category of their index
+    const int index = qFloor(domain()->calculateDomainPoint(pos).x() + 0.5);
+    const QBoxPlotSeriesPrivate *series = m_series->d_func();
+    if (index < series->m_boxSets.count()
+        || index >= series->m_boxSets.count() + series->m_rows.count()) {
+        return -1;
+    }
+
+    QRectF box;
+    qreal upperExtreme;
+    qreal lowerExtreme;
+    qreal median;
+    if (rowGeometry(index, box, upperExtreme, lowerExtreme, median)
+        && QRectF(box.left(), upperExtreme, box.width(), lowerExtreme - upperExtreme).contains(pos)) {
+        return index;
+    }
+    return -1;
+}
+
+void BoxPlotChartItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
+{
+    hoverMoveEvent(event);
+}
+
+void BoxPlotChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    const int index = rowAt(event->pos());
+    if (index == m_hoveredIndex)
+        return;
+
+    if (m_hoveredIndex != -1)
+        emit m_series->boxHovered(false, m_hoveredIndex);
+    m_hoveredIndex = index;
+    if (m_hoveredIndex != -1)
+        emit m_series->boxHovered(true, m_hoveredIndex);
+}
+
+void BoxPlotChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    Q_UNUSED(event)
+
+    if (m_hoveredIndex != -1)
+        emit m_series->boxHovered(false, m_hoveredIndex);
+    m_hoveredIndex = -1;
+}
+
+void BoxPlotChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    m_pressedIndex = rowAt(event->pos());
+    if (m_pressedIndex == -1) {
+        event->ignore();
+        return;
+    }
+
+    emit m_series->boxPressed(m_pressedIndex);
+}
+
+void BoxPlotChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
+{
+    Q_UNUSED(event)
+
+    if (m_pressedIndex == -1)
+        return;
+
+    emit m_series->boxReleased(m_pressedIndex);
+    emit m_series->boxClicked(m_pressedIndex);
+    m_pressedIndex = -1;
+}
+
+void BoxPlotChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = rowAt(event->pos());
+    if (index == -1) {
+        event->ignore();
+        return;
+    }
+
+    // As for box-and-whiskers items, a press signal needs to be explicitly fired for double-clicks
+    emit m_series->boxPressed(index);
+    emit m_series->boxDoubleClicked(index);
+}
+
+// Box-and-whiskers items report their sets, the index based signals of the series need their index
+void BoxPlotChartItem::handleBoxClicked(QBoxSet *set)
+{
+    emit m_series->boxClicked(m_boxTable.value(set)->m_data.m_index);
+}
+
+void BoxPlotChartItem::handleBoxHovered(bool status, QBoxSet *set)
+{
+    emit m_series->boxHovered(status, m_boxTable.value(set)->m_data.m_index);
+}
+
+void BoxPlotChartItem::handleBoxPressed(QBoxSet *set)
+{
+    emit m_series->boxPressed(m_boxTable.value(set)->m_data.m_index);
+}
+
+void BoxPlotChartItem::handleBoxReleased(QBoxSet *set)
+{
+    emit m_series->boxReleased(m_boxTable.value(set)->m_data.m_index);
+}
+
+void BoxPlotChartItem::handleBoxDoubleClicked(QBoxSet *set)
+{
+    emit m_series->boxDoubleClicked(m_boxTable.value(set)->m_data.m_index);
+}
+
 void BoxPlotChartItem::initializeLayout()
 {
 }
@@ -62,6 +62,7 @@ public:
 
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
     QRectF boundingRect() const;
+    QPainterPath shape() const;
 
 public Q_SLOTS:
     void handleDataStructureChanged();
@@ -70,10 +71,30 @@ public Q_SLOTS:
     void handleUpdatedBars();
     void handleBoxsetRemove(QList<QBoxSet *> barSets);
 
+private Q_SLOTS:
+    void handleBoxClicked(QBoxSet *set);
+    void handleBoxHovered(bool status, QBoxSet *set);
+    void handleBoxPressed(QBoxSet *set);
+    void handleBoxReleased(QBoxSet *set);
+    void handleBoxDoubleClicked(QBoxSet *set);
+
+protected:
+    // Mouse events of the boxes of rows, which this item paints itself
+    void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event);
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
+    void mousePressEvent(QGraphicsSceneMouseEvent *event);
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
+
 private:
     virtual QVector<QRectF> calculateLayout();
     void initializeLayout();
     bool updateBoxGeometry(BoxWhiskers *box, int index);
+    void visibleRows(int &first, int &last) const;
+    bool rowGeometry(int index, QRectF &box, qreal &upperExtreme, qreal &lowerExtreme,
+                     qreal &median) const;
+    int rowAt(const QPointF &pos) const;
 
 protected:
     friend class QBoxPlotSeriesPrivate;
@@ -86,6 +107,8 @@ protected:
     BoxPlotAnimation *m_animation;
 
     QRectF m_boundingRect;
+    int m_hoveredIndex;
+    int m_pressedIndex;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -29,10 +29,12 @@
 
 #include <QtCharts/QBoxPlotModelMapper>
 #include <private/qboxplotmodelmapper_p.h>
+#include <private/qboxplotseries_p.h>
 #include <QtCharts/QBoxPlotSeries>
 #include <QtCharts/QBoxSet>
 #include <QtCharts/QChart>
 #include <QtCore/QAbstractItemModel>
+#include <private/qnumericcolumnaccess_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -47,6 +49,34 @@ QT_CHARTS_BEGIN_NAMESPACE
     class as a data source for a chart.
 */
 
+/*!
+    \property QBoxPlotModelMapper::backgroundLoading
+    \brief Whether large models are read in the background.
+
+    When enabled, the initial read of a model that maps at least 10000 values, and the reread
+    after the model is reset, are done in a worker thread, so that the application stays
+    responsive. The series keeps its previous box sets until all the values have been read. The
+    new box sets are then created and appended to the series at once.
+
+    Only models that provide all the mapped sections with QNumericColumnAccess can be read in
+    the background, other models are always read at once through QAbstractItemModel::data().
+
+    When the model announces a change while it is being loaded, the mapper waits for the worker
+    thread, passes the box sets to the series, and then applies the change. Changes to the
+    series restart the loading.
+
+    By default, background loading is disabled.
+
+    \sa isLoading(), loadingFinished()
+*/
+
+/*!
+    \fn void QBoxPlotModelMapper::loadingFinished()
+    This signal is emitted when the box sets read in the background have been passed to the
+    series.
+    \sa backgroundLoading
+*/
+
 QBoxPlotModelMapper::QBoxPlotModelMapper(QObject *parent) :
     QObject(parent),
     d_ptr(new QBoxPlotModelMapperPrivate(this))
@@ -79,6 +109,13 @@ void QBoxPlotModelMapper::setModel(QAbstractItemModel *model)
     connect(d->m_model, SIGNAL(columnsInserted(QModelIndex,int,int)), d, SLOT(modelColumnsAdded(QModelIndex,int,int)));
     connect(d->m_model, SIGNAL(columnsRemoved(QModelIndex,int,int)), d, SLOT(modelColumnsRemoved(QModelIndex,int,int)));
     connect(d->m_model, SIGNAL(destroyed()), d, SLOT(handleModelDestroyed()));
+    // the values read in the background must not change under the loader
+    connect(d->m_model, SIGNAL(rowsAboutToBeInserted(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(rowsAboutToBeRemoved(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(columnsAboutToBeInserted(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(columnsAboutToBeRemoved(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(modelAboutToBeReset()), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(layoutAboutToBeChanged()), d, SLOT(waitForLoading()));
 }
 
 QBoxPlotSeries *QBoxPlotModelMapper::series() const
@@ -209,6 +246,28 @@ void QBoxPlotModelMapper::setLastBoxSetSection(int lastBoxSetSection)
     d->initializeBoxFromModel();
 }
 
+bool QBoxPlotModelMapper::backgroundLoading() const
+{
+    Q_D(const QBoxPlotModelMapper);
+    return d->m_backgroundLoading;
+}
+
+void QBoxPlotModelMapper::setBackgroundLoading(bool enabled)
+{
+    Q_D(QBoxPlotModelMapper);
+    d->m_backgroundLoading = enabled;
+}
+
+/*!
+    Returns true if the values of the model are being read in the background.
+    \sa backgroundLoading
+*/
+bool QBoxPlotModelMapper::isLoading() const
+{
+    Q_D(const QBoxPlotModelMapper);
+    return d->isLoading();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QBoxPlotModelMapperPrivate::QBoxPlotModelMapperPrivate(QBoxPlotModelMapper *q) :
@@ -222,12 +281,23 @@ QBoxPlotModelMapperPrivate::QBoxPlotModelMapperPrivate(QBoxPlotModelMapper *q) :
     m_lastBoxSetSection(-1),
     m_seriesSignalsBlock(false),
     m_modelSignalsBlock(false),
+    m_backgroundLoading(false),
+    m_loader(0),
     q_ptr(q)
 {
 }
 
+QBoxPlotModelMapperPrivate::~QBoxPlotModelMapperPrivate()
+{
+    stopLoading();
+}
+
 void QBoxPlotModelMapperPrivate::blockModelSignals(bool block)
 {
+    // The series is written to the model. The loading in progress would be overwritten by the
+    // reinitialization that follows, so it is cancelled before the model changes.
+    if (block)
+        stopLoading();
     m_modelSignalsBlock = block;
 }
 
@@ -243,10 +313,10 @@ QBoxSet *QBoxPlotModelMapperPrivate::boxSet(QModelIndex index)
 
     if (m_orientation == Qt::Vertical && index.column() >= m_firstBoxSetSection && index.column() <= m_lastBoxSetSection) {
         if (index.row() >= m_first && (m_count == - 1 || index.row() < m_first + m_count))
-            return m_series->boxSets().at(index.column() - m_firstBoxSetSection);
+            return m_boxSets.value(index.column() - m_firstBoxSetSection);
     } else if (m_orientation == Qt::Horizontal && index.row() >= m_firstBoxSetSection && index.row() <= m_lastBoxSetSection) {
         if (index.column() >= m_first && (m_count == - 1 || index.column() < m_first + m_count))
-            return m_series->boxSets().at(index.row() - m_firstBoxSetSection);
+            return m_boxSets.value(index.row() - m_firstBoxSetSection);
     }
     return 0; // This part of model has not been mapped to any boxset
 }
@@ -267,6 +337,7 @@ QModelIndex QBoxPlotModelMapperPrivate::boxModelIndex(int boxSection, int posInB
 
 void QBoxPlotModelMapperPrivate::handleSeriesDestroyed()
 {
+    stopLoading();
     m_series = 0;
 }
 
@@ -281,6 +352,8 @@ void QBoxPlotModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex b
     if (m_modelSignalsBlock)
         return;
 
+    waitForLoading();
+
     blockSeriesSignals();
     QModelIndex index;
     for (int row = topLeft.row(); row <= bottomRight.row(); row++) {
@@ -363,9 +436,21 @@ void QBoxPlotModelMapperPrivate::modelColumnsRemoved(QModelIndex parent, int sta
 
 void QBoxPlotModelMapperPrivate::handleModelDestroyed()
 {
+    stopLoading();
     m_model = 0;
 }
 
+// The model is about to change the values the loader reads: the box sets are passed to the
+// series before the change is applied
+void QBoxPlotModelMapperPrivate::waitForLoading()
+{
+    if (!m_loader)
+        return;
+
+    m_loader->wait();
+    handleLoadingFinished();
+}
+
 void QBoxPlotModelMapperPrivate::insertData(int start, int end)
 {
     Q_UNUSED(end)
@@ -394,7 +479,8 @@ void QBoxPlotModelMapperPrivate::boxSetsAdded(QList<QBoxSet *> sets)
     if (sets.count() == 0)
         return;
 
-    int firstIndex = m_series->boxSets().indexOf(sets.at(0));
+    // The sets were appended or inserted, look them up without turning rows into sets
+    int firstIndex = QBoxPlotSeriesPrivate::get(m_series)->storedSets().indexOf(sets.at(0));
     if (firstIndex == -1)
         return;
 
@@ -473,9 +559,14 @@ void QBoxPlotModelMapperPrivate::boxValueChanged(int index)
 
 void QBoxPlotModelMapperPrivate::initializeBoxFromModel()
 {
+    stopLoading();
+
     if (m_model == 0 || m_series == 0)
         return;
 
+    if (m_backgroundLoading && startLoading())
+        return;
+
     blockSeriesSignals();
     // clear current content
     m_series->clear();
@@ -487,13 +578,20 @@ void QBoxPlotModelMapperPrivate::initializeBoxFromModel()
         QModelIndex boxIndex = boxModelIndex(i, posInBar);
         // check if there is such model index
         if (boxIndex.isValid()) {
-            QBoxSet *boxSet = new QBoxSet();
-            while (boxIndex.isValid()) {
-                boxSet->append(m_model->data(boxIndex, Qt::DisplayRole).toDouble());
+            QList<qreal> values;
+            NumericSection section(m_model, m_orientation, i);
+            if (section.isValid()) {
+                const int count = numericCount(section);
+                values.reserve(count);
+                for (; posInBar < count; posInBar++)
+                    values.append(section.at(posInBar + m_first));
+            }
+            while (!section.isValid() && boxIndex.isValid()) {
+                values.append(m_model->data(boxIndex, Qt::DisplayRole).toDouble());
                 posInBar++;
                 boxIndex = boxModelIndex(i, posInBar);
             }
-            connect(boxSet, SIGNAL(valueChanged(int)), this, SLOT(boxValueChanged(int)));
+            QBoxSet *boxSet = createBoxSet(values);
             m_series->append(boxSet);
             m_boxSets.append(boxSet);
         } else {
@@ -503,6 +601,83 @@ void QBoxPlotModelMapperPrivate::initializeBoxFromModel()
     blockSeriesSignals(false);
 }
 
+QBoxSet *QBoxPlotModelMapperPrivate::createBoxSet(const QList<qreal> &values)
+{
+    QBoxSet *boxSet = new QBoxSet();
+    boxSet->append(values);
+    connect(boxSet, SIGNAL(valueChanged(int)), this, SLOT(boxValueChanged(int)));
+    return boxSet;
+}
+
+// Returns the number of mapped values a numeric section provides
+int QBoxPlotModelMapperPrivate::numericCount(const NumericSection &section) const
+{
+    const int sectionCount = m_orientation == Qt::Vertical ? m_model->rowCount() : m_model->columnCount();
+    int count = qMin(section.count(), sectionCount) - m_first;
+    if (m_count != -1)
+        count = qMin(count, m_count);
+    return qMax(count, 0);
+}
+
+// Starts reading the box sets in a worker thread. Returns false if the model is read at once,
+// because it is small or does not provide numeric access to all the mapped sections.
+bool QBoxPlotModelMapperPrivate::startLoading()
+{
+    ModelLoader *loader = new ModelLoader(this);
+    for (int i = m_firstBoxSetSection; i <= m_lastBoxSetSection; i++) {
+        if (!boxModelIndex(i, 0).isValid())
+            break;
+        NumericSection section(m_model, m_orientation, i);
+        if (!section.isValid()) {
+            delete loader;
+            return false;
+        }
+        loader->addSection(section, m_first, numericCount(section));
+    }
+
+    if (loader->valueCount() < backgroundLoadingThreshold) {
+        delete loader;
+        return false;
+    }
+
+    m_loader = loader;
+    connect(m_loader, SIGNAL(finished()), this, SLOT(handleLoadingFinished()));
+    m_loader->start();
+    return true;
+}
+
+// Cancels the loading in progress. Returns true if the model was being loaded.
+bool QBoxPlotModelMapperPrivate::stopLoading()
+{
+    if (!m_loader)
+        return false;
+
+    delete m_loader;
+    m_loader = 0;
+    return true;
+}
+
+void QBoxPlotModelMapperPrivate::handleLoadingFinished()
+{
+    // The finished() signal of a loader already handled by waitForLoading() is ignored
+    if (!m_loader || !m_loader->isFinished())
+        return;
+
+    QList<QBoxSet *> boxSets;
+    for (int i = 0; i < m_loader->sectionCount(); i++)
+        boxSets.append(createBoxSet(m_loader->values(i).toList()));
+    stopLoading();
+
+    blockSeriesSignals();
+    m_series->clear();
+    m_series->append(boxSets);
+    m_boxSets = boxSets;
+    blockSeriesSignals(false);
+
+    Q_Q(QBoxPlotModelMapper);
+    emit q->loadingFinished();
+}
+
 #include "moc_qboxplotmodelmapper.cpp"
 #include "moc_qboxplotmodelmapper_p.cpp"
 
@@ -45,6 +45,15 @@ class QBoxPlotSeries;
 class QT_CHARTS_EXPORT QBoxPlotModelMapper : public QObject
 {
     Q_OBJECT
+    Q_PROPERTY(bool backgroundLoading READ backgroundLoading WRITE setBackgroundLoading)
+
+public:
+    bool backgroundLoading() const;
+    void setBackgroundLoading(bool enabled);
+    bool isLoading() const;
+
+Q_SIGNALS:
+    void loadingFinished();
 
 protected:
     explicit QBoxPlotModelMapper(QObject *parent = Q_NULLPTR);
@@ -41,6 +41,7 @@
 
 #include <QtCore/QObject>
 #include <QtCharts/QBoxPlotModelMapper>
+#include <private/modelloader_p.h>
 
 QT_BEGIN_NAMESPACE
 class QModelIndex;
@@ -55,6 +56,9 @@ class QBoxPlotModelMapperPrivate : public QObject
     Q_OBJECT
 public:
     explicit QBoxPlotModelMapperPrivate(QBoxPlotModelMapper *q);
+    ~QBoxPlotModelMapperPrivate();
+
+    bool isLoading() const { return m_loader != 0; }
 
 public Q_SLOTS:
     // for the model
@@ -65,6 +69,7 @@ public Q_SLOTS:
     void modelColumnsAdded(QModelIndex parent, int start, int end);
     void modelColumnsRemoved(QModelIndex parent, int start, int end);
     void handleModelDestroyed();
+    void waitForLoading();
 
     // for the series
     void boxSetsAdded(QList<QBoxSet *> sets);
@@ -73,6 +78,7 @@ public Q_SLOTS:
     void handleSeriesDestroyed();
 
     void initializeBoxFromModel();
+    void handleLoadingFinished();
 
 private:
     QBoxSet *boxSet(QModelIndex index);
@@ -81,6 +87,10 @@ private:
     void removeData(int start, int end);
     void blockModelSignals(bool block = true);
     void blockSeriesSignals(bool block = true);
+    QBoxSet *createBoxSet(const QList<qreal> &values);
+    int numericCount(const NumericSection &section) const;
+    bool startLoading();
+    bool stopLoading();
 
 private:
     QBoxPlotSeries *m_series;
@@ -93,6 +103,8 @@ private:
     int m_lastBoxSetSection;
     bool m_seriesSignalsBlock;
     bool m_modelSignalsBlock;
+    bool m_backgroundLoading;
+    ModelLoader *m_loader;
 
 private:
     QBoxPlotModelMapper *q_ptr;
@@ -97,6 +97,44 @@ QT_CHARTS_BEGIN_NAMESPACE
     \a boxset in the chart. When the mouse moves over the item, \a status turns \c true, and
     when the mouse moves away again, it turns \c false.
 */
+/*!
+    \fn QBoxPlotSeries::boxClicked(int index)
+    This signal is emitted when the user clicks the box-and-whiskers item at \a index in the
+    chart.
+
+    Unlike clicked(), this signal is also emitted for the items appended as columns of values,
+    which have no QBoxSet until boxSets() is called.
+*/
+/*!
+    \fn QBoxPlotSeries::boxPressed(int index)
+    This signal is emitted when the user clicks the box-and-whiskers item at \a index in the
+    chart and holds down the mouse button.
+
+    Unlike pressed(), this signal is also emitted for the items appended as columns of values.
+*/
+/*!
+    \fn QBoxPlotSeries::boxReleased(int index)
+    This signal is emitted when the user releases the mouse press on the box-and-whiskers item at
+    \a index in the chart.
+
+    Unlike released(), this signal is also emitted for the items appended as columns of values.
+*/
+/*!
+    \fn QBoxPlotSeries::boxDoubleClicked(int index)
+    This signal is emitted when the user double-clicks the box-and-whiskers item at \a index in
+    the chart.
+
+    Unlike doubleClicked(), this signal is also emitted for the items appended as columns of
+    values.
+*/
+/*!
+    \fn QBoxPlotSeries::boxHovered(bool status, int index)
+    This signal is emitted when a mouse is hovered over the box-and-whiskers item at \a index in
+    the chart. When the mouse moves over the item, \a status turns \c true, and when the mouse
+    moves away again, it turns \c false.
+
+    Unlike hovered(), this signal is also emitted for the items appended as columns of values.
+*/
 /*!
     \fn QBoxPlotSeries::countChanged()
     This signal is emitted when the number of box-and-whiskers items in the series changes.
@@ -176,6 +214,7 @@ bool QBoxPlotSeries::append(QBoxSet *set)
 {
     Q_D(QBoxPlotSeries);
 
+    d->materializeRows();
     bool success = d->append(set);
     if (success) {
         QList<QBoxSet *> sets;
@@ -239,6 +278,7 @@ bool QBoxPlotSeries::take(QBoxSet *set)
 bool QBoxPlotSeries::append(QList<QBoxSet *> sets)
 {
     Q_D(QBoxPlotSeries);
+    d->materializeRows();
     bool success = d->append(sets);
     if (success) {
         emit boxsetsAdded(sets);
@@ -247,6 +287,34 @@ bool QBoxPlotSeries::append(QList<QBoxSet *> sets)
     return success;
 }
 
+/*!
+    Appends box-and-whiskers items to the series from the columns \a lowerExtremes,
+    \a lowerQuartiles, \a medians, \a upperQuartiles, and \a upperExtremes, which must all have
+    the same, non-zero length.
+
+    The items are stored compactly in the series without a QBoxSet object for each of them, which
+    makes this the preferred way to add large amounts of data. The box sets are created the first
+    time they are needed, for example when boxSets() is called or when sets are appended or
+    inserted. No boxsetsAdded() signal is emitted for them.
+
+    Until their sets exist, the items emit no set based signals, such as clicked(). Use
+    boxClicked() and the other index based signals for them instead.
+
+    Returns \c true if the items were appended, \c false otherwise.
+*/
+bool QBoxPlotSeries::append(const QVector<qreal> &lowerExtremes,
+                            const QVector<qreal> &lowerQuartiles, const QVector<qreal> &medians,
+                            const QVector<qreal> &upperQuartiles,
+                            const QVector<qreal> &upperExtremes)
+{
+    Q_D(QBoxPlotSeries);
+    bool success = d->appendRows(lowerExtremes, lowerQuartiles, medians, upperQuartiles,
+                                 upperExtremes);
+    if (success)
+        emit countChanged();
+    return success;
+}
+
 /*!
     Inserts a box-and-whiskers item specified by \a set to a series at the position specified by
     \a index and takes ownership of the item. If the item is null or already belongs to the series,
@@ -255,6 +323,7 @@ bool QBoxPlotSeries::append(QList<QBoxSet *> sets)
 bool QBoxPlotSeries::insert(int index, QBoxSet *set)
 {
     Q_D(QBoxPlotSeries);
+    d->materializeRows();
     bool success = d->insert(index, set);
     if (success) {
         QList<QBoxSet *> sets;
@@ -271,13 +340,17 @@ bool QBoxPlotSeries::insert(int index, QBoxSet *set)
 void QBoxPlotSeries::clear()
 {
     Q_D(QBoxPlotSeries);
-    QList<QBoxSet *> sets = boxSets();
+    // Rows are dropped without creating sets for them
+    const bool rowsCleared = d->clearRows();
+    QList<QBoxSet *> sets = d->m_boxSets;
     bool success = d->remove(sets);
     if (success) {
         emit boxsetsRemoved(sets);
         emit countChanged();
         foreach (QBoxSet *set, sets)
             delete set;
+    } else if (rowsCleared) {
+        emit countChanged();
     }
 }
 
@@ -287,15 +360,21 @@ void QBoxPlotSeries::clear()
 int QBoxPlotSeries::count() const
 {
     Q_D(const QBoxPlotSeries);
-    return d->m_boxSets.count();
+    return d->m_boxSets.count() + d->m_rows.count();
 }
 
 /*!
     Returns a list of box-and-whiskers items in a box plot series. Keeps the ownership of the items.
+
+    \warning Although this function is const, it allocates: a QBoxSet object, together with a
+    box-and-whiskers item in the chart, is created for each item appended as columns of values,
+    and the items stay sets from then on. For series holding large amounts of such items, use
+    count() and the index based signals, such as boxClicked(), instead.
  */
 QList<QBoxSet *> QBoxPlotSeries::boxSets() const
 {
     Q_D(const QBoxPlotSeries);
+    const_cast<QBoxPlotSeriesPrivate *>(d)->materializeRows();
     return d->m_boxSets;
 }
 
@@ -406,7 +485,7 @@ void QBoxPlotSeriesPrivate::initializeDomain()
     qreal maxX(domain()->maxX());
     qreal maxY(domain()->maxY());
 
-    qreal x = m_boxSets.count();
+    qreal x = m_boxSets.count() + m_rows.count();
     minX = qMin(minX, qreal(-0.5));
     minY = qMin(minY, min());
     maxX = qMax(maxX, x - qreal(0.5));
@@ -452,6 +531,9 @@ void QBoxPlotSeriesPrivate::populateCategories(QBarCategoryAxis *axis)
             else
                 categories << set->label();
         }
+        // Rows have no labels
+        for (int i = m_boxSets.count() + 1; i < m_boxSets.count() + m_rows.count() + 1; i++)
+            categories << presenter()->numberToString(i);
         axis->append(categories);
     }
 }
@@ -684,12 +766,75 @@ QBoxSet *QBoxPlotSeriesPrivate::boxSetAt(int index)
     return m_boxSets.at(index);
 }
 
+bool QBoxPlotSeriesPrivate::appendRows(const QVector<qreal> &lowerExtremes,
+                                       const QVector<qreal> &lowerQuartiles,
+                                       const QVector<qreal> &medians,
+                                       const QVector<qreal> &upperQuartiles,
+                                       const QVector<qreal> &upperExtremes)
+{
+    const int count = lowerExtremes.count();
+    if (count == 0 || lowerQuartiles.count() != count || medians.count() != count
+        || upperQuartiles.count() != count || upperExtremes.count() != count) {
+        return false; // Fail if the columns are empty or of different lengths.
+    }
+
+    const int index = m_rows.count();
+    m_rows.resize(index + count);
+    for (int i = 0; i < count; ++i) {
+        qreal *values = m_rows[index + i].values;
+        values[QBoxSet::LowerExtreme] = lowerExtremes.at(i);
+        values[QBoxSet::LowerQuartile] = lowerQuartiles.at(i);
+        values[QBoxSet::Median] = medians.at(i);
+        values[QBoxSet::UpperQuartile] = upperQuartiles.at(i);
+        values[QBoxSet::UpperExtreme] = upperExtremes.at(i);
+    }
+
+    emit restructuredBoxes(); // this notifies boxplotchartitem
+    return true;
+}
+
+// Creates sets for the rows, which keep their position after the existing sets
+void QBoxPlotSeriesPrivate::materializeRows()
+{
+    if (m_rows.isEmpty())
+        return;
+
+    Q_Q(QBoxPlotSeries);
+
+    QList<QBoxSet *> sets;
+    sets.reserve(m_rows.count());
+    foreach (const BoxPlotRow &row, m_rows) {
+        sets.append(new QBoxSet(row.values[QBoxSet::LowerExtreme],
+                                row.values[QBoxSet::LowerQuartile],
+                                row.values[QBoxSet::Median],
+                                row.values[QBoxSet::UpperQuartile],
+                                row.values[QBoxSet::UpperExtreme], QString(), q));
+    }
+    m_rows.clear();
+    append(sets);
+}
+
+bool QBoxPlotSeriesPrivate::clearRows()
+{
+    if (m_rows.isEmpty())
+        return false;
+
+    m_rows.clear();
+    emit restructuredBoxes(); // this notifies boxplotchartitem
+    return true;
+}
+
+QBoxPlotSeriesPrivate *QBoxPlotSeriesPrivate::get(QBoxPlotSeries *series)
+{
+    return series->d_func();
+}
+
 qreal QBoxPlotSeriesPrivate::min()
 {
-    if (m_boxSets.count() <= 0)
+    if (m_boxSets.count() + m_rows.count() <= 0)
         return 0;
 
-    qreal min = m_boxSets.at(0)->at(0);
+    qreal min = m_boxSets.count() ? m_boxSets.at(0)->at(0) : m_rows.at(0).values[0];
 
     foreach (QBoxSet *set, m_boxSets) {
         for (int i = 0; i < 5; i++) {
@@ -697,16 +842,20 @@ qreal QBoxPlotSeriesPrivate::min()
                 min = set->at(i);
         }
     }
+    foreach (const BoxPlotRow &row, m_rows) {
+        for (int i = 0; i < 5; i++)
+            min = qMin(min, row.values[i]);
+    }
 
     return min;
 }
 
 qreal QBoxPlotSeriesPrivate::max()
 {
-    if (m_boxSets.count() <= 0)
+    if (m_boxSets.count() + m_rows.count() <= 0)
         return 0;
 
-    qreal max = m_boxSets.at(0)->at(0);
+    qreal max = m_boxSets.count() ? m_boxSets.at(0)->at(0) : m_rows.at(0).values[0];
 
     foreach (QBoxSet *set, m_boxSets) {
         for (int i = 0; i < 5; i++) {
@@ -714,6 +863,10 @@ qreal QBoxPlotSeriesPrivate::max()
                 max = set->at(i);
         }
     }
+    foreach (const BoxPlotRow &row, m_rows) {
+        for (int i = 0; i < 5; i++)
+            max = qMax(max, row.values[i]);
+    }
 
     return max;
 }
@@ -33,6 +33,7 @@
 #include <QtCharts/QChartGlobal>
 #include <QtCharts/QBoxSet>
 #include <QtCharts/QAbstractSeries>
+#include <QtCore/QVector>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -54,6 +55,9 @@ public:
     bool remove(QBoxSet *box);
     bool take(QBoxSet *box);
     bool append(QList<QBoxSet *> boxes);
+    bool append(const QVector<qreal> &lowerExtremes, const QVector<qreal> &lowerQuartiles,
+                const QVector<qreal> &medians, const QVector<qreal> &upperQuartiles,
+                const QVector<qreal> &upperExtremes);
     bool insert(int index, QBoxSet *box);
     int count() const;
     QList<QBoxSet *> boxSets() const;
@@ -76,6 +80,11 @@ Q_SIGNALS:
     void pressed(QBoxSet *boxset);
     void released(QBoxSet *boxset);
     void doubleClicked(QBoxSet *boxset);
+    void boxClicked(int index);
+    void boxHovered(bool status, int index);
+    void boxPressed(int index);
+    void boxReleased(int index);
+    void boxDoubleClicked(int index);
     void countChanged();
     void penChanged();
     void brushChanged();
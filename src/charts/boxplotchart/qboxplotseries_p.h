@@ -48,6 +48,12 @@ QT_CHARTS_BEGIN_NAMESPACE
 
 class BoxPlotAnimation;
 
+// Box-and-whiskers item appended as values only, without a QBoxSet
+struct BoxPlotRow
+{
+    qreal values[5]; // Indexed by QBoxSet::ValuePositions
+};
+
 class QBoxPlotSeriesPrivate : public QAbstractSeriesPrivate
 {
     Q_OBJECT
@@ -74,6 +80,16 @@ public:
     bool insert(int index, QBoxSet *set);
     QBoxSet *boxSetAt(int index);
 
+    bool appendRows(const QVector<qreal> &lowerExtremes, const QVector<qreal> &lowerQuartiles,
+                    const QVector<qreal> &medians, const QVector<qreal> &upperQuartiles,
+                    const QVector<qreal> &upperExtremes);
+    void materializeRows();
+    bool clearRows();
+
+    static QBoxPlotSeriesPrivate *get(QBoxPlotSeries *series);
+    // The sets without the rows, which unlike QBoxPlotSeries::boxSets() creates no sets for rows
+    const QList<QBoxSet *> &storedSets() const { return m_boxSets; }
+
     qreal max();
     qreal min();
 
@@ -96,6 +112,8 @@ private Q_SLOTS:
 
 protected:
     QList<QBoxSet *> m_boxSets;
+    // Rows follow the sets, until they are turned into sets when sets are needed
+    QVector<BoxPlotRow> m_rows;
     QPen m_pen;
     QBrush m_brush;
     bool m_boxOutlineVisible;
@@ -105,6 +123,7 @@ protected:
 
 private:
     Q_DECLARE_PUBLIC(QBoxPlotSeries)
+    friend class BoxPlotChartItem;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -30,6 +30,8 @@
 #include <QtCharts/QBoxSet>
 #include <private/qboxset_p.h>
 #include <private/charthelpers_p.h>
+#include <QtCore/QtMath>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -47,6 +49,9 @@ QT_CHARTS_BEGIN_NAMESPACE
     The second way is to create an empty QBoxSet instance and specify the values using the
     setValue() method.
 
+    Alternatively, the raw samples can be given with setSamples() or appendSamples(), in which
+    case the box-and-whiskers item calculates the five values from them.
+
     See the \l{Box and Whiskers Example}{box-and-whiskers chart example} to learn how to
     create a box-and-whiskers chart.
 
@@ -182,6 +187,95 @@ void QBoxSet::append(const QList<qreal> &values)
         emit valuesChanged();
 }
 
+/*!
+    Replaces the samples of the box-and-whiskers item with \a samples and sets its values to
+    the extremes, quartiles, and median of the samples. The quartiles are the medians of the
+    lower and upper halves of the samples, which exclude the median when the number of samples
+    is odd. Samples that are not valid numbers are ignored.
+
+    The samples are kept so that further samples can be added with appendSamples(). Values
+    set with setValue() or append() are replaced the next time the samples change.
+
+    \note Every kept sample takes the size of a qreal, so a million samples take about 8 MB
+    per box-and-whiskers item, on top of the vector passed in. Use setSampleSketchThreshold()
+    to bound the memory of items with very many samples.
+    \sa appendSamples(), sampleCount()
+*/
+void QBoxSet::setSamples(const QVector<qreal> &samples)
+{
+    if (samples.isEmpty() && !d_ptr->m_sampleCount)
+        return;
+
+    d_ptr->clearSamples();
+    if (!d_ptr->appendSamples(samples)) {
+        d_ptr->clear();
+        emit cleared();
+        return;
+    }
+    emit valuesChanged();
+}
+
+/*!
+    Adds \a samples to the samples of the box-and-whiskers item and recalculates its values
+    from all of its samples.
+
+    The kept samples stay partitioned around the values of the last calculation, so that only
+    the samples near the values are partitioned again. Appending a few samples to many of them
+    takes time in proportion to the square root of the number of samples, not to the number
+    itself.
+    \sa setSamples(), setSampleSketchThreshold()
+*/
+void QBoxSet::appendSamples(const QVector<qreal> &samples)
+{
+    if (d_ptr->appendSamples(samples))
+        emit valuesChanged();
+}
+
+/*!
+    Returns the number of samples the values of the box-and-whiskers item are calculated from.
+    \sa setSamples()
+*/
+int QBoxSet::sampleCount() const
+{
+    return d_ptr->m_sampleCount;
+}
+
+/*!
+    Sets the number of samples above which the box-and-whiskers item stops keeping its samples
+    to \a count. Above it, the item releases its samples and estimates its values with the
+    P-square algorithm, which updates five markers in constant time and memory for every
+    added sample. The extremes stay exact, while the quartiles and the median become estimates.
+
+    The default count of 0 keeps all samples and calculates the exact values. Counts from 1 to 4
+    are raised to 5. When the item already has more samples than \a count, it switches to the
+    estimates right away. Once it estimates its values, it keeps doing so until setSamples() or
+    clear() is called.
+    \sa sampleSketchThreshold(), appendSamples()
+*/
+void QBoxSet::setSampleSketchThreshold(int count)
+{
+    if (count > 0 && count < 5)
+        count = 5;
+    d_ptr->m_sketchThreshold = qMax(0, count);
+    if (d_ptr->m_sketching || !d_ptr->m_sketchThreshold || d_ptr->m_sampleCount <= count)
+        return;
+
+    // The markers start at the values of the samples, which setValue() may have replaced
+    d_ptr->updateFromSamples();
+    d_ptr->startSketch();
+    emit valuesChanged();
+}
+
+/*!
+    Returns the number of samples above which the box-and-whiskers item estimates its values
+    instead of keeping its samples, or 0 when it keeps all samples.
+    \sa setSampleSketchThreshold()
+*/
+int QBoxSet::sampleSketchThreshold() const
+{
+    return d_ptr->m_sketchThreshold;
+}
+
 /*!
     Sets the label specified by \a label for the category of the box-and-whiskers item.
 */
@@ -220,7 +314,7 @@ void QBoxSet::setValue(const int index, const qreal value)
 }
 
 /*!
-    Sets all the values of the box-and-whiskers item to 0.
+    Sets all the values of the box-and-whiskers item to 0 and removes its samples.
  */
 void QBoxSet::clear()
 {
@@ -305,6 +399,11 @@ QBoxSetPrivate::QBoxSetPrivate(const QString label, QBoxSet *parent) : QObject(p
     m_label(label),
     m_valuesCount(5),
     m_appendCount(0),
+    m_sampleCount(0),
+    m_sampleMinimum(0.0),
+    m_sampleMaximum(0.0),
+    m_sketchThreshold(0),
+    m_sketching(false),
     m_pen(QPen(Qt::NoPen)),
     m_brush(QBrush(Qt::NoBrush)),
     m_series(0)
@@ -347,6 +446,7 @@ bool QBoxSetPrivate::append(QList<qreal> values)
 
 void QBoxSetPrivate::clear()
 {
+    clearSamples();
     m_appendCount = 0;
     for (int i = 0; i < m_valuesCount; i++)
          m_values[i] = 0.0;
@@ -361,6 +461,250 @@ void QBoxSetPrivate::setValue(const int index, const qreal value)
     }
 }
 
+bool QBoxSetPrivate::appendSamples(const QVector<qreal> &samples)
+{
+    const int oldCount = m_sampleCount;
+    // Reserving exactly the needed size would reallocate the samples on every small append
+    const int needed = m_samples.count() + samples.count();
+    if (!m_sketching && needed > m_samples.capacity())
+        m_samples.reserve(qMax(needed, 2 * m_samples.capacity()));
+    foreach (qreal sample, samples) {
+        if (!isValidValue(sample))
+            continue;
+        if (m_sketching)
+            addToSketch(sample);
+        else
+            insertSample(sample);
+        m_sampleCount++;
+    }
+    if (m_sampleCount == oldCount)
+        return false;
+
+    if (m_sketching) {
+        for (int i = 0; i < m_valuesCount; i++)
+            m_values[i] = m_markerHeights[i];
+        m_appendCount = m_valuesCount;
+        emit restructuredBox();
+        return true;
+    }
+
+    updateFromSamples();
+    if (m_sketchThreshold > 0 && m_sampleCount > m_sketchThreshold)
+        startSketch();
+    return true;
+}
+
+void QBoxSetPrivate::clearSamples()
+{
+    m_samples.clear();
+    m_sampleBounds.clear();
+    m_sampleCount = 0;
+    m_sketching = false;
+}
+
+// Appends the sample to the kept samples and moves it into its partition, by swapping it with
+// the first sample of every partition it passes on the way
+void QBoxSetPrivate::insertSample(qreal sample)
+{
+    if (m_samples.isEmpty()) {
+        m_sampleMinimum = sample;
+        m_sampleMaximum = sample;
+    } else {
+        m_sampleMinimum = qMin(m_sampleMinimum, sample);
+        m_sampleMaximum = qMax(m_sampleMaximum, sample);
+    }
+
+    int position = m_samples.count();
+    m_samples.append(sample);
+    qreal *samples = m_samples.data();
+    for (int i = m_sampleBounds.count() - 1; i >= 0; i--) {
+        BoxSampleBound &bound = m_sampleBounds[i];
+        if (sample >= bound.separator)
+            break;
+        qSwap(samples[position], samples[bound.position]);
+        position = bound.position++;
+    }
+}
+
+// The values are selected from the samples in linear time instead of sorting them. The samples
+// stay partitioned around the selected values, with bounds a window away from them, so after an
+// append only the samples inside the windows around the moved ranks are partitioned again.
+void QBoxSetPrivate::updateFromSamples()
+{
+    const int count = m_samples.count();
+    QVector<int> ranks;
+
+    const qreal median = selectMedian(0, count, &ranks);
+    qreal lowerQuartile = median;
+    qreal upperQuartile = median;
+    if (count > 1) {
+        lowerQuartile = selectMedian(0, count / 2, &ranks);
+        upperQuartile = selectMedian(count / 2 + count % 2, count / 2, &ranks);
+    }
+    pruneSampleBounds(ranks);
+
+    m_values[QBoxSet::LowerExtreme] = m_sampleMinimum;
+    m_values[QBoxSet::LowerQuartile] = lowerQuartile;
+    m_values[QBoxSet::Median] = median;
+    m_values[QBoxSet::UpperQuartile] = upperQuartile;
+    m_values[QBoxSet::UpperExtreme] = m_sampleMaximum;
+    m_appendCount = m_valuesCount;
+
+    emit restructuredBox();
+}
+
+// Returns the median of the count samples from the rank begin on in the sorted samples
+qreal QBoxSetPrivate::selectMedian(int begin, int count, QVector<int> *ranks)
+{
+    const int middle = begin + count / 2;
+    ranks->append(middle);
+    if (count % 2)
+        return selectSample(middle);
+    ranks->append(middle - 1);
+    const qreal lower = selectSample(middle - 1);
+    return (lower + selectSample(middle)) / 2.0;
+}
+
+// Returns the sample that has the given rank in the sorted samples
+qreal QBoxSetPrivate::selectSample(int rank)
+{
+    int begin;
+    int end;
+    findPartition(rank, &begin, &end);
+    if (end - begin == 1)
+        return m_samples.at(rank);
+
+    // Large partitions are first split a window away from the rank, so that the next selections
+    // of a rank moved by an append stay within the window
+    const int window = sampleWindow();
+    if (end - begin > 4 * window) {
+        if (rank - window > begin) {
+            splitSamples(rank - window, begin, end, true);
+            begin = rank - window;
+        }
+        if (rank + window + 1 < end) {
+            splitSamples(rank + window + 1, begin, end, true);
+            end = rank + window + 1;
+        }
+    }
+
+    splitSamples(rank, begin, end, false);
+    if (rank + 1 < end)
+        addSampleBound(rank + 1, m_samples.at(rank), false);
+    return m_samples.at(rank);
+}
+
+// Finds the partition of the kept samples that contains the position
+void QBoxSetPrivate::findPartition(int position, int *begin, int *end) const
+{
+    int index = 0;
+    while (index < m_sampleBounds.count() && m_sampleBounds.at(index).position <= position)
+        index++;
+    *begin = index > 0 ? m_sampleBounds.at(index - 1).position : 0;
+    *end = index < m_sampleBounds.count() ? m_sampleBounds.at(index).position : m_samples.count();
+}
+
+// Partitions the samples between begin and end around the position and bounds them there
+void QBoxSetPrivate::splitSamples(int position, int begin, int end, bool guard)
+{
+    qreal *samples = m_samples.data();
+    std::nth_element(samples + begin, samples + position, samples + end);
+    if (position > begin)
+        addSampleBound(position, samples[position], guard);
+}
+
+void QBoxSetPrivate::addSampleBound(int position, qreal separator, bool guard)
+{
+    int index = 0;
+    while (index < m_sampleBounds.count() && m_sampleBounds.at(index).position < position)
+        index++;
+    BoxSampleBound bound = { position, separator, guard };
+    m_sampleBounds.insert(index, bound);
+}
+
+// Keeps the bounds of the selected ranks and the guard bounds near them. Every bound costs a
+// swap for each appended sample that is smaller than its separator.
+void QBoxSetPrivate::pruneSampleBounds(const QVector<int> &ranks)
+{
+    const int window = sampleWindow();
+    QVector<BoxSampleBound> bounds;
+    foreach (const BoxSampleBound &bound, m_sampleBounds) {
+        foreach (int rank, ranks) {
+            const int distance = bound.position - rank;
+            if (bound.guard ? qAbs(distance) <= 3 * window : (distance == 0 || distance == 1)) {
+                bounds.append(bound);
+                break;
+            }
+        }
+    }
+    m_sampleBounds = bounds;
+}
+
+int QBoxSetPrivate::sampleWindow() const
+{
+    return qMax(32, qCeil(qSqrt(qreal(m_samples.count()))));
+}
+
+// Switches to estimating the values with the P-square algorithm of Jain and Chlamtac, which keeps
+// five markers in place of the samples: at the extremes, the quartiles and the median. The
+// markers start at the values calculated from the kept samples, which are released.
+void QBoxSetPrivate::startSketch()
+{
+    const qreal last = m_sampleCount - 1;
+    for (int i = 0; i < 5; i++) {
+        m_markerHeights[i] = m_values[i];
+        m_desiredPositions[i] = 1 + last * i / 4.0;
+        m_markerPositions[i] = qRound(m_desiredPositions[i]);
+    }
+    m_samples.clear();
+    m_samples.squeeze();
+    m_sampleBounds.clear();
+    m_sketching = true;
+}
+
+void QBoxSetPrivate::addToSketch(qreal sample)
+{
+    qreal *heights = m_markerHeights;
+    qreal *positions = m_markerPositions;
+
+    int cell = 0;
+    if (sample < heights[0]) {
+        heights[0] = sample;
+    } else if (sample >= heights[4]) {
+        heights[4] = sample;
+        cell = 3;
+    } else {
+        while (sample >= heights[cell + 1])
+            cell++;
+    }
+    for (int i = cell + 1; i < 5; i++)
+        positions[i]++;
+    for (int i = 0; i < 5; i++)
+        m_desiredPositions[i] += i / 4.0;
+
+    // Moves the inner markers that are a position or more off their desired position by one
+    // position, along the parabola through the neighbouring markers when it keeps the heights
+    // in order, and along the line to the neighbour otherwise
+    for (int i = 1; i < 4; i++) {
+        const qreal offset = m_desiredPositions[i] - positions[i];
+        if ((offset >= 1 && positions[i + 1] - positions[i] > 1)
+                || (offset <= -1 && positions[i - 1] - positions[i] < -1)) {
+            const int step = offset > 0 ? 1 : -1;
+            const qreal height = heights[i] + step / (positions[i + 1] - positions[i - 1])
+                    * ((positions[i] - positions[i - 1] + step) * (heights[i + 1] - heights[i])
+                       / (positions[i + 1] - positions[i])
+                       + (positions[i + 1] - positions[i] - step) * (heights[i] - heights[i - 1])
+                       / (positions[i] - positions[i - 1]));
+            if (heights[i - 1] < height && height < heights[i + 1])
+                heights[i] = height;
+            else
+                heights[i] += step * (heights[i + step] - heights[i])
+                        / (positions[i + step] - positions[i]);
+            positions[i] += step;
+        }
+    }
+}
+
 qreal QBoxSetPrivate::value(const int index)
 {
     if (index < 0 || index >= m_valuesCount)
@@ -34,6 +34,7 @@
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
 #include <QtGui/QFont>
+#include <QtCore/QVector>
 
 QT_CHARTS_BEGIN_NAMESPACE
 class QBoxSetPrivate;
@@ -61,6 +62,12 @@ public:
     void append(const qreal value);
     void append(const QList<qreal> &values);
 
+    void setSamples(const QVector<qreal> &samples);
+    void appendSamples(const QVector<qreal> &samples);
+    int sampleCount() const;
+    void setSampleSketchThreshold(int count);
+    int sampleSketchThreshold() const;
+
     void clear();
 
     void setLabel(const QString label);
@@ -41,6 +41,7 @@
 
 #include <QtCharts/QBoxSet>
 #include <QtCore/QMap>
+#include <QtCore/QVector>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
 #include <QtGui/QFont>
@@ -49,6 +50,15 @@ QT_CHARTS_BEGIN_NAMESPACE
 
 class QBoxPlotSeriesPrivate;
 
+// Splits the kept samples in two: the samples before the position are not greater than the
+// separator and the samples from the position on are not smaller than it
+struct BoxSampleBound
+{
+    int position;
+    qreal separator;
+    bool guard; // Bounds a window around a selected value, instead of the value itself
+};
+
 class QBoxSetPrivate : public QObject
 {
     Q_OBJECT
@@ -65,8 +75,24 @@ public:
 
     void setValue(const int index, const qreal value);
 
+    bool appendSamples(const QVector<qreal> &samples);
+    void updateFromSamples();
+    void clearSamples();
+    void startSketch();
+
     qreal value(const int index);
 
+private:
+    void insertSample(qreal sample);
+    void addToSketch(qreal sample);
+    qreal selectMedian(int begin, int count, QVector<int> *ranks);
+    qreal selectSample(int rank);
+    void findPartition(int position, int *begin, int *end) const;
+    void splitSamples(int position, int begin, int end, bool guard);
+    void addSampleBound(int position, qreal separator, bool guard);
+    void pruneSampleBounds(const QVector<int> &ranks);
+    int sampleWindow() const;
+
 Q_SIGNALS:
     void restructuredBox();
     void updatedBox();
@@ -78,6 +104,16 @@ private:
     const int m_valuesCount;
     qreal *m_values;
     int m_appendCount;
+    QVector<qreal> m_samples;
+    QVector<BoxSampleBound> m_sampleBounds;
+    int m_sampleCount;
+    qreal m_sampleMinimum;
+    qreal m_sampleMaximum;
+    int m_sketchThreshold;
+    bool m_sketching;
+    qreal m_markerHeights[5];
+    qreal m_markerPositions[5];
+    qreal m_desiredPositions[5];
     QPen m_pen;
     QBrush m_brush;
     QBrush m_labelBrush;
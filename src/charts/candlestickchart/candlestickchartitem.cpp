@@ -34,6 +34,11 @@
 #include <private/candlestickdata_p.h>
 #include <private/qcandlestickseries_p.h>
 #include <private/candlestickanimation_p.h>
+#include <private/qchart_p.h>
+#include <QtCore/QtMath>
+#include <QtGui/QPainter>
+#include <QtWidgets/QGraphicsSceneMouseEvent>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -43,8 +48,16 @@ CandlestickChartItem::CandlestickChartItem(QCandlestickSeries *series, QGraphics
       m_seriesIndex(0),
       m_seriesCount(0),
       m_timePeriod(0.0),
-      m_animation(nullptr)
+      m_animation(nullptr),
+      m_bucketed(false),
+      m_paintedWidth(0.0),
+      m_hoveredIndex(-1),
+      m_pressedIndex(-1)
 {
+    // Only the painted candlesticks of rows are part of the shape, see shape()
+    setAcceptHoverEvents(true);
+    setAcceptedMouseButtons(Qt::MouseButtonMask);
+
     connect(series, SIGNAL(candlestickSetsAdded(QList<QCandlestickSet *>)),
             this, SLOT(handleCandlestickSetsAdd(QList<QCandlestickSet *>)));
     connect(series, SIGNAL(candlestickSetsRemoved(QList<QCandlestickSet *>)),
@@ -54,10 +67,16 @@ CandlestickChartItem::CandlestickChartItem(QCandlestickSeries *series, QGraphics
     connect(series->d_func(), SIGNAL(updatedLayout()), this, SLOT(handleLayoutUpdated()));
     connect(series->d_func(), SIGNAL(updatedCandlesticks()),
             this, SLOT(handleCandlesticksUpdated()));
+    connect(series->d_func(), SIGNAL(rowsAdded(int, int)), this, SLOT(handleRowsAdd(int, int)));
+    connect(series->d_func(), SIGNAL(rowsMaterialized(QList<QCandlestickSet *>)),
+            this, SLOT(handleRowsMaterialize(QList<QCandlestickSet *>)));
+    connect(series->d_func(), SIGNAL(rowsCleared()), this, SLOT(handleRowsClear()));
 
     setZValue(ChartPresenter::CandlestickSeriesZValue);
 
-    handleCandlestickSetsAdd(m_series->sets());
+    handleCandlestickSetsAdd(m_series->d_func()->m_sets);
+    if (!m_series->d_func()->m_rows.isEmpty())
+        handleRowsAdd(0, m_series->d_func()->m_rows.count());
 }
 
 CandlestickChartItem::~CandlestickChartItem()
@@ -81,12 +100,190 @@ QRectF CandlestickChartItem::boundingRect() const
     return m_boundingRect;
 }
 
+// The item itself only reacts to the mouse on the candlesticks of rows, as sets have their own
+// candlestick items and merged candlesticks belong to no single item
+QPainterPath CandlestickChartItem::shape() const
+{
+    QPainterPath path;
+    if (m_bucketed)
+        return path;
+
+    foreach (const CandlestickValues &values, m_painted) {
+        QRectF body;
+        qreal high;
+        qreal low;
+        if (paintedGeometry(values, body, high, low))
+            path.addRect(QRectF(body.left(), high, body.width(), low - high) | body);
+    }
+    return path;
+}
+
 void CandlestickChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                                  QWidget *widget)
 {
-    Q_UNUSED(painter);
     Q_UNUSED(option);
     Q_UNUSED(widget);
+
+    if (m_painted.isEmpty())
+        return;
+
+    // Painted candlesticks use the series pen and brush, like sets that don't define their own
+    QBrush increasingBrush(m_series->brush());
+    increasingBrush.setColor(m_series->increasingColor());
+    QBrush decreasingBrush(m_series->brush());
+    decreasingBrush.setColor(m_series->decreasingColor());
+    const QPen pen = m_series->pen();
+    const QPen bodyPen = m_series->bodyOutlineVisible() ? pen : QPen(Qt::NoPen);
+
+    painter->save();
+    painter->setClipRect(m_boundingRect);
+    foreach (const CandlestickValues &values, m_painted) {
+        const qreal upperBody = qMax(values.open, values.close);
+        const qreal lowerBody = qMin(values.open, values.close);
+        QRectF body;
+        qreal high;
+        qreal low;
+        if (!paintedGeometry(values, body, high, low))
+            continue;
+
+        painter->setPen(pen);
+        const qreal center = body.center().x();
+        if (values.high > upperBody)
+            painter->drawLine(QPointF(center, high), QPointF(center, body.top()));
+        if (values.low < lowerBody)
+            painter->drawLine(QPointF(center, body.bottom()), QPointF(center, low));
+        if (m_series->capsVisible() && !m_bucketed) {
+            const qreal capsHalf = body.width() * m_series->capsWidth() / 2.0;
+            if (values.high > upperBody)
+                painter->drawLine(QPointF(center - capsHalf, high), QPointF(center + capsHalf, high));
+            if (values.low < lowerBody)
+                painter->drawLine(QPointF(center - capsHalf, low), QPointF(center + capsHalf, low));
+        }
+        painter->setPen(bodyPen);
+        painter->setBrush(values.open < values.close ? increasingBrush : decreasingBrush);
+        painter->drawRect(body);
+    }
+    painter->restore();
+}
+
+// Calculates the body rectangle and the wick ends of a painted candlestick
+bool CandlestickChartItem::paintedGeometry(const CandlestickValues &values, QRectF &body,
+                                           qreal &high, qreal &low) const
+{
+    const qreal halfBody = m_series->bodyWidth() * m_paintedWidth / 2.0;
+    const qreal upperBody = qMax(values.open, values.close);
+    const qreal lowerBody = qMin(values.open, values.close);
+
+    bool validData;
+    const QPointF topLeft = domain()->calculateGeometryPoint(
+                QPointF(values.position - halfBody, upperBody), validData);
+    if (!validData)
+        return false;
+    const QPointF bottomRight = domain()->calculateGeometryPoint(
+                QPointF(values.position + halfBody, lowerBody), validData);
+    if (!validData)
+        return false;
+    high = domain()->calculateGeometryPoint(QPointF(values.position, values.high), validData).y();
+    if (!validData)
+        return false;
+    low = domain()->calculateGeometryPoint(QPointF(values.position, values.low), validData).y();
+    if (!validData)
+        return false;
+
+    body = QRectF(topLeft, bottomRight);
+    if (!m_bucketed) {
+        // Candlesticks of rows are as wide as candlestick items would be
+        const qreal maximumWidth = m_series->maximumColumnWidth();
+        const qreal minimumWidth = m_series->minimumColumnWidth();
+        const qreal center = body.center().x();
+        if (maximumWidth != -1.0 && body.width() > maximumWidth)
+            body.setWidth(maximumWidth);
+        if (minimumWidth != -1.0 && body.width() < minimumWidth)
+            body.setWidth(minimumWidth);
+        body.moveLeft(center - body.width() / 2.0);
+    }
+    return true;
+}
+
+// Returns the series index of the painted candlestick of a row at pos, or -1
+int CandlestickChartItem::paintedCandlestickAt(const QPointF &pos) const
+{
+    if (m_bucketed)
+        return -1;
+
+    foreach (const CandlestickValues &values, m_painted) {
+        QRectF body;
+        qreal high;
+        qreal low;
+        if (paintedGeometry(values, body, high, low)
+            && (QRectF(body.left(), high, body.width(), low - high) | body).contains(pos)) {
+            return values.index;
+        }
+    }
+    return -1;
+}
+
+void CandlestickChartItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
+{
+    hoverMoveEvent(event);
+}
+
+void CandlestickChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    const int index = paintedCandlestickAt(event->pos());
+    if (index == m_hoveredIndex)
+        return;
+
+    if (m_hoveredIndex != -1)
+        emit m_series->candlestickHovered(false, m_hoveredIndex);
+    m_hoveredIndex = index;
+    if (m_hoveredIndex != -1)
+        emit m_series->candlestickHovered(true, m_hoveredIndex);
+}
+
+void CandlestickChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    Q_UNUSED(event)
+
+    if (m_hoveredIndex != -1)
+        emit m_series->candlestickHovered(false, m_hoveredIndex);
+    m_hoveredIndex = -1;
+}
+
+void CandlestickChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    m_pressedIndex = paintedCandlestickAt(event->pos());
+    if (m_pressedIndex == -1) {
+        event->ignore();
+        return;
+    }
+
+    emit m_series->candlestickPressed(m_pressedIndex);
+}
+
+void CandlestickChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
+{
+    Q_UNUSED(event)
+
+    if (m_pressedIndex == -1)
+        return;
+
+    emit m_series->candlestickReleased(m_pressedIndex);
+    emit m_series->candlestickClicked(m_pressedIndex);
+    m_pressedIndex = -1;
+}
+
+void CandlestickChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = paintedCandlestickAt(event->pos());
+    if (index == -1) {
+        event->ignore();
+        return;
+    }
+
+    // As for candlestick items, a pressed signal needs to be explicitly fired for double-clicks
+    emit m_series->candlestickPressed(index);
+    emit m_series->candlestickDoubleClicked(index);
 }
 
 void CandlestickChartItem::handleDomainUpdated()
@@ -98,6 +295,10 @@ void CandlestickChartItem::handleDomainUpdated()
     // as 0.0 would snip a bit off from the wick at the grid line.
     m_boundingRect.setRect(0.0, -1.0, domain()->size().width(), domain()->size().height() + 1.0);
 
+    updatePaintedCandlesticks();
+    if (m_bucketed)
+        return;
+
     foreach (Candlestick *item, m_candlesticks.values()) {
         item->updateGeometry(domain());
 
@@ -113,6 +314,8 @@ void CandlestickChartItem::handleLayoutUpdated()
         qreal oldTimestamp = m_candlesticks.value(set)->m_data.m_timestamp;
         qreal newTimestamp = set->timestamp();
         if (Q_UNLIKELY(oldTimestamp != newTimestamp)) {
+            m_setIndex.remove(oldTimestamp, set);
+            m_setIndex.insert(newTimestamp, set);
             removeTimestamp(oldTimestamp);
             addTimestamp(newTimestamp);
             timestampChanged = true;
@@ -121,6 +324,8 @@ void CandlestickChartItem::handleLayoutUpdated()
     if (timestampChanged)
         updateTimePeriod();
 
+    updatePaintedCandlesticks();
+
     foreach (Candlestick *item, m_candlesticks.values()) {
         if (m_animation)
             m_animation->setAnimationStart(item);
@@ -132,6 +337,8 @@ void CandlestickChartItem::handleLayoutUpdated()
         item->setCapsWidth(m_series->capsWidth());
 
         bool dirty = updateCandlestickGeometry(item, item->m_data.m_index);
+        if (m_bucketed)
+            continue;
         if (dirty && m_animation)
             presenter()->startAnimation(m_animation->candlestickChangeAnimation(item));
         else
@@ -143,6 +350,8 @@ void CandlestickChartItem::handleCandlesticksUpdated()
 {
     foreach (QCandlestickSet *set, m_candlesticks.keys())
         updateCandlestickAppearance(m_candlesticks.value(set), set);
+    if (!m_painted.isEmpty())
+        update();
 }
 
 void CandlestickChartItem::handleCandlestickSeriesChange()
@@ -183,7 +392,9 @@ void CandlestickChartItem::handleCandlestickSetsAdd(const QList<QCandlestickSet
         }
 
         item = new Candlestick(set, domain(), this);
+        item->setVisible(!m_bucketed);
         m_candlesticks.insert(set, item);
+        m_setIndex.insert(set->timestamp(), set);
         addTimestamp(set->timestamp());
 
         connect(item, SIGNAL(clicked(QCandlestickSet *)),
@@ -201,6 +412,16 @@ void CandlestickChartItem::handleCandlestickSetsAdd(const QList<QCandlestickSet
         connect(item, SIGNAL(pressed(QCandlestickSet *)), set, SIGNAL(pressed()));
         connect(item, SIGNAL(released(QCandlestickSet *)), set, SIGNAL(released()));
         connect(item, SIGNAL(doubleClicked(QCandlestickSet *)), set, SIGNAL(doubleClicked()));
+        connect(item, SIGNAL(clicked(QCandlestickSet *)),
+                this, SLOT(handleCandlestickClicked(QCandlestickSet *)));
+        connect(item, SIGNAL(hovered(bool, QCandlestickSet *)),
+                this, SLOT(handleCandlestickHovered(bool, QCandlestickSet *)));
+        connect(item, SIGNAL(pressed(QCandlestickSet *)),
+                this, SLOT(handleCandlestickPressed(QCandlestickSet *)));
+        connect(item, SIGNAL(released(QCandlestickSet *)),
+                this, SLOT(handleCandlestickReleased(QCandlestickSet *)));
+        connect(item, SIGNAL(doubleClicked(QCandlestickSet *)),
+                this, SLOT(handleCandlestickDoubleClicked(QCandlestickSet *)));
     }
 
     handleDataStructureChanged();
@@ -212,7 +433,8 @@ void CandlestickChartItem::handleCandlestickSetsRemove(const QList<QCandlestickS
         Candlestick *item = m_candlesticks.value(set);
 
         m_candlesticks.remove(set);
-        removeTimestamp(set->timestamp());
+        m_setIndex.remove(item->m_data.m_timestamp, set);
+        removeTimestamp(item->m_data.m_timestamp);
 
         if (m_animation) {
             ChartAnimation *animation = m_animation->candlestickAnimation(item);
@@ -232,14 +454,16 @@ void CandlestickChartItem::handleDataStructureChanged()
 {
     updateTimePeriod();
 
-    for (int i = 0; i < m_series->count(); ++i) {
-        QCandlestickSet *set = m_series->sets().at(i);
+    const QList<QCandlestickSet *> &sets = m_series->d_func()->m_sets;
+    for (int i = 0; i < sets.count(); ++i) {
+        QCandlestickSet *set = sets.at(i);
         Candlestick *item = m_candlesticks.value(set);
 
         updateCandlestickGeometry(item, i);
         updateCandlestickAppearance(item, set);
 
-        item->updateGeometry(domain());
+        if (!m_bucketed)
+            item->updateGeometry(domain());
 
         if (m_animation)
             m_animation->addCandlestick(item);
@@ -252,7 +476,7 @@ bool CandlestickChartItem::updateCandlestickGeometry(Candlestick *item, int inde
 {
     bool changed = false;
 
-    QCandlestickSet *set = m_series->sets().at(index);
+    QCandlestickSet *set = m_series->d_func()->m_sets.at(index);
     CandlestickData &data = item->m_data;
 
     if ((data.m_open != set->open())
@@ -306,40 +530,276 @@ void CandlestickChartItem::updateCandlestickAppearance(Candlestick *item, QCandl
         item->setPen(set->pen());
 }
 
-void CandlestickChartItem::addTimestamp(qreal timestamp)
+void CandlestickChartItem::handleRowsAdd(int index, int count)
 {
-    int index = 0;
-    for (int i = m_timestamps.count() - 1; i >= 0; --i) {
-        if (timestamp > m_timestamps.at(i)) {
-            index = i + 1;
+    const QVector<CandlestickRow> &rows = m_series->d_func()->m_rows;
+    for (int i = index; i < index + count; ++i) {
+        const qreal timestamp = rows.at(i).timestamp;
+        m_rowIndex.insert(timestamp, i);
+        addTimestamp(timestamp);
+    }
+
+    handleDataStructureChanged();
+}
+
+void CandlestickChartItem::handleRowsMaterialize(const QList<QCandlestickSet *> &sets)
+{
+    removeRows();
+    handleCandlestickSetsAdd(sets);
+}
+
+void CandlestickChartItem::handleRowsClear()
+{
+    removeRows();
+    handleDataStructureChanged();
+}
+
+// Candlestick items report their sets, the index based signals of the series need their index
+void CandlestickChartItem::handleCandlestickClicked(QCandlestickSet *set)
+{
+    emit m_series->candlestickClicked(m_candlesticks.value(set)->m_data.m_index);
+}
+
+void CandlestickChartItem::handleCandlestickHovered(bool status, QCandlestickSet *set)
+{
+    emit m_series->candlestickHovered(status, m_candlesticks.value(set)->m_data.m_index);
+}
+
+void CandlestickChartItem::handleCandlestickPressed(QCandlestickSet *set)
+{
+    emit m_series->candlestickPressed(m_candlesticks.value(set)->m_data.m_index);
+}
+
+void CandlestickChartItem::handleCandlestickReleased(QCandlestickSet *set)
+{
+    emit m_series->candlestickReleased(m_candlesticks.value(set)->m_data.m_index);
+}
+
+void CandlestickChartItem::handleCandlestickDoubleClicked(QCandlestickSet *set)
+{
+    emit m_series->candlestickDoubleClicked(m_candlesticks.value(set)->m_data.m_index);
+}
+
+void CandlestickChartItem::removeRows()
+{
+    // End the hover and press of a row, which no longer has a painted candlestick
+    if (m_hoveredIndex != -1)
+        emit m_series->candlestickHovered(false, m_hoveredIndex);
+    m_hoveredIndex = -1;
+    m_pressedIndex = -1;
+
+    QMultiMap<qreal, int>::const_iterator i = m_rowIndex.constBegin();
+    for (; i != m_rowIndex.constEnd(); ++i)
+        removeTimestamp(i.key());
+    m_rowIndex.clear();
+}
+
+QAbstractAxis::AxisType CandlestickChartItem::timeAxisType() const
+{
+    if (!m_series->chart())
+        return QAbstractAxis::AxisTypeNoAxis;
+
+    const QList<QAbstractAxis *> axes = m_series->chart()->axes(Qt::Horizontal, m_series);
+    if (axes.isEmpty() || !axes.first())
+        return QAbstractAxis::AxisTypeNoAxis;
+
+    return axes.first()->type();
+}
+
+// Returns the candlesticks within the visible range in position order, the ones of the rows and
+// optionally also the ones of the sets
+QVector<CandlestickChartItem::CandlestickValues>
+CandlestickChartItem::visibleCandlesticks(qreal minX, qreal maxX, bool includeSets) const
+{
+    QVector<CandlestickValues> visible;
+    const QList<QCandlestickSet *> &sets = m_series->d_func()->m_sets;
+    const QVector<CandlestickRow> &rows = m_series->d_func()->m_rows;
+
+    switch (timeAxisType()) {
+    case QAbstractAxis::AxisTypeBarCategory: {
+        // Rows follow the sets
+        const qreal columnWidth = 1.0 / qMax(m_seriesCount, 1);
+        const qreal offset = m_seriesIndex * columnWidth + columnWidth / 2.0 - 0.5;
+        const int first = qMax(qCeil(minX - offset), includeSets ? 0 : sets.count());
+        const int last = qMin(qFloor(maxX - offset), sets.count() + rows.count() - 1);
+        for (int i = first; i <= last; ++i) {
+            CandlestickValues values;
+            values.position = i + offset;
+            values.index = i;
+            if (i < sets.count()) {
+                QCandlestickSet *set = sets.at(i);
+                values.open = set->open();
+                values.high = set->high();
+                values.low = set->low();
+                values.close = set->close();
+            } else {
+                const CandlestickRow &row = rows.at(i - sets.count());
+                values.open = row.open;
+                values.high = row.high;
+                values.low = row.low;
+                values.close = row.close;
+            }
+            visible.append(values);
+        }
+        break;
+    }
+    case QAbstractAxis::AxisTypeDateTime:
+    case QAbstractAxis::AxisTypeValue: {
+        QMultiMap<qreal, int>::const_iterator row = m_rowIndex.lowerBound(minX);
+        const QMultiMap<qreal, int>::const_iterator rowsEnd = m_rowIndex.upperBound(maxX);
+        for (; row != rowsEnd; ++row) {
+            const CandlestickRow &values = rows.at(row.value());
+            const CandlestickValues rowValues = { values.timestamp, values.open, values.high,
+                                                  values.low, values.close,
+                                                  sets.count() + row.value() };
+            visible.append(rowValues);
+        }
+        if (!includeSets)
             break;
+
+        const int rowCount = visible.count();
+        QMultiMap<qreal, QCandlestickSet *>::const_iterator set = m_setIndex.lowerBound(minX);
+        const QMultiMap<qreal, QCandlestickSet *>::const_iterator setsEnd =
+                m_setIndex.upperBound(maxX);
+        for (; set != setsEnd; ++set) {
+            const CandlestickValues setValues = { set.key(), set.value()->open(),
+                                                  set.value()->high(), set.value()->low(),
+                                                  set.value()->close(), -1 };
+            visible.append(setValues);
+        }
+        if (rowCount > 0 && rowCount < visible.count()) {
+            std::inplace_merge(visible.begin(), visible.begin() + rowCount, visible.end(),
+                               [](const CandlestickValues &a, const CandlestickValues &b) {
+                return a.position < b.position;
+            });
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return visible;
+}
+
+// Candlesticks of rows have no candlestick items, so this item paints the visible ones. When
+// there are more candlesticks in the visible range than there are pixels, the candlesticks of
+// each pixel wide bucket are merged into one, which this item paints instead of all candlesticks.
+// A merged candlestick keeps the open of its first and the close of its last candlestick and the
+// extremes of all of them.
+void CandlestickChartItem::updatePaintedCandlesticks()
+{
+    const bool wasBucketed = m_bucketed;
+    m_bucketed = false;
+    m_painted.clear();
+
+    const qreal width = domain()->size().width();
+    const qreal minX = domain()->minX();
+    const qreal maxX = domain()->maxX();
+    if (width >= 1.0 && maxX > minX && m_series->count() > width) {
+        const QVector<CandlestickValues> visible = visibleCandlesticks(minX, maxX, true);
+        if (visible.count() > width) {
+            // Buckets are aligned to multiples of their width, so that scrolling doesn't move
+            // candlesticks from one bucket to another
+            m_bucketed = true;
+            m_paintedWidth = (maxX - minX) / qFloor(width);
+            const int firstBucket = qFloor(minX / m_paintedWidth);
+            const int bucketCount = qFloor(maxX / m_paintedWidth) - firstBucket + 1;
+            int bucket = -1;
+            foreach (const CandlestickValues &values, visible) {
+                const int index = qBound(0, qFloor(values.position / m_paintedWidth) - firstBucket,
+                                         bucketCount - 1);
+                if (index != bucket) {
+                    bucket = index;
+                    m_painted.append(values);
+                    m_painted.last().position = (firstBucket + index + 0.5) * m_paintedWidth;
+                    m_painted.last().index = -1;
+                    continue;
+                }
+                CandlestickValues &merged = m_painted.last();
+                merged.high = qMax(merged.high, values.high);
+                merged.low = qMin(merged.low, values.low);
+                merged.close = values.close;
+            }
         }
     }
-    m_timestamps.insert(index, timestamp);
+
+    if (!m_bucketed && !m_rowIndex.isEmpty() && maxX > minX) {
+        m_painted = visibleCandlesticks(minX, maxX, false);
+        m_paintedWidth = timeAxisType() == QAbstractAxis::AxisTypeBarCategory
+                ? 1.0 / qMax(m_seriesCount, 1) : m_timePeriod;
+    }
+
+    if (m_bucketed != wasBucketed) {
+        foreach (Candlestick *item, m_candlesticks.values())
+            item->setVisible(!m_bucketed);
+    }
+    update();
+}
+
+// Distinct timestamps are kept in a sorted map, and the gaps between adjacent ones in a multiset,
+// so that the time period is available without rescanning the timestamps
+void CandlestickChartItem::addTimestamp(qreal timestamp)
+{
+    QMap<qreal, int>::iterator i = m_timestamps.find(timestamp);
+    if (i != m_timestamps.end()) {
+        i.value()++;
+        return;
+    }
+
+    i = m_timestamps.insert(timestamp, 1);
+    const bool hasPrevious = i != m_timestamps.begin();
+    const bool hasNext = (i + 1) != m_timestamps.end();
+    const qreal previous = hasPrevious ? (i - 1).key() : 0.0;
+    const qreal next = hasNext ? (i + 1).key() : 0.0;
+
+    if (hasPrevious && hasNext)
+        removeTimeGap(next - previous);
+    if (hasPrevious)
+        m_timeGaps[timestamp - previous]++;
+    if (hasNext)
+        m_timeGaps[next - timestamp]++;
 }
 
 void CandlestickChartItem::removeTimestamp(qreal timestamp)
 {
-    m_timestamps.removeOne(timestamp);
+    QMap<qreal, int>::iterator i = m_timestamps.find(timestamp);
+    if (i == m_timestamps.end() || --i.value() > 0)
+        return;
+
+    const bool hasPrevious = i != m_timestamps.begin();
+    const bool hasNext = (i + 1) != m_timestamps.end();
+    const qreal previous = hasPrevious ? (i - 1).key() : 0.0;
+    const qreal next = hasNext ? (i + 1).key() : 0.0;
+    m_timestamps.erase(i);
+
+    if (hasPrevious)
+        removeTimeGap(timestamp - previous);
+    if (hasNext)
+        removeTimeGap(next - timestamp);
+    if (hasPrevious && hasNext)
+        m_timeGaps[next - previous]++;
+}
+
+void CandlestickChartItem::removeTimeGap(qreal gap)
+{
+    QMap<qreal, int>::iterator i = m_timeGaps.find(gap);
+    if (i != m_timeGaps.end() && --i.value() == 0)
+        m_timeGaps.erase(i);
 }
 
 void CandlestickChartItem::updateTimePeriod()
 {
-    if (m_timestamps.count() == 0) {
+    if (m_timestamps.isEmpty()) {
         m_timePeriod = 0;
         return;
     }
 
-    if (m_timestamps.count() == 1) {
+    if (m_timeGaps.isEmpty()) {
         m_timePeriod = qAbs(domain()->maxX() - domain()->minX());
         return;
     }
 
-    qreal timePeriod = qAbs(m_timestamps.at(1) - m_timestamps.at(0));
-    for (int i = 1; i < m_timestamps.count(); ++i) {
-        timePeriod = qMin(timePeriod, qAbs(m_timestamps.at(i) - m_timestamps.at(i - 1)));
-    }
-    m_timePeriod = timePeriod;
+    m_timePeriod = m_timeGaps.firstKey();
 }
 
 #include "moc_candlestickchartitem_p.cpp"
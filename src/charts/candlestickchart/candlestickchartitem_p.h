@@ -40,6 +40,9 @@
 #define CANDLESTICKCHARTITEM_P_H
 
 #include <private/chartitem_p.h>
+#include <QtCharts/QAbstractAxis>
+#include <QtCore/QMap>
+#include <QtCore/QVector>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -59,6 +62,7 @@ public:
     void setAnimation(CandlestickAnimation *animation);
 
     QRectF boundingRect() const;
+    QPainterPath shape() const;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
 
 public Q_SLOTS:
@@ -71,13 +75,50 @@ private Q_SLOTS:
     void handleCandlestickSetsAdd(const QList<QCandlestickSet *> &sets);
     void handleCandlestickSetsRemove(const QList<QCandlestickSet *> &sets);
     void handleDataStructureChanged();
+    void handleRowsAdd(int index, int count);
+    void handleRowsMaterialize(const QList<QCandlestickSet *> &sets);
+    void handleRowsClear();
+    void handleCandlestickClicked(QCandlestickSet *set);
+    void handleCandlestickHovered(bool status, QCandlestickSet *set);
+    void handleCandlestickPressed(QCandlestickSet *set);
+    void handleCandlestickReleased(QCandlestickSet *set);
+    void handleCandlestickDoubleClicked(QCandlestickSet *set);
+
+protected:
+    // Values of a candlestick painted by this item instead of a candlestick item
+    struct CandlestickValues
+    {
+        qreal position;
+        qreal open;
+        qreal high;
+        qreal low;
+        qreal close;
+        int index; // Index in the series, or -1 for merged candlesticks
+    };
+
+    // Mouse events of the painted candlesticks of rows
+    void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event);
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
+    void mousePressEvent(QGraphicsSceneMouseEvent *event);
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
 
 private:
     bool updateCandlestickGeometry(Candlestick *item, int index);
     void updateCandlestickAppearance(Candlestick *item, QCandlestickSet *set);
 
+    QAbstractAxis::AxisType timeAxisType() const;
+    QVector<CandlestickValues> visibleCandlesticks(qreal minX, qreal maxX, bool includeSets) const;
+    void updatePaintedCandlesticks();
+    bool paintedGeometry(const CandlestickValues &values, QRectF &body, qreal &high,
+                         qreal &low) const;
+    int paintedCandlestickAt(const QPointF &pos) const;
+    void removeRows();
+
     void addTimestamp(qreal timestamp);
     void removeTimestamp(qreal timestamp);
+    void removeTimeGap(qreal gap);
     void updateTimePeriod();
 
 protected:
@@ -86,9 +127,21 @@ protected:
     int m_seriesIndex;
     int m_seriesCount;
     QHash<QCandlestickSet *, Candlestick *> m_candlesticks;
-    QList<qreal> m_timestamps;
+    // Sets and rows of the series by timestamp
+    QMultiMap<qreal, QCandlestickSet *> m_setIndex;
+    QMultiMap<qreal, int> m_rowIndex;
+    // Distinct timestamps with their count, and the gaps between adjacent ones with their count
+    QMap<qreal, int> m_timestamps;
+    QMap<qreal, int> m_timeGaps;
     qreal m_timePeriod;
     CandlestickAnimation *m_animation;
+    // Rows, or when there are more candlesticks than pixels, candlesticks merged into pixel wide
+    // buckets, are painted by this item
+    bool m_bucketed;
+    QVector<CandlestickValues> m_painted;
+    qreal m_paintedWidth;
+    int m_hoveredIndex;
+    int m_pressedIndex;
 };
 
 QT_CHARTS_END_NAMESPACE
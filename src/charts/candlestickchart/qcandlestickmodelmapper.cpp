@@ -32,6 +32,8 @@
 #include <QtCharts/QCandlestickSet>
 #include <QtCore/QAbstractItemModel>
 #include <private/qcandlestickmodelmapper_p.h>
+#include <private/qcandlestickseries_p.h>
+#include <private/qnumericcolumnaccess_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -62,6 +64,27 @@ QT_CHARTS_BEGIN_NAMESPACE
     specified, the old series is disconnected (preserving its data).
 */
 
+/*!
+    \property QCandlestickModelMapper::backgroundLoading
+    \brief Whether large models are read in the background.
+
+    When enabled, the initial read of a model that maps at least 10000 values, and the reread
+    after the model is reset, are done in a worker thread, so that the application stays
+    responsive. The series keeps its previous sets until all the values have been read. The new
+    sets are then created and appended to the series at once.
+
+    Only models that provide all the mapped sections with QNumericColumnAccess can be read in
+    the background, other models are always read at once through QAbstractItemModel::data().
+
+    When the model announces a change while it is being loaded, the mapper waits for the worker
+    thread, passes the sets to the series, and then applies the change. Changes to the series
+    restart the loading.
+
+    By default, background loading is disabled.
+
+    \sa isLoading(), loadingFinished()
+*/
+
 /*!
     \fn Qt::Orientation QCandlestickModelMapper::orientation() const
     Returns the orientation that is used when QCandlestickModelMapper accesses the model. This
@@ -81,6 +104,12 @@ QT_CHARTS_BEGIN_NAMESPACE
     \sa series
 */
 
+/*!
+    \fn void QCandlestickModelMapper::loadingFinished()
+    \brief Emitted when the sets read in the background have been passed to the series.
+    \sa backgroundLoading
+*/
+
 /*!
     Constructs a model mapper object as a child of \a parent.
 */
@@ -122,6 +151,17 @@ void QCandlestickModelMapper::setModel(QAbstractItemModel *model)
     connect(d->m_model, SIGNAL(columnsRemoved(QModelIndex, int, int)),
             d, SLOT(modelColumnsRemoved(QModelIndex, int, int)));
     connect(d->m_model, SIGNAL(destroyed()), d, SLOT(modelDestroyed()));
+    // the values read in the background must not change under the loader
+    connect(d->m_model, SIGNAL(rowsAboutToBeInserted(QModelIndex, int, int)),
+            d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(rowsAboutToBeRemoved(QModelIndex, int, int)),
+            d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(columnsAboutToBeInserted(QModelIndex, int, int)),
+            d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(columnsAboutToBeRemoved(QModelIndex, int, int)),
+            d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(modelAboutToBeReset()), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(layoutAboutToBeChanged()), d, SLOT(waitForLoading()));
 }
 
 QAbstractItemModel *QCandlestickModelMapper::model() const
@@ -163,6 +203,31 @@ QCandlestickSeries *QCandlestickModelMapper::series() const
     return d->m_series;
 }
 
+void QCandlestickModelMapper::setBackgroundLoading(bool enabled)
+{
+    Q_D(QCandlestickModelMapper);
+
+    d->m_backgroundLoading = enabled;
+}
+
+bool QCandlestickModelMapper::backgroundLoading() const
+{
+    Q_D(const QCandlestickModelMapper);
+
+    return d->m_backgroundLoading;
+}
+
+/*!
+    Returns true if the values of the model are being read in the background.
+    \sa backgroundLoading
+*/
+bool QCandlestickModelMapper::isLoading() const
+{
+    Q_D(const QCandlestickModelMapper);
+
+    return d->isLoading();
+}
+
 /*!
     Sets the row/column of the model that contains the \a timestamp values of the sets in the
     series. Default value is -1 (invalid mapping).
@@ -381,15 +446,29 @@ QCandlestickModelMapperPrivate::QCandlestickModelMapperPrivate(QCandlestickModel
       m_lastSetSection(-1),
       m_modelSignalsBlock(false),
       m_seriesSignalsBlock(false),
+      m_backgroundLoading(false),
+      m_loader(nullptr),
       q_ptr(q)
 {
 }
 
+QCandlestickModelMapperPrivate::~QCandlestickModelMapperPrivate()
+{
+    stopLoading();
+}
+
 void QCandlestickModelMapperPrivate::initializeCandlestickFromModel()
 {
+    Q_Q(QCandlestickModelMapper);
+
+    stopLoading();
+
     if (!m_model || !m_series)
         return;
 
+    if (m_backgroundLoading && startLoading())
+        return;
+
     blockSeriesSignals();
     // clear current content
     m_series->clear();
@@ -408,20 +487,20 @@ void QCandlestickModelMapperPrivate::initializeCandlestickFromModel()
             && highIndex.isValid()
             && lowIndex.isValid()
             && closeIndex.isValid()) {
-            QCandlestickSet *set = new QCandlestickSet();
-            set->setTimestamp(m_model->data(timestampIndex, Qt::DisplayRole).toReal());
-            set->setOpen(m_model->data(openIndex, Qt::DisplayRole).toReal());
-            set->setHigh(m_model->data(highIndex, Qt::DisplayRole).toReal());
-            set->setLow(m_model->data(lowIndex, Qt::DisplayRole).toReal());
-            set->setClose(m_model->data(closeIndex, Qt::DisplayRole).toReal());
-
-            connect(set, SIGNAL(timestampChanged()), this, SLOT(candlestickSetChanged()));
-            connect(set, SIGNAL(openChanged()), this, SLOT(candlestickSetChanged()));
-            connect(set, SIGNAL(highChanged()), this, SLOT(candlestickSetChanged()));
-            connect(set, SIGNAL(lowChanged()), this, SLOT(candlestickSetChanged()));
-            connect(set, SIGNAL(closeChanged()), this, SLOT(candlestickSetChanged()));
-
-            sets.append(set);
+            NumericSection section(m_model, q->orientation(), i);
+            const int lastPos = qMax(qMax(m_timestamp, m_open), qMax(qMax(m_high, m_low), m_close));
+            if (section.isValid() && lastPos < section.count()) {
+                sets.append(createCandlestickSet(section.at(m_timestamp), section.at(m_open),
+                                                 section.at(m_high), section.at(m_low),
+                                                 section.at(m_close)));
+            } else {
+                sets.append(createCandlestickSet(
+                                m_model->data(timestampIndex, Qt::DisplayRole).toReal(),
+                                m_model->data(openIndex, Qt::DisplayRole).toReal(),
+                                m_model->data(highIndex, Qt::DisplayRole).toReal(),
+                                m_model->data(lowIndex, Qt::DisplayRole).toReal(),
+                                m_model->data(closeIndex, Qt::DisplayRole).toReal()));
+            }
         } else {
             break;
         }
@@ -431,6 +510,116 @@ void QCandlestickModelMapperPrivate::initializeCandlestickFromModel()
     blockSeriesSignals(false);
 }
 
+QCandlestickSet *QCandlestickModelMapperPrivate::createCandlestickSet(qreal timestamp, qreal open,
+                                                                      qreal high, qreal low,
+                                                                      qreal close)
+{
+    QCandlestickSet *set = new QCandlestickSet();
+    set->setTimestamp(timestamp);
+    set->setOpen(open);
+    set->setHigh(high);
+    set->setLow(low);
+    set->setClose(close);
+
+    connect(set, SIGNAL(timestampChanged()), this, SLOT(candlestickSetChanged()));
+    connect(set, SIGNAL(openChanged()), this, SLOT(candlestickSetChanged()));
+    connect(set, SIGNAL(highChanged()), this, SLOT(candlestickSetChanged()));
+    connect(set, SIGNAL(lowChanged()), this, SLOT(candlestickSetChanged()));
+    connect(set, SIGNAL(closeChanged()), this, SLOT(candlestickSetChanged()));
+
+    return set;
+}
+
+// Starts reading the sets in a worker thread. Returns false if the model is read at once,
+// because it is small or does not provide numeric access to all the mapped sections.
+bool QCandlestickModelMapperPrivate::startLoading()
+{
+    Q_Q(QCandlestickModelMapper);
+
+    // Each set reads the range of positions its values are mapped to
+    const int firstPos = qMin(qMin(m_timestamp, m_open), qMin(qMin(m_high, m_low), m_close));
+    const int lastPos = qMax(qMax(m_timestamp, m_open), qMax(qMax(m_high, m_low), m_close));
+
+    ModelLoader *loader = new ModelLoader(this);
+    for (int i = m_firstSetSection; i <= m_lastSetSection; ++i) {
+        if (!candlestickModelIndex(i, m_timestamp).isValid()
+            || !candlestickModelIndex(i, m_open).isValid()
+            || !candlestickModelIndex(i, m_high).isValid()
+            || !candlestickModelIndex(i, m_low).isValid()
+            || !candlestickModelIndex(i, m_close).isValid()) {
+            break;
+        }
+        NumericSection section(m_model, q->orientation(), i);
+        if (!section.isValid() || lastPos >= section.count()) {
+            delete loader;
+            return false;
+        }
+        loader->addSection(section, firstPos, lastPos - firstPos + 1);
+    }
+
+    if (loader->sectionCount() * 5 < backgroundLoadingThreshold) {
+        delete loader;
+        return false;
+    }
+
+    m_loader = loader;
+    connect(m_loader, SIGNAL(finished()), this, SLOT(handleLoadingFinished()));
+    m_loader->start();
+    return true;
+}
+
+// Cancels the loading in progress. Returns true if the model was being loaded.
+bool QCandlestickModelMapperPrivate::stopLoading()
+{
+    if (!m_loader)
+        return false;
+
+    delete m_loader;
+    m_loader = nullptr;
+    return true;
+}
+
+void QCandlestickModelMapperPrivate::handleLoadingFinished()
+{
+    Q_Q(QCandlestickModelMapper);
+
+    // The finished() signal of a loader already handled by waitForLoading() is ignored
+    if (!m_loader || !m_loader->isFinished())
+        return;
+
+    const int firstPos = qMin(qMin(m_timestamp, m_open), qMin(qMin(m_high, m_low), m_close));
+    QList<QCandlestickSet *> sets;
+    for (int i = 0; i < m_loader->sectionCount(); ++i) {
+        const QVector<qreal> values = m_loader->values(i);
+        sets.append(createCandlestickSet(values.at(m_timestamp - firstPos),
+                                         values.at(m_open - firstPos),
+                                         values.at(m_high - firstPos),
+                                         values.at(m_low - firstPos),
+                                         values.at(m_close - firstPos)));
+    }
+    stopLoading();
+
+    blockSeriesSignals();
+    m_series->clear();
+    m_sets.clear();
+    m_series->append(sets);
+    m_sets.append(sets);
+    blockSeriesSignals(false);
+
+    emit q->loadingFinished();
+}
+
+// The model is about to change the values the loader reads: the sets are passed to the series
+// before the change is applied
+void QCandlestickModelMapperPrivate::waitForLoading()
+{
+    if (!m_loader)
+        return;
+
+    m_loader->wait();
+    handleLoadingFinished();
+}
+
 void QCandlestickModelMapperPrivate::modelDataUpdated(QModelIndex topLeft, QModelIndex bottomRight)
 {
     Q_Q(QCandlestickModelMapper);
@@ -441,6 +630,8 @@ void QCandlestickModelMapperPrivate::modelDataUpdated(QModelIndex topLeft, QMode
     if (m_modelSignalsBlock)
         return;
 
+    waitForLoading();
+
     blockSeriesSignals();
     QModelIndex index;
     for (int row = topLeft.row(); row <= bottomRight.row(); ++row) {
@@ -543,6 +734,7 @@ void QCandlestickModelMapperPrivate::modelColumnsRemoved(QModelIndex parent, int
 
 void QCandlestickModelMapperPrivate::modelDestroyed()
 {
+    stopLoading();
     m_model = 0;
 }
 
@@ -556,7 +748,8 @@ void QCandlestickModelMapperPrivate::candlestickSetsAdded(const QList<QCandlesti
     if (sets.isEmpty())
         return;
 
-    int firstIndex = m_series->sets().indexOf(sets.at(0));
+    // The sets were appended or inserted, look them up without turning rows into sets
+    int firstIndex = QCandlestickSeriesPrivate::get(m_series)->storedSets().indexOf(sets.at(0));
     if (firstIndex == -1)
         return;
 
@@ -617,12 +810,15 @@ void QCandlestickModelMapperPrivate::candlestickSetChanged()
     if (!set)
         return;
 
-    int section = m_series->sets().indexOf(set);
+    int section = m_sets.indexOf(set);
     if (section < 0)
         return;
 
     section += m_firstSetSection;
 
+    // The series doesn't have the model data yet, reread it after the change
+    const bool loading = isLoading();
+
     blockModelSignals();
     m_model->setData(candlestickModelIndex(section, m_timestamp), set->timestamp());
     m_model->setData(candlestickModelIndex(section, m_open), set->open());
@@ -630,10 +826,14 @@ void QCandlestickModelMapperPrivate::candlestickSetChanged()
     m_model->setData(candlestickModelIndex(section, m_low), set->low());
     m_model->setData(candlestickModelIndex(section, m_close), set->close());
     blockModelSignals(false);
+
+    if (loading)
+        initializeCandlestickFromModel();
 }
 
 void QCandlestickModelMapperPrivate::seriesDestroyed()
 {
+    stopLoading();
     m_series = 0;
 }
 
@@ -653,7 +853,7 @@ QCandlestickSet *QCandlestickModelMapperPrivate::candlestickSet(QModelIndex inde
     if (pos != m_timestamp && pos != m_open && pos != m_high && pos != m_low && pos != m_close)
         return 0; // This part of model has not been mapped to any candlestick set.
 
-    return m_series->sets().at(section - m_firstSetSection);
+    return m_sets.value(section - m_firstSetSection);
 }
 
 QModelIndex QCandlestickModelMapperPrivate::candlestickModelIndex(int section, int pos)
@@ -692,6 +892,10 @@ void QCandlestickModelMapperPrivate::removeData(int start, int end)
 
 void QCandlestickModelMapperPrivate::blockModelSignals(bool block)
 {
+    // The series is written to the model. The loading in progress would be overwritten by the
+    // reinitialization that follows, so it is cancelled before the model changes.
+    if (block)
+        stopLoading();
     m_modelSignalsBlock = block;
 }
 
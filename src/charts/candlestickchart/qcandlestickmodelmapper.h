@@ -47,6 +47,7 @@ class QT_CHARTS_EXPORT QCandlestickModelMapper : public QObject
     Q_OBJECT
     Q_PROPERTY(QAbstractItemModel *model READ model WRITE setModel NOTIFY modelReplaced)
     Q_PROPERTY(QCandlestickSeries *series READ series WRITE setSeries NOTIFY seriesReplaced)
+    Q_PROPERTY(bool backgroundLoading READ backgroundLoading WRITE setBackgroundLoading)
 
 public:
     explicit QCandlestickModelMapper(QObject *parent = nullptr);
@@ -57,11 +58,16 @@ public:
     void setSeries(QCandlestickSeries *series);
     QCandlestickSeries *series() const;
 
+    void setBackgroundLoading(bool enabled);
+    bool backgroundLoading() const;
+    bool isLoading() const;
+
     virtual Qt::Orientation orientation() const = 0;
 
 Q_SIGNALS:
     void modelReplaced();
     void seriesReplaced();
+    void loadingFinished();
 
 protected:
     void setTimestamp(int timestamp);
@@ -41,6 +41,7 @@
 
 #include <QtCharts/QCandlestickModelMapper>
 #include <QtCore/QObject>
+#include <private/modelloader_p.h>
 
 QT_BEGIN_NAMESPACE
 class QModelIndex;
@@ -56,6 +57,9 @@ class QCandlestickModelMapperPrivate : public QObject
 
 public:
     explicit QCandlestickModelMapperPrivate(QCandlestickModelMapper *q);
+    ~QCandlestickModelMapperPrivate();
+
+    bool isLoading() const { return m_loader != nullptr; }
 
 Q_SIGNALS:
     void timestampChanged();
@@ -68,6 +72,8 @@ Q_SIGNALS:
 
 private Q_SLOTS:
     void initializeCandlestickFromModel();
+    void handleLoadingFinished();
+    void waitForLoading();
 
     // for the model
     void modelDataUpdated(QModelIndex topLeft, QModelIndex bottomRight);
@@ -91,6 +97,10 @@ private:
     void removeData(int start, int end);
     void blockModelSignals(bool block = true);
     void blockSeriesSignals(bool block = true);
+    QCandlestickSet *createCandlestickSet(qreal timestamp, qreal open, qreal high, qreal low,
+                                          qreal close);
+    bool startLoading();
+    bool stopLoading();
 
 private:
     QAbstractItemModel *m_model;
@@ -105,6 +115,8 @@ private:
     QList<QCandlestickSet *> m_sets;
     bool m_modelSignalsBlock;
     bool m_seriesSignalsBlock;
+    bool m_backgroundLoading;
+    ModelLoader *m_loader;
 
 private:
     QCandlestickModelMapper *q_ptr;
@@ -356,6 +356,48 @@ QT_CHARTS_BEGIN_NAMESPACE
     The corresponding signal handler is \c {onDoubleClicked}.
 */
 
+/*!
+    \fn void QCandlestickSeries::candlestickClicked(int index)
+    This signal is emitted when the candlestick item at \a index is clicked on the chart.
+
+    Unlike clicked(), this signal is also emitted for the items appended as columns of values,
+    which have no QCandlestickSet until sets() is called.
+*/
+
+/*!
+    \fn void QCandlestickSeries::candlestickHovered(bool status, int index)
+    This signal is emitted when a mouse is hovered over the candlestick item at \a index in a
+    chart.
+
+    When the mouse moves over the item, \a status turns \c true, and when the mouse moves away
+    again, it turns \c false. Unlike hovered(), this signal is also emitted for the items appended
+    as columns of values.
+*/
+
+/*!
+    \fn void QCandlestickSeries::candlestickPressed(int index)
+    This signal is emitted when the user clicks the candlestick item at \a index and holds down
+    the mouse button.
+
+    Unlike pressed(), this signal is also emitted for the items appended as columns of values.
+*/
+
+/*!
+    \fn void QCandlestickSeries::candlestickReleased(int index)
+    This signal is emitted when the user releases the mouse press on the candlestick item at
+    \a index.
+
+    Unlike released(), this signal is also emitted for the items appended as columns of values.
+*/
+
+/*!
+    \fn void QCandlestickSeries::candlestickDoubleClicked(int index)
+    This signal is emitted when the candlestick item at \a index is double-clicked on the chart.
+
+    Unlike doubleClicked(), this signal is also emitted for the items appended as columns of
+    values.
+*/
+
 /*!
     \fn void QCandlestickSeries::candlestickSetsAdded(const QList<QCandlestickSet *> &sets)
     This signal is emitted when the candlestick items specified by \a
@@ -529,6 +571,7 @@ bool QCandlestickSeries::append(const QList<QCandlestickSet *> &sets)
 {
     Q_D(QCandlestickSeries);
 
+    d->materializeRows();
     bool success = d->append(sets);
     if (success) {
         emit candlestickSetsAdded(sets);
@@ -559,6 +602,33 @@ bool QCandlestickSeries::remove(const QList<QCandlestickSet *> &sets)
     return success;
 }
 
+/*!
+    Appends candlestick items to the series from the columns \a timestamps, \a opens, \a highs,
+    \a lows, and \a closes, which must all have the same, non-zero length.
+
+    The items are stored compactly in the series without a QCandlestickSet object for each of
+    them, which makes this the preferred way to add large amounts of data. The candlestick sets
+    are created the first time they are needed, for example when sets() is called or when sets
+    are appended or inserted. No candlestickSetsAdded() signal is emitted for them.
+
+    Until their sets exist, the items emit no set based signals, such as clicked(). Use
+    candlestickClicked() and the other index based signals for them instead.
+
+    Returns \c true if the items were appended, \c false otherwise.
+*/
+bool QCandlestickSeries::append(const QVector<qreal> &timestamps, const QVector<qreal> &opens,
+                                const QVector<qreal> &highs, const QVector<qreal> &lows,
+                                const QVector<qreal> &closes)
+{
+    Q_D(QCandlestickSeries);
+
+    bool success = d->appendRows(timestamps, opens, highs, lows, closes);
+    if (success)
+        emit countChanged();
+
+    return success;
+}
+
 /*!
     \qmlmethod CandlestickSeries::insert(int index, CandlestickSet set)
     Inserts the candlestick item specified by \a set to the series at the
@@ -578,6 +648,7 @@ bool QCandlestickSeries::insert(int index, QCandlestickSet *set)
 {
     Q_D(QCandlestickSeries);
 
+    d->materializeRows();
     bool success = d->insert(index, set);
     if (success) {
         QList<QCandlestickSet *> sets;
@@ -623,7 +694,9 @@ void QCandlestickSeries::clear()
 {
     Q_D(QCandlestickSeries);
 
-    QList<QCandlestickSet *> sets = this->sets();
+    // Rows are dropped without creating sets for them
+    const bool rowsCleared = d->clearRows();
+    QList<QCandlestickSet *> sets = d->m_sets;
 
     bool success = d->remove(sets);
     if (success) {
@@ -631,17 +704,26 @@ void QCandlestickSeries::clear()
         emit countChanged();
         foreach (QCandlestickSet *set, sets)
             set->deleteLater();
+    } else if (rowsCleared) {
+        emit countChanged();
     }
 }
 
 /*!
     Returns the list of candlestick items in the series. Ownership of the
     items does not change.
+
+    \warning Although this function is const, it allocates: a QCandlestickSet
+    object, together with a candlestick item in the chart, is created for each
+    item appended as columns of values, and the items stay sets from then on.
+    For series holding large amounts of such items, use count() and the index
+    based signals, such as candlestickClicked(), instead.
  */
 QList<QCandlestickSet *> QCandlestickSeries::sets() const
 {
     Q_D(const QCandlestickSeries);
 
+    const_cast<QCandlestickSeriesPrivate *>(d)->materializeRows();
     return d->m_sets;
 }
 
@@ -650,7 +732,9 @@ QList<QCandlestickSet *> QCandlestickSeries::sets() const
 */
 int QCandlestickSeries::count() const
 {
-    return sets().count();
+    Q_D(const QCandlestickSeries);
+
+    return d->m_sets.count() + d->m_rows.count();
 }
 
 /*!
@@ -940,20 +1024,29 @@ void QCandlestickSeriesPrivate::initializeDomain()
     qreal minY(domain()->minY());
     qreal maxY(domain()->maxY());
 
-    if (m_sets.count()) {
-        QCandlestickSet *set = m_sets.first();
-        minX = set->timestamp();
-        maxX = set->timestamp();
-        minY = set->low();
-        maxY = set->high();
-        for (int i = 1; i < m_sets.count(); ++i) {
-            set = m_sets.at(i);
-            minX = qMin(minX, qreal(set->timestamp()));
-            maxX = qMax(maxX, qreal(set->timestamp()));
-            minY = qMin(minY, set->low());
-            maxY = qMax(maxY, set->high());
+    const int count = m_sets.count() + m_rows.count();
+    if (count) {
+        bool first = true;
+        auto include = [&](qreal timestamp, qreal low, qreal high) {
+            if (first) {
+                minX = maxX = timestamp;
+                minY = low;
+                maxY = high;
+                first = false;
+                return;
+            }
+            minX = qMin(minX, timestamp);
+            maxX = qMax(maxX, timestamp);
+            minY = qMin(minY, low);
+            maxY = qMax(maxY, high);
+        };
+        foreach (QCandlestickSet *set, m_sets)
+            include(set->timestamp(), set->low(), set->high());
+        for (int i = 0; i < m_rows.count(); ++i) {
+            const CandlestickRow &row = m_rows.at(i);
+            include(row.timestamp, row.low, row.high);
         }
-        qreal extra = (maxX - minX) / m_sets.count() / 2;
+        qreal extra = (maxX - minX) / count / 2;
         minX = minX - extra;
         maxX = maxX + extra;
     }
@@ -1112,6 +1205,69 @@ bool QCandlestickSeriesPrivate::insert(int index, QCandlestickSet *set)
     return true;
 }
 
+bool QCandlestickSeriesPrivate::appendRows(const QVector<qreal> &timestamps,
+                                           const QVector<qreal> &opens,
+                                           const QVector<qreal> &highs,
+                                           const QVector<qreal> &lows,
+                                           const QVector<qreal> &closes)
+{
+    const int count = timestamps.count();
+    if (count == 0 || opens.count() != count || highs.count() != count || lows.count() != count
+        || closes.count() != count) {
+        return false; // Fail if the columns are empty or of different lengths.
+    }
+
+    const int index = m_rows.count();
+    m_rows.resize(index + count);
+    for (int i = 0; i < count; ++i) {
+        CandlestickRow &row = m_rows[index + i];
+        row.timestamp = timestamps.at(i);
+        row.open = opens.at(i);
+        row.high = highs.at(i);
+        row.low = lows.at(i);
+        row.close = closes.at(i);
+    }
+    emit rowsAdded(index, count);
+
+    return true;
+}
+
+QCandlestickSeriesPrivate *QCandlestickSeriesPrivate::get(QCandlestickSeries *series)
+{
+    return series->d_func();
+}
+
+// Creates sets for the rows, which keep their position after the existing sets
+void QCandlestickSeriesPrivate::materializeRows()
+{
+    if (m_rows.isEmpty())
+        return;
+
+    Q_Q(QCandlestickSeries);
+
+    QList<QCandlestickSet *> sets;
+    sets.reserve(m_rows.count());
+    for (int i = 0; i < m_rows.count(); ++i) {
+        const CandlestickRow &row = m_rows.at(i);
+        sets.append(new QCandlestickSet(row.open, row.high, row.low, row.close, row.timestamp, q));
+    }
+    m_rows.clear();
+    append(sets);
+
+    emit rowsMaterialized(sets);
+}
+
+bool QCandlestickSeriesPrivate::clearRows()
+{
+    if (m_rows.isEmpty())
+        return false;
+
+    m_rows.clear();
+    emit rowsCleared();
+
+    return true;
+}
+
 void QCandlestickSeriesPrivate::handleSeriesChange(QAbstractSeries *series)
 {
     Q_UNUSED(series);
@@ -1145,9 +1301,11 @@ void QCandlestickSeriesPrivate::populateBarCategories(QBarCategoryAxis *axis)
 {
     if (axis->categories().isEmpty()) {
         QStringList categories;
-        for (int i = 0; i < m_sets.count(); ++i) {
-            const qint64 timestamp = qRound64(m_sets.at(i)->timestamp());
-            const QString timestampFormat = m_chart->locale().dateTimeFormat(QLocale::ShortFormat);
+        const QString timestampFormat = m_chart->locale().dateTimeFormat(QLocale::ShortFormat);
+        for (int i = 0; i < m_sets.count() + m_rows.count(); ++i) {
+            const qint64 timestamp = qRound64(i < m_sets.count()
+                                              ? m_sets.at(i)->timestamp()
+                                              : m_rows.at(i - m_sets.count()).timestamp);
             categories << QDateTime::fromMSecsSinceEpoch(timestamp).toString(timestampFormat);
         }
         axis->append(categories);
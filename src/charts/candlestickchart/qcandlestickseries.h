@@ -31,6 +31,7 @@
 #define QCANDLESTICKSERIES_H
 
 #include <QtCharts/QAbstractSeries>
+#include <QtCore/QVector>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -60,6 +61,9 @@ public:
     bool remove(QCandlestickSet *set);
     bool append(const QList<QCandlestickSet *> &sets);
     bool remove(const QList<QCandlestickSet *> &sets);
+    bool append(const QVector<qreal> &timestamps, const QVector<qreal> &opens,
+                const QVector<qreal> &highs, const QVector<qreal> &lows,
+                const QVector<qreal> &closes);
     bool insert(int index, QCandlestickSet *set);
     bool take(QCandlestickSet *set);
     void clear();
@@ -105,6 +109,11 @@ Q_SIGNALS:
     void pressed(QCandlestickSet *set);
     void released(QCandlestickSet *set);
     void doubleClicked(QCandlestickSet *set);
+    void candlestickClicked(int index);
+    void candlestickHovered(bool status, int index);
+    void candlestickPressed(int index);
+    void candlestickReleased(int index);
+    void candlestickDoubleClicked(int index);
     void candlestickSetsAdded(const QList<QCandlestickSet *> &sets);
     void candlestickSetsRemoved(const QList<QCandlestickSet *> &sets);
     void countChanged();
@@ -49,6 +49,16 @@ class QCandlestickSeries;
 class QCandlestickSet;
 class QDateTimeAxis;
 
+// Candlestick appended as values only, without a QCandlestickSet
+struct CandlestickRow
+{
+    qreal timestamp;
+    qreal open;
+    qreal high;
+    qreal low;
+    qreal close;
+};
+
 class QCandlestickSeriesPrivate : public QAbstractSeriesPrivate
 {
     Q_OBJECT
@@ -72,6 +82,16 @@ public:
     bool remove(const QList<QCandlestickSet *> &sets);
     bool insert(int index, QCandlestickSet *set);
 
+    bool appendRows(const QVector<qreal> &timestamps, const QVector<qreal> &opens,
+                    const QVector<qreal> &highs, const QVector<qreal> &lows,
+                    const QVector<qreal> &closes);
+    void materializeRows();
+    bool clearRows();
+
+    static QCandlestickSeriesPrivate *get(QCandlestickSeries *series);
+    // The sets without the rows, which unlike QCandlestickSeries::sets() creates no sets for rows
+    const QList<QCandlestickSet *> &storedSets() const { return m_sets; }
+
 Q_SIGNALS:
     void clicked(int index, QCandlestickSet *set);
     void pressed(int index, QCandlestickSet *set);
@@ -80,6 +100,9 @@ Q_SIGNALS:
     void updated();
     void updatedLayout();
     void updatedCandlesticks();
+    void rowsAdded(int index, int count);
+    void rowsMaterialized(const QList<QCandlestickSet *> &sets);
+    void rowsCleared();
 
 private Q_SLOTS:
     void handleSeriesChange(QAbstractSeries *series);
@@ -90,6 +113,8 @@ private:
 
 protected:
     QList<QCandlestickSet *> m_sets;
+    // Rows follow the sets, until they are turned into sets when sets are needed
+    QVector<CandlestickRow> m_rows;
     qreal m_maximumColumnWidth;
     qreal m_minimumColumnWidth;
     qreal m_bodyWidth;
@@ -106,6 +131,7 @@ protected:
 
 private:
     Q_DECLARE_PUBLIC(QCandlestickSeries)
+    friend class CandlestickChartItem;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -59,6 +59,7 @@ QT_CHARTS_BEGIN_NAMESPACE
 
 ChartDataSet::ChartDataSet(QChart *chart)
     : QObject(chart),
+      m_updateCount(0),
       m_chart(chart),
       m_glXYSeriesDataManager(new GLXYSeriesDataManager(this))
 {
@@ -76,9 +77,63 @@ ChartDataSet::~ChartDataSet()
  */
 void ChartDataSet::addSeries(QAbstractSeries *series)
 {
-    if (m_seriesList.contains(series)) {
-        qWarning() << QObject::tr("Can not add series. Series already on the chart.");
+    if (!insertSeries(series))
         return;
+
+    if (m_updateCount)
+        m_pendingSeries << series;
+    else
+        emit seriesAdded(series);
+}
+
+/*
+ * This method adds the series and attaches the axes to each of them in one go. The axes have to
+ * be on the chart already. The axes are attached before the rest of the chart is notified of the
+ * series, so that their graphics are created for the final domains, and value axes fit their auto
+ * range once to all the series instead of once per attached series.
+ */
+void ChartDataSet::addSeries(const QList<QAbstractSeries *> &seriesList,
+                             const QList<QAbstractAxis *> &axes)
+{
+    // During an update the axes stay blocked until it ends
+    QList<QValueAxisPrivate *> blockedAxes;
+    foreach (QAbstractAxis *axis, axes) {
+        if (!m_updateCount && axis->type() == QAbstractAxis::AxisTypeValue) {
+            QValueAxisPrivate *d = static_cast<QValueAxisPrivate *>(axis->d_ptr.data());
+            d->setAutoRangeBlocked(true);
+            blockedAxes << d;
+        }
+    }
+
+    QList<QAbstractSeries *> added;
+    foreach (QAbstractSeries *series, seriesList) {
+        if (insertSeries(series)) {
+            foreach (QAbstractAxis *axis, axes)
+                attachAxis(series, axis);
+            added << series;
+        }
+    }
+
+    foreach (QValueAxisPrivate *d, blockedAxes)
+        d->setAutoRangeBlocked(false);
+
+    if (m_updateCount) {
+        m_pendingSeries << added;
+    } else {
+        foreach (QAbstractSeries *series, added)
+            emit seriesAdded(series);
+    }
+}
+
+/*
+ * Takes the series to the chart without notifying about it. Returns false if the series can not
+ * be added.
+ */
+bool ChartDataSet::insertSeries(QAbstractSeries *series)
+{
+    if (m_seriesSet.contains(series)) {
+        qWarning() << QObject::tr("Can not add series. Series already on the chart.");
+        return false;
     }
 
     // Ignore unsupported series added to polar chart
@@ -88,7 +143,7 @@ void ChartDataSet::addSeries(QAbstractSeries *series)
             || series->type() == QAbstractSeries::SeriesTypeScatter
             || series->type() == QAbstractSeries::SeriesTypeSpline)) {
             qWarning() << QObject::tr("Can not add series. Series type is not supported by a polar chart.");
-            return;
+            return false;
         }
         // Disable OpenGL for series in polar charts
         series->setUseOpenGL(false);
@@ -108,11 +163,12 @@ void ChartDataSet::addSeries(QAbstractSeries *series)
 
     series->d_ptr->initializeDomain();
     m_seriesList.append(series);
+    m_seriesSet.insert(series);
 
     series->setParent(this); // take ownership
     series->d_ptr->m_chart = m_chart;
 
-    emit seriesAdded(series);
+    return true;
 }
 
 /*
@@ -120,7 +176,7 @@ void ChartDataSet::addSeries(QAbstractSeries *series)
  */
 void ChartDataSet::addAxis(QAbstractAxis *axis, Qt::Alignment aligment)
 {
-    if (m_axisList.contains(axis)) {
+    if (m_axisSet.contains(axis)) {
         qWarning() << QObject::tr("Can not add axis. Axis already on the chart.");
         return;
     }
@@ -144,8 +200,12 @@ void ChartDataSet::addAxis(QAbstractAxis *axis, Qt::Alignment aligment)
     axis->setParent(this);
     axis->d_ptr->m_chart = m_chart;
     m_axisList.append(axis);
+    m_axisSet.insert(axis);
 
-    emit axisAdded(axis);
+    if (m_updateCount)
+        m_pendingAxes << axis;
+    else
+        emit axisAdded(axis);
 }
 
 /*
@@ -153,7 +213,7 @@ void ChartDataSet::addAxis(QAbstractAxis *axis, Qt::Alignment aligment)
  */
 void ChartDataSet::removeSeries(QAbstractSeries *series)
 {
-    if (! m_seriesList.contains(series)) {
+    if (!m_seriesSet.contains(series)) {
         qWarning() << QObject::tr("Can not remove series. Series not found on the chart.");
         return;
     }
@@ -164,8 +224,10 @@ void ChartDataSet::removeSeries(QAbstractSeries *series)
         detachAxis(series, axis);
     }
 
-    m_seriesList.removeAll(series);
-    emit seriesRemoved(series);
+    m_seriesList.removeOne(series);
+    m_seriesSet.remove(series);
+    if (!m_pendingSeries.removeOne(series))
+        emit seriesRemoved(series);
 
     // Reset domain to default
     series->d_ptr->setDomain(new XYDomain());
@@ -182,7 +244,7 @@ void ChartDataSet::removeSeries(QAbstractSeries *series)
  */
 void ChartDataSet::removeAxis(QAbstractAxis *axis)
 {
-    if (! m_axisList.contains(axis)) {
+    if (!m_axisSet.contains(axis)) {
         qWarning() << QObject::tr("Can not remove axis. Axis not found on the chart.");
         return;
     }
@@ -193,8 +255,13 @@ void ChartDataSet::removeAxis(QAbstractAxis *axis)
       detachAxis(s,axis);
     }
 
-    emit axisRemoved(axis);
-    m_axisList.removeAll(axis);
+    if (m_autoRangeBlockedAxes.remove(axis))
+        static_cast<QValueAxisPrivate *>(axis->d_ptr.data())->setAutoRangeBlocked(false);
+
+    if (!m_pendingAxes.removeOne(axis))
+        emit axisRemoved(axis);
+    m_axisList.removeOne(axis);
+    m_axisSet.remove(axis);
 
     axis->setParent(0);
     axis->d_ptr->m_chart = 0;
@@ -210,15 +277,16 @@ bool ChartDataSet::attachAxis(QAbstractSeries *series,QAbstractAxis *axis)
     if (!series)
         return false;
 
-    QList<QAbstractSeries *> attachedSeriesList = axis->d_ptr->m_series;
-    QList<QAbstractAxis *> attachedAxisList = series->d_ptr->m_axes;
+    // A series has only a few axes, so its own list is searched rather than the one of the axis,
+    // which can have thousands of series
+    const QList<QAbstractAxis *> &attachedAxisList = series->d_ptr->m_axes;
 
-    if (!m_seriesList.contains(series)) {
+    if (!m_seriesSet.contains(series)) {
         qWarning() << QObject::tr("Can not find series on the chart.");
         return false;
     }
 
-    if (axis && !m_axisList.contains(axis)) {
+    if (axis && !m_axisSet.contains(axis)) {
         qWarning() << QObject::tr("Can not find axis on the chart.");
         return false;
     }
@@ -228,17 +296,39 @@ bool ChartDataSet::attachAxis(QAbstractSeries *series,QAbstractAxis *axis)
         return false;
     }
 
-    if (attachedSeriesList.contains(series)) {
-        qWarning() << QObject::tr("Axis already attached to series.");
-        return false;
+    AbstractDomain::DomainType type = selectDomain(QList<QAbstractAxis *>(attachedAxisList) << axis);
+
+    if (type == AbstractDomain::UndefinedDomain) return false;
+
+    series->d_ptr->m_axes<<axis;
+    axis->d_ptr->m_series<<series;
+
+    // During an update, the domain of the series is set up once for all the axes attached to it
+    // when the update ends, and value axes fit their auto range once
+    if (m_updateCount) {
+        m_pendingDomainAxes[series] << axis;
+        if (axis->type() == QAbstractAxis::AxisTypeValue && !m_autoRangeBlockedAxes.contains(axis)) {
+            static_cast<QValueAxisPrivate *>(axis->d_ptr.data())->setAutoRangeBlocked(true);
+            m_autoRangeBlockedAxes.insert(axis);
+        }
+        return true;
     }
 
-    AbstractDomain *domain = series->d_ptr->domain();
-    AbstractDomain::DomainType type = selectDomain(attachedAxisList<<axis);
+    attachDomainAxes(series, QList<QAbstractAxis *>() << axis);
+    return true;
+}
 
-    if (type == AbstractDomain::UndefinedDomain) return false;
+/*
+ * Attaches the given axes of the series to its domain. The axes are already in the axis list of
+ * the series, and the rest of its axes are attached to the domain. The domain is replaced if the
+ * axes call for another domain type.
+ */
+void ChartDataSet::attachDomainAxes(QAbstractSeries *series, const QList<QAbstractAxis *> &axes)
+{
+    AbstractDomain *domain = series->d_ptr->domain();
+    AbstractDomain::DomainType type = selectDomain(series->d_ptr->m_axes);
 
-    if (domain->type() != type) {
+    if (type != AbstractDomain::UndefinedDomain && domain->type() != type) {
         AbstractDomain *old = domain;
         domain = createDomain(type);
         domain->setRange(old->minX(), old->maxX(), old->minY(), old->maxY());
@@ -247,18 +337,19 @@ bool ChartDataSet::attachAxis(QAbstractSeries *series,QAbstractAxis *axis)
         domain->setSize(old->size());
     }
 
-    if (!domain)
-        return false;
-
-    if (!domain->attachAxis(axis))
-        return false;
+    foreach (QAbstractAxis *axis, axes)
+        domain->attachAxis(axis);
 
     QList<AbstractDomain *> blockedDomains;
     domain->blockRangeSignals(true);
     blockedDomains << domain;
 
     if (domain != series->d_ptr->domain()) {
+        QList<QAbstractAxis *> oldAxes;
         foreach (QAbstractAxis *axis, series->d_ptr->m_axes) {
+            if (axes.contains(axis))
+                continue;
+            oldAxes << axis;
             series->d_ptr->domain()->detachAxis(axis);
             domain->attachAxis(axis);
             foreach (QAbstractSeries *otherSeries, axis->d_ptr->m_series) {
@@ -275,20 +366,18 @@ bool ChartDataSet::attachAxis(QAbstractSeries *series,QAbstractAxis *axis)
 
         // Reinitialize domain based on old axes, as the series domain initialization above
         // has trashed the old ranges, if there were any.
-        for (QAbstractAxis *oldAxis : series->d_ptr->m_axes)
+        for (QAbstractAxis *oldAxis : oldAxes)
             oldAxis->d_ptr->initializeDomain(domain);
     }
 
-    series->d_ptr->m_axes<<axis;
-    axis->d_ptr->m_series<<series;
-
     series->d_ptr->initializeAxes();
-    axis->d_ptr->initializeDomain(domain);
-    connect(axis, &QAbstractAxis::reverseChanged, this, &ChartDataSet::reverseChanged);
+    foreach (QAbstractAxis *axis, axes) {
+        axis->d_ptr->initializeDomain(domain);
+        connect(axis, &QAbstractAxis::reverseChanged, this, &ChartDataSet::reverseChanged,
+                Qt::UniqueConnection);
+    }
     foreach (AbstractDomain *blockedDomain, blockedDomains)
         blockedDomain->blockRangeSignals(false);
-
-    return true;
 }
 
 /*
@@ -299,16 +388,15 @@ bool ChartDataSet::detachAxis(QAbstractSeries* series,QAbstractAxis *axis)
     Q_ASSERT(series);
     Q_ASSERT(axis);
 
-    QList<QAbstractSeries* > attachedSeriesList = axis->d_ptr->m_series;
-    QList<QAbstractAxis* > attachedAxisList = series->d_ptr->m_axes;
+    const QList<QAbstractAxis *> &attachedAxisList = series->d_ptr->m_axes;
     AbstractDomain* domain =  series->d_ptr->domain();
 
-    if (!m_seriesList.contains(series)) {
+    if (!m_seriesSet.contains(series)) {
         qWarning() << QObject::tr("Can not find series on the chart.");
         return false;
     }
 
-    if (axis && !m_axisList.contains(axis)) {
+    if (axis && !m_axisSet.contains(axis)) {
         qWarning() << QObject::tr("Can not find axis on the chart.");
         return false;
     }
@@ -320,13 +408,66 @@ bool ChartDataSet::detachAxis(QAbstractSeries* series,QAbstractAxis *axis)
 
     Q_ASSERT(axis->d_ptr->m_series.contains(series));
 
-    domain->detachAxis(axis);
-    series->d_ptr->m_axes.removeAll(axis);
-    axis->d_ptr->m_series.removeAll(series);
-    disconnect(axis, &QAbstractAxis::reverseChanged, this, &ChartDataSet::reverseChanged);
+    QHash<QAbstractSeries *, QList<QAbstractAxis *> >::iterator pending = m_pendingDomainAxes.find(series);
+    if (pending != m_pendingDomainAxes.end() && pending->removeOne(axis)) {
+        if (pending->isEmpty())
+            m_pendingDomainAxes.erase(pending);
+    } else {
+        domain->detachAxis(axis);
+    }
+    series->d_ptr->m_axes.removeOne(axis);
+    axis->d_ptr->m_series.removeOne(series);
+    if (axis->d_ptr->m_series.isEmpty())
+        disconnect(axis, &QAbstractAxis::reverseChanged, this, &ChartDataSet::reverseChanged);
     return true;
 }
 
+/*
+ * Starts an update. Until the matching endUpdate(), added series and axes are not announced to
+ * the rest of the chart, so their graphics, theme and legend markers are only set up once for
+ * the final configuration. Axes attached during the update are taken into the domains of their
+ * series once it ends, and the chart defers theme decoration, legend marker updates and layout
+ * passes until updateFinished() is emitted. Updates can be nested.
+ */
+void ChartDataSet::beginUpdate()
+{
+    m_updateCount++;
+}
+
+void ChartDataSet::endUpdate()
+{
+    if (m_updateCount == 0) {
+        qWarning() << QObject::tr("Chart update ended without being started.");
+        return;
+    }
+
+    if (--m_updateCount > 0)
+        return;
+
+    QHash<QAbstractSeries *, QList<QAbstractAxis *> > domainAxes;
+    domainAxes.swap(m_pendingDomainAxes);
+    for (auto it = domainAxes.constBegin(); it != domainAxes.constEnd(); ++it)
+        attachDomainAxes(it.key(), it.value());
+
+    foreach (QAbstractAxis *axis, m_autoRangeBlockedAxes)
+        static_cast<QValueAxisPrivate *>(axis->d_ptr.data())->setAutoRangeBlocked(false);
+    m_autoRangeBlockedAxes.clear();
+
+    // The theme, legend markers and layout of what is already shown catch up before the new
+    // series and axes are announced
+    emit updateFinished();
+
+    QList<QAbstractAxis *> axes;
+    axes.swap(m_pendingAxes);
+    foreach (QAbstractAxis *axis, axes)
+        emit axisAdded(axis);
+
+    QList<QAbstractSeries *> series;
+    series.swap(m_pendingSeries);
+    foreach (QAbstractSeries *s, series)
+        emit seriesAdded(s);
+}
+
 void ChartDataSet::createDefaultAxes()
 {
     if (m_seriesList.isEmpty())
@@ -517,7 +658,7 @@ QPointF ChartDataSet::mapToValue(const QPointF &position, QAbstractSeries *serie
     if (series && series->type() == QAbstractSeries::SeriesTypePie)
         return point;
 
-    if (series && m_seriesList.contains(series))
+    if (series && m_seriesSet.contains(series))
         point = series->d_ptr->m_domain->calculateDomainPoint(position - m_chart->plotArea().topLeft());
     return point;
 }
@@ -532,7 +673,7 @@ QPointF ChartDataSet::mapToPosition(const QPointF &value, QAbstractSeries *serie
         return QPoint(0, 0);
 
     bool ok;
-    if (series && m_seriesList.contains(series))
+    if (series && m_seriesSet.contains(series))
         point += series->d_ptr->m_domain->calculateGeometryPoint(value, ok);
     return point;
 }
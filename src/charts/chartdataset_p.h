@@ -43,6 +43,8 @@
 #include <private/abstractdomain_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCore/QVector>
+#include <QtCore/QSet>
+#include <QtCore/QHash>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -58,6 +60,7 @@ public:
     virtual ~ChartDataSet();
 
     void addSeries(QAbstractSeries *series);
+    void addSeries(const QList<QAbstractSeries *> &seriesList, const QList<QAbstractAxis *> &axes);
     void removeSeries(QAbstractSeries *series);
     QList<QAbstractSeries *> series() const;
 
@@ -70,6 +73,10 @@ public:
 
     void createDefaultAxes();
 
+    void beginUpdate();
+    void endUpdate();
+    bool isUpdating() const { return m_updateCount > 0; }
+
     void zoomInDomain(const QRectF &rect);
     void zoomOutDomain(const QRectF &rect);
     void zoomResetDomain();
@@ -89,9 +96,12 @@ Q_SIGNALS:
     void axisRemoved(QAbstractAxis* axis);
     void seriesAdded(QAbstractSeries* series);
     void seriesRemoved(QAbstractSeries* series);
+    void updateFinished();
 public Q_SLOTS:
     void reverseChanged();
 private:
+    bool insertSeries(QAbstractSeries *series);
+    void attachDomainAxes(QAbstractSeries *series, const QList<QAbstractAxis *> &axes);
     void createAxes(QAbstractAxis::AxisTypes type, Qt::Orientation orientation);
     QAbstractAxis *createAxis(QAbstractAxis::AxisType type, Qt::Orientation orientation);
     AbstractDomain::DomainType selectDomain(QList<QAbstractAxis* > axes);
@@ -101,6 +111,15 @@ private:
 private:
     QList<QAbstractSeries *> m_seriesList;
     QList<QAbstractAxis *> m_axisList;
+    // Membership of m_seriesList and m_axisList, for charts with lots of series
+    QSet<QAbstractSeries *> m_seriesSet;
+    QSet<QAbstractAxis *> m_axisSet;
+    // Series and axes added during an update, announced when it ends
+    int m_updateCount;
+    QList<QAbstractSeries *> m_pendingSeries;
+    QList<QAbstractAxis *> m_pendingAxes;
+    QSet<QAbstractAxis *> m_autoRangeBlockedAxes;
+    QHash<QAbstractSeries *, QList<QAbstractAxis *> > m_pendingDomainAxes;
     QChart* m_chart;
     GLXYSeriesDataManager *m_glXYSeriesDataManager;
 };
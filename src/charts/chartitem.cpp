@@ -52,6 +52,30 @@ void ChartItem::cleanup()
     disconnect();
 }
 
+/*
+ * Maps rect from plot area coordinates to item coordinates. The two differ while the presenter
+ * previews an interactive zoom or scroll by transforming the item.
+ */
+QRectF ChartItem::mapFromPlotArea(const QRectF &rect) const
+{
+    if (!isPreviewTransformed())
+        return rect;
+    return transform().inverted().mapRect(rect);
+}
+
+/*
+ * Returns pen as it should be used while painting, keeping its width from scaling with the
+ * preview transform.
+ */
+QPen ChartItem::previewPen(const QPen &pen) const
+{
+    if (!isPreviewTransformed())
+        return pen;
+    QPen cosmeticPen(pen);
+    cosmeticPen.setCosmetic(true);
+    return cosmeticPen;
+}
+
 void ChartItem::handleDomainUpdated()
 {
     qWarning() <<  __FUNCTION__<< "Slot not implemented";
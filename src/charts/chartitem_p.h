@@ -42,6 +42,7 @@
 #include <private/chartelement_p.h>
 #include <private/chartpresenter_p.h>
 #include <QtWidgets/QGraphicsItem>
+#include <QtGui/QPen>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -54,6 +55,11 @@ public:
     AbstractDomain*  domain() const;
     virtual void cleanup();
 
+    virtual bool supportsPreviewTransform() const { return false; }
+    bool isPreviewTransformed() const { return !transform().isIdentity(); }
+    QRectF mapFromPlotArea(const QRectF &rect) const;
+    QPen previewPen(const QPen &pen) const;
+
 public Q_SLOTS:
     virtual void handleDomainUpdated();
 
@@ -48,6 +48,9 @@
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Time without further zooming or scrolling after which a previewed change is applied
+static const int previewSettleDelay = 150;
+
 ChartPresenter::ChartPresenter(QChart *chart, QChart::ChartType type)
     : QObject(chart),
       m_chart(chart),
@@ -58,7 +61,9 @@ ChartPresenter::ChartPresenter(QChart *chart, QChart::ChartType type)
       m_background(0),
       m_plotAreaBackground(0),
       m_title(0),
-      m_localizeNumbers(false)
+      m_localizeNumbers(false),
+      m_previewEnabled(false),
+      m_previewTimer(new QTimer(this))
 #ifndef QT_NO_OPENGL
       , m_glWidget(0)
       , m_glUseWidget(true)
@@ -69,6 +74,10 @@ ChartPresenter::ChartPresenter(QChart *chart, QChart::ChartType type)
     else if (type == QChart::ChartTypePolar)
         m_layout = new PolarChartLayout(this);
     Q_ASSERT(m_layout);
+
+    m_previewTimer->setSingleShot(true);
+    m_previewTimer->setInterval(previewSettleDelay);
+    connect(m_previewTimer, SIGNAL(timeout()), this, SLOT(handlePreviewSettled()));
 }
 
 ChartPresenter::~ChartPresenter()
@@ -81,6 +90,7 @@ ChartPresenter::~ChartPresenter()
 void ChartPresenter::setGeometry(const QRectF rect)
 {
     if (m_rect != rect) {
+        commitPreview();
         m_rect = rect;
         foreach (ChartItem *chart, m_chartItems) {
             chart->domain()->setSize(rect.size());
@@ -127,6 +137,7 @@ void ChartPresenter::handleAxisRemoved(QAbstractAxis *axis)
 
 void ChartPresenter::handleSeriesAdded(QAbstractSeries *series)
 {
+    commitPreview();
     series->d_ptr->initializeGraphics(rootItem());
     series->d_ptr->initializeAnimations(m_options, m_animationDuration, m_animationCurve);
     series->d_ptr->setPresenter(this);
@@ -151,8 +162,8 @@ void ChartPresenter::handleSeriesRemoved(QAbstractSeries *series)
     chart->deleteLater();
     if (chart->animation())
         chart->animation()->stopAndDestroyLater();
-    m_chartItems.removeAll(chart);
-    m_series.removeAll(series);
+    m_chartItems.removeOne(chart);
+    m_series.removeOne(series);
     m_layout->invalidate();
 }
 
@@ -418,6 +429,154 @@ AbstractChartLayout *ChartPresenter::layout()
     return m_layout;
 }
 
+/*
+ * Requests a layout pass without invalidating the size hints of the chart. Requests made
+ * within one event loop iteration are coalesced into a single pass, which is skipped entirely
+ * if the layout gets activated for some other reason before the queued pass runs.
+ */
+void ChartPresenter::scheduleLayout()
+{
+    // During a chart update the layout pass is left to the end of the update
+    if (m_layout->markDirty() && !isUpdating())
+        QMetaObject::invokeMethod(this, "handleScheduledLayout", Qt::QueuedConnection);
+}
+
+/*
+ * Returns true while a QChart::beginUpdate() is open. Layout requests made in the meantime are
+ * only counted, and the layout is invalidated once by handleUpdateFinished().
+ */
+bool ChartPresenter::isUpdating() const
+{
+    ChartDataSet *dataset = m_chart->d_ptr->m_dataset;
+    return dataset && dataset->isUpdating();
+}
+
+void ChartPresenter::handleUpdateFinished()
+{
+    m_layout->setDirty(false);
+    m_layout->invalidate();
+}
+
+void ChartPresenter::handleScheduledLayout()
+{
+    if (m_layout->isDirty()) {
+        m_layout->setGeometry(m_layout->geometry());
+        m_layout->setDirty(false);
+    }
+}
+
+int ChartPresenter::layoutRequestCount() const
+{
+    return m_layout->layoutRequestCount();
+}
+
+int ChartPresenter::layoutPassCount() const
+{
+    return m_layout->layoutPassCount();
+}
+
+int ChartPresenter::savedLayoutPassCount() const
+{
+    return m_layout->savedLayoutPassCount();
+}
+
+void ChartPresenter::resetLayoutCounters()
+{
+    m_layout->resetLayoutCounters();
+}
+
+ChartPresenter *ChartPresenter::get(QChart *chart)
+{
+    return chart->d_ptr->m_presenter;
+}
+
+void ChartPresenter::setPreviewEnabled(bool enabled)
+{
+    if (!enabled)
+        commitPreview();
+    m_previewEnabled = enabled;
+}
+
+/*
+ * Previews zooming the plot area to rect, given in the current plot area coordinates, by
+ * transforming the already calculated series geometry. The domains are only changed once no
+ * further zoom or scroll has been requested for a while. Returns false if the change cannot be
+ * previewed and has to be applied to the domains right away.
+ */
+bool ChartPresenter::previewZoom(const QRectF &rect)
+{
+    if (!canPreview()) {
+        commitPreview();
+        return false;
+    }
+
+    // m_previewRect is the visible part of the plot area in the coordinates of the domains as
+    // they are, so previews accumulate until they are committed
+    if (m_previewRect.isNull())
+        m_previewRect = QRectF(QPointF(0, 0), m_rect.size());
+    const qreal sx = m_previewRect.width() / m_rect.width();
+    const qreal sy = m_previewRect.height() / m_rect.height();
+    m_previewRect = QRectF(m_previewRect.left() + rect.left() * sx,
+                           m_previewRect.top() + rect.top() * sy,
+                           rect.width() * sx, rect.height() * sy);
+
+    const qreal scaleX = m_rect.width() / m_previewRect.width();
+    const qreal scaleY = m_rect.height() / m_previewRect.height();
+    const QTransform transform(scaleX, 0, 0, scaleY,
+                               -m_previewRect.left() * scaleX, -m_previewRect.top() * scaleY);
+    foreach (ChartItem *item, m_chartItems)
+        item->setTransform(transform);
+
+    m_previewTimer->start();
+    return true;
+}
+
+/*
+ * Applies a previewed zoom or scroll to the domains, which recalculates the series geometry and
+ * the axes.
+ */
+void ChartPresenter::commitPreview()
+{
+    if (m_previewRect.isNull())
+        return;
+
+    m_previewTimer->stop();
+    const QRectF rect = m_previewRect;
+    m_previewRect = QRectF();
+    foreach (ChartItem *item, m_chartItems)
+        item->setTransform(QTransform());
+
+    // Only scrolled, which unlike zooming does not affect zoomReset()
+    if (qFuzzyCompare(rect.width(), m_rect.width()) && qFuzzyCompare(rect.height(), m_rect.height()))
+        m_chart->d_ptr->m_dataset->scrollDomain(rect.left(), -rect.top());
+    else
+        m_chart->d_ptr->m_dataset->zoomInDomain(rect);
+}
+
+void ChartPresenter::handlePreviewSettled()
+{
+    commitPreview();
+}
+
+bool ChartPresenter::canPreview() const
+{
+    if (!m_previewEnabled || m_chartItems.isEmpty() || !m_rect.isValid()
+        || chartType() != QChart::ChartTypeCartesian
+        || m_options.testFlag(QChart::SeriesAnimations)) {
+        return false;
+    }
+
+    foreach (QAbstractSeries *series, m_series) {
+        if (series->useOpenGL())
+            return false;
+    }
+    foreach (ChartItem *item, m_chartItems) {
+        if (!item->supportsPreviewTransform())
+            return false;
+    }
+    return true;
+}
+
 QLegend *ChartPresenter::legend()
 {
     return m_chart->legend();
@@ -47,6 +47,7 @@
 #include <QtCore/QLocale>
 #include <QtCore/QPointer>
 #include <QtCore/QEasingCurve>
+#include <QtCore/QTimer>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -62,7 +63,7 @@ class ChartTitle;
 class ChartAnimation;
 class AbstractChartLayout;
 
-class ChartPresenter: public QObject
+class Q_AUTOTEST_EXPORT ChartPresenter: public QObject
 {
     Q_OBJECT
 public:
@@ -163,6 +164,20 @@ public:
     State state() const { return m_state; }
     QPointF statePoint() const { return m_statePoint; }
     AbstractChartLayout *layout();
+    void scheduleLayout();
+    bool isUpdating() const;
+
+    // Instrumentation for the layout passes saved by scheduleLayout()
+    int layoutRequestCount() const;
+    int layoutPassCount() const;
+    int savedLayoutPassCount() const;
+    void resetLayoutCounters();
+    static ChartPresenter *get(QChart *chart);
+
+    void setPreviewEnabled(bool enabled);
+    bool isPreviewEnabled() const { return m_previewEnabled; }
+    bool previewZoom(const QRectF &rect);
+    void commitPreview();
 
     QChart::ChartType chartType() const { return m_chart->chartType(); }
     QChart *chart() { return m_chart; }
@@ -179,16 +194,22 @@ public:
     void glSetUseWidget(bool enable) { m_glUseWidget = enable; }
 
 private:
+    bool canPreview() const;
     void createBackgroundItem();
     void createPlotAreaBackgroundItem();
     void createTitleItem();
 
 public Q_SLOTS:
+    void handleUpdateFinished();
     void handleSeriesAdded(QAbstractSeries *series);
     void handleSeriesRemoved(QAbstractSeries *series);
     void handleAxisAdded(QAbstractAxis *axis);
     void handleAxisRemoved(QAbstractAxis *axis);
 
+private Q_SLOTS:
+    void handleScheduledLayout();
+    void handlePreviewSettled();
+
 Q_SIGNALS:
     void plotAreaChanged(const QRectF &plotArea);
 
@@ -210,6 +231,9 @@ private:
     QRectF m_rect;
     bool m_localizeNumbers;
     QLocale m_locale;
+    bool m_previewEnabled;
+    QRectF m_previewRect;
+    QTimer *m_previewTimer;
 #ifndef QT_NO_OPENGL
     QPointer<GLWidget> m_glWidget;
 #endif
@@ -24,7 +24,10 @@ SOURCES += \
     $$PWD/chartitem.cpp \
     $$PWD/scroller.cpp \
     $$PWD/charttitle.cpp \
-    $$PWD/qpolarchart.cpp
+    $$PWD/qpolarchart.cpp \
+    $$PWD/labelformatter.cpp \
+    $$PWD/qnumericcolumnaccess.cpp \
+    $$PWD/modelloader.cpp
 
 contains(QT_CONFIG, opengl): SOURCES += $$PWD/glwidget.cpp
 
@@ -41,7 +44,10 @@ PRIVATE_HEADERS += \
     $$PWD/scroller_p.h \
     $$PWD/qabstractseries_p.h \
     $$PWD/charttitle_p.h \
-    $$PWD/charthelpers_p.h
+    $$PWD/charthelpers_p.h \
+    $$PWD/labelformatter_p.h \
+    $$PWD/qnumericcolumnaccess_p.h \
+    $$PWD/modelloader_p.h
 
 contains(QT_CONFIG, opengl): PRIVATE_HEADERS += $$PWD/glwidget_p.h
 
@@ -51,7 +57,8 @@ PUBLIC_HEADERS += \
     $$PWD/qabstractseries.h \
     $$PWD/qchartview.h \
     $$PWD/chartsnamespace.h \
-    $$PWD/qpolarchart.h
+    $$PWD/qpolarchart.h \
+    $$PWD/qnumericcolumnaccess.h
 
 include($$PWD/animations/animations.pri)
 include($$PWD/areachart/areachart.pri)
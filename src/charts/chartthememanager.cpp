@@ -28,6 +28,8 @@
 ****************************************************************************/
 #include <private/qabstractseries_p.h>
 #include <private/qabstractaxis_p.h>
+#include <private/qchart_p.h>
+#include <private/chartdataset_p.h>
 #include <QtCore/QTime>
 //themes
 #include <private/chartthemesystem_p.h>
@@ -43,7 +45,9 @@
 QT_CHARTS_BEGIN_NAMESPACE
 
 ChartThemeManager::ChartThemeManager(QChart* chart) :
-    m_chart(chart)
+    m_freeKey(0),
+    m_chart(chart),
+    m_decorationPending(false)
 {
     qsrand(QTime(0, 0, 0).secsTo(QTime::currentTime()));
 }
@@ -83,16 +87,25 @@ void ChartThemeManager::setTheme(QChart::ChartTheme theme)
         }
 
         if (!m_theme.isNull()) {
-            decorateChart(m_chart,m_theme.data());
-            decorateLegend(m_chart->legend(),m_theme.data());
-            foreach (QAbstractAxis* axis, m_axisList)
-                axis->d_ptr->initializeTheme(m_theme.data(), true);
-            foreach (QAbstractSeries* series, m_seriesMap.keys())
-                series->d_ptr->initializeTheme(m_seriesMap[series], m_theme.data(), true);
+            // During a chart update, the chart is decorated once when the update ends
+            if (m_chart->d_ptr->m_dataset->isUpdating())
+                m_decorationPending = true;
+            else
+                decorate();
         }
     }
 }
 
+void ChartThemeManager::decorate()
+{
+    decorateChart(m_chart,m_theme.data());
+    decorateLegend(m_chart->legend(),m_theme.data());
+    foreach (QAbstractAxis* axis, m_axisList)
+        axis->d_ptr->initializeTheme(m_theme.data(), true);
+    foreach (QAbstractSeries* series, m_seriesMap.keys())
+        series->d_ptr->initializeTheme(m_seriesMap[series], m_theme.data(), true);
+}
+
 // decorateChart is only called when theme is forcibly initialized
 void ChartThemeManager::decorateChart(QChart *chart, ChartTheme *theme) const
 {
@@ -118,22 +131,15 @@ void ChartThemeManager::decorateLegend(QLegend *legend, ChartTheme *theme) const
     legend->setLabelBrush(theme->labelBrush());
 }
 
-int ChartThemeManager::createIndexKey(QList<int> keys) const
+/*
+ * Returns the lowest key not used by any series. Keys below m_freeKey are all in use, so the
+ * search starts from there.
+ */
+int ChartThemeManager::createIndexKey()
 {
-    std::sort(keys.begin(), keys.end());
-
-    int key = 0;
-    QList<int>::iterator i;
-    i = keys.begin();
-
-    while (i != keys.end()) {
-        if (*i != key)
-            break;
-        key++;
-        i++;
-    }
-
-    return key;
+    while (m_seriesKeys.contains(m_freeKey))
+        m_freeKey++;
+    return m_freeKey;
 }
 
 int ChartThemeManager::seriesCount(QAbstractSeries::SeriesType type) const
@@ -149,14 +155,20 @@ int ChartThemeManager::seriesCount(QAbstractSeries::SeriesType type) const
 
 void ChartThemeManager::handleSeriesAdded(QAbstractSeries *series)
 {
-    int key = createIndexKey(m_seriesMap.values());
+    int key = createIndexKey();
     m_seriesMap.insert(series,key);
+    m_seriesKeys.insert(key);
     series->d_ptr->initializeTheme(key,m_theme.data(),false);
 }
 
 void ChartThemeManager::handleSeriesRemoved(QAbstractSeries *series)
 {
-    m_seriesMap.remove(series);
+    if (!m_seriesMap.contains(series))
+        return;
+
+    const int key = m_seriesMap.take(series);
+    m_seriesKeys.remove(key);
+    m_freeKey = qMin(m_freeKey, key);
 }
 
 void ChartThemeManager::handleAxisAdded(QAbstractAxis *axis)
@@ -167,7 +179,19 @@ void ChartThemeManager::handleAxisAdded(QAbstractAxis *axis)
 
 void ChartThemeManager::handleAxisRemoved(QAbstractAxis *axis)
 {
-    m_axisList.removeAll(axis);
+    m_axisList.removeOne(axis);
+}
+
+/*
+ * Called before the series and axes added during the update are announced, so only the ones
+ * that were already shown get the theme forced on them.
+ */
+void ChartThemeManager::handleUpdateFinished()
+{
+    if (m_decorationPending) {
+        m_decorationPending = false;
+        decorate();
+    }
 }
 
 void ChartThemeManager::updateSeries(QAbstractSeries *series)
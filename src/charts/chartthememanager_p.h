@@ -43,6 +43,7 @@
 #include <QtCharts/QChart>
 #include <QtGui/QColor>
 #include <QtGui/QGradientStops>
+#include <QtCore/QSet>
 
 QT_CHARTS_BEGIN_NAMESPACE
 class ChartTheme;
@@ -73,7 +74,8 @@ public:
     static QColor colorAt(const QGradient &gradient, qreal pos);
 
 private:
-    int createIndexKey(QList<int> keys) const;
+    int createIndexKey();
+    void decorate();
     int seriesCount(QAbstractSeries::SeriesType type) const;
 
 public Q_SLOTS:
@@ -81,12 +83,16 @@ public Q_SLOTS:
     void handleSeriesRemoved(QAbstractSeries *series);
     void handleAxisAdded(QAbstractAxis *axis);
     void handleAxisRemoved(QAbstractAxis *axis);
+    void handleUpdateFinished();
 
 protected:
     QScopedPointer<ChartTheme> m_theme;
     QMap<QAbstractSeries *,int> m_seriesMap;
+    QSet<int> m_seriesKeys;
+    int m_freeKey;
     QList<QAbstractAxis *> m_axisList;
     QChart* m_chart;
+    bool m_decorationPending;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,257 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/labelformatter_p.h>
+#include <QtCore/QRegExp>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+static const char *labelFormatMatchString = "%[\\-\\+#\\s\\d\\.\\'lhjztL]*([dicuoxfegXFEG])";
+static const char *labelFormatMatchLocalizedString = "^([^%]*)%\\.(\\d+)([defgiEG])(.*)$";
+
+LabelFormatter::LabelFormatter()
+    : m_spec(0),
+      m_fastPath(false),
+      m_fastPrecision(6),
+      m_localizedSpec(0),
+      m_localizedPrecision(6)
+{
+}
+
+LabelFormatter::LabelFormatter(const QString &format)
+    : m_spec(0),
+      m_fastPath(false),
+      m_fastPrecision(6),
+      m_localizedSpec(0),
+      m_localizedPrecision(6)
+{
+    setFormat(format);
+}
+
+void LabelFormatter::setFormat(const QString &format)
+{
+    m_format = format;
+    m_array = format.toLatin1();
+    m_spec = 0;
+    m_fastPath = false;
+    m_fastPrecision = 6; // Six is the default precision in Qt API
+    m_fastPrefix.clear();
+    m_fastSuffix.clear();
+    m_localizedSpec = 0;
+    m_localizedPrecision = 6;
+    m_localizedPrefix.clear();
+    m_localizedSuffix.clear();
+
+    if (format.isEmpty())
+        return;
+
+    QRegExp matcher(QString::fromLatin1(labelFormatMatchString));
+    if (matcher.indexIn(format, 0) != -1)
+        m_spec = matcher.cap(1).at(0).toLatin1();
+
+    QRegExp localizedMatcher(QString::fromLatin1(labelFormatMatchLocalizedString));
+    if (localizedMatcher.indexIn(format, 0) != -1) {
+        m_localizedPrefix = localizedMatcher.cap(1);
+        m_localizedPrecision = localizedMatcher.cap(2).toInt();
+        m_localizedSpec = localizedMatcher.cap(3).at(0).toLatin1();
+        m_localizedSuffix = localizedMatcher.cap(4);
+    }
+
+    // Formats without flags, width or length modifiers produce the same output with
+    // QString::number() as with sprintf, which avoids the varargs formatting per label.
+    const int percent = format.indexOf(QLatin1Char('%'));
+    if (percent < 0)
+        return;
+    int pos = percent + 1;
+    bool hasPrecision = false;
+    int precision = 6;
+    if (pos < format.size() && format.at(pos) == QLatin1Char('.')) {
+        const int digitsStart = ++pos;
+        while (pos < format.size() && format.at(pos).isDigit())
+            pos++;
+        if (pos == digitsStart)
+            return;
+        hasPrecision = true;
+        precision = format.mid(digitsStart, pos - digitsStart).toInt();
+    }
+    if (pos >= format.size())
+        return;
+    const char spec = format.at(pos).toLatin1();
+    const QString suffix = format.mid(pos + 1);
+    if (suffix.contains(QLatin1Char('%')))
+        return;
+    switch (spec) {
+    case 'd':
+    case 'i':
+        // Precision means minimum number of digits for integers
+        if (hasPrecision)
+            return;
+        break;
+    case 'f':
+    case 'e':
+    case 'E':
+        break;
+    default:
+        return;
+    }
+    m_fastPath = true;
+    m_fastPrecision = precision;
+    m_fastPrefix = format.left(percent);
+    m_fastSuffix = suffix;
+}
+
+QString LabelFormatter::toString(qreal value, bool localize, const QLocale &locale) const
+{
+    if (localize) {
+        switch (m_localizedSpec) {
+        case 0:
+            return QString();
+        case 'd':
+        case 'i':
+            return m_localizedPrefix + locale.toString(qint64(value)) + m_localizedSuffix;
+        default:
+            return m_localizedPrefix
+                    + locale.toString(value, m_localizedSpec, m_localizedPrecision)
+                    + m_localizedSuffix;
+        }
+    }
+
+    if (m_fastPath) {
+        if (m_spec == 'd' || m_spec == 'i')
+            return m_fastPrefix + QString::number(qint64(value)) + m_fastSuffix;
+        return m_fastPrefix + QString::number(value, m_spec, m_fastPrecision) + m_fastSuffix;
+    }
+
+    switch (m_spec) {
+    case 'd':
+    case 'i':
+    case 'c':
+        return QString().sprintf(m_array, qint64(value));
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+        // These formats are not supported by localized numbers
+        return QString().sprintf(m_array, quint64(value));
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+        return QString().sprintf(m_array, value);
+    default:
+        return QString();
+    }
+}
+
+LabelTemplate::LabelTemplate()
+    : m_literalLength(0)
+{
+}
+
+LabelTemplate::LabelTemplate(const QString &format, const QStringList &tags)
+    : m_format(format),
+      m_literalLength(0)
+{
+    int pos = 0;
+    int literalStart = 0;
+    while (pos < format.size()) {
+        int matchedTag = -1;
+        for (int i = 0; i < tags.size(); i++) {
+            if (!tags.at(i).isEmpty() && format.midRef(pos, tags.at(i).size()) == tags.at(i)) {
+                matchedTag = i;
+                break;
+            }
+        }
+        if (matchedTag < 0) {
+            pos++;
+            continue;
+        }
+        if (pos > literalStart) {
+            Segment literal;
+            literal.text = format.mid(literalStart, pos - literalStart);
+            m_literalLength += literal.text.size();
+            m_segments.append(literal);
+        }
+        Segment tag;
+        tag.tag = matchedTag;
+        m_segments.append(tag);
+        pos += tags.at(matchedTag).size();
+        literalStart = pos;
+    }
+    if (pos > literalStart) {
+        Segment literal;
+        literal.text = format.mid(literalStart, pos - literalStart);
+        m_literalLength += literal.text.size();
+        m_segments.append(literal);
+    }
+}
+
+bool LabelTemplate::containsTag(int tag) const
+{
+    foreach (const Segment &segment, m_segments) {
+        if (segment.tag == tag)
+            return true;
+    }
+    return false;
+}
+
+QString LabelTemplate::expand(const QString &value) const
+{
+    return expand(&value, 1);
+}
+
+QString LabelTemplate::expand(const QString &value1, const QString &value2) const
+{
+    const QString values[2] = { value1, value2 };
+    return expand(values, 2);
+}
+
+QString LabelTemplate::expand(const QString *values, int count) const
+{
+    int length = m_literalLength;
+    foreach (const Segment &segment, m_segments) {
+        if (segment.tag >= 0 && segment.tag < count)
+            length += values[segment.tag].size();
+    }
+
+    QString result;
+    result.reserve(length);
+    foreach (const Segment &segment, m_segments) {
+        if (segment.tag < 0)
+            result.append(segment.text);
+        else if (segment.tag < count)
+            result.append(values[segment.tag]);
+    }
+    return result;
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,114 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef LABELFORMATTER_P_H
+#define LABELFORMATTER_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QByteArray>
+#include <QtCore/QVector>
+#include <QtCore/QLocale>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Printf-style numeric label format (e.g. QValueAxis::labelFormat) that is parsed once when
+// the format is set, so that generating labels does not need to run any regular expressions.
+class QT_CHARTS_AUTOTEST_EXPORT LabelFormatter
+{
+public:
+    LabelFormatter();
+    explicit LabelFormatter(const QString &format);
+
+    void setFormat(const QString &format);
+    QString format() const { return m_format; }
+    bool isNull() const { return m_format.isNull(); }
+
+    QString toString(qreal value, bool localize, const QLocale &locale) const;
+
+private:
+    QString m_format;
+    QByteArray m_array;
+    // Conversion character of the printf-style format, or 0 if the format has none
+    char m_spec;
+    // Format is a plain "<prefix>%[.precision]<spec><suffix>", which can skip sprintf
+    bool m_fastPath;
+    int m_fastPrecision;
+    QString m_fastPrefix;
+    QString m_fastSuffix;
+    // Parsed "<prefix>%.<precision><spec><suffix>" used when numbers are localized
+    char m_localizedSpec;
+    int m_localizedPrecision;
+    QString m_localizedPrefix;
+    QString m_localizedSuffix;
+};
+
+// Label template with tags (e.g. "@xPoint, @yPoint" or "@value") split into literal and tag
+// segments once, so that expanding it does not need to search and replace the whole string.
+class QT_CHARTS_AUTOTEST_EXPORT LabelTemplate
+{
+public:
+    LabelTemplate();
+    LabelTemplate(const QString &format, const QStringList &tags);
+
+    QString format() const { return m_format; }
+    bool isEmpty() const { return m_format.isEmpty(); }
+    bool containsTag(int tag) const;
+
+    QString expand(const QString &value) const;
+    QString expand(const QString &value1, const QString &value2) const;
+
+private:
+    struct Segment {
+        Segment() : tag(-1) {}
+        QString text;
+        int tag; // -1 for literal text
+    };
+
+    QString expand(const QString *values, int count) const;
+
+    QString m_format;
+    QVector<Segment> m_segments;
+    int m_literalLength;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // LABELFORMATTER_P_H
@@ -41,7 +41,10 @@ static const qreal golden_ratio = 0.4;
 
 AbstractChartLayout::AbstractChartLayout(ChartPresenter *presenter)
     : m_presenter(presenter),
-      m_margins(20, 20, 20, 20)
+      m_margins(20, 20, 20, 20),
+      m_dirty(false),
+      m_layoutRequestCount(0),
+      m_layoutPassCount(0)
 {
 }
 
@@ -54,6 +57,15 @@ void AbstractChartLayout::setGeometry(const QRectF &rect)
     if (!rect.isValid())
         return;
 
+    // The pass is done once the chart update ends
+    if (m_presenter->isUpdating()) {
+        QGraphicsLayout::setGeometry(rect);
+        return;
+    }
+
+    m_dirty = false;
+    m_layoutPassCount++;
+
     if (m_presenter->chart()->isVisible()) {
         QList<ChartAxisElement *> axes = m_presenter->axisItems();
         ChartTitle *title = m_presenter->titleElement();
@@ -82,6 +94,30 @@ void AbstractChartLayout::setGeometry(const QRectF &rect)
     QGraphicsLayout::setGeometry(rect);
 }
 
+void AbstractChartLayout::invalidate()
+{
+    // Invalidation is coalesced by QGraphicsLayout into a single LayoutRequest event, and during a
+    // chart update into the single invalidation done when it ends
+    m_layoutRequestCount++;
+    if (!m_presenter->isUpdating())
+        QGraphicsLayout::invalidate();
+}
+
+bool AbstractChartLayout::markDirty()
+{
+    m_layoutRequestCount++;
+    if (m_dirty)
+        return false;
+    m_dirty = true;
+    return true;
+}
+
+void AbstractChartLayout::resetLayoutCounters()
+{
+    m_layoutRequestCount = 0;
+    m_layoutPassCount = 0;
+}
+
 QRectF AbstractChartLayout::calculateContentGeometry(const QRectF &geometry) const
 {
     return geometry.adjusted(m_margins.left(), m_margins.top(), -m_margins.right(), -m_margins.bottom());
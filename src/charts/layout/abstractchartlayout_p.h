@@ -60,6 +60,18 @@ public:
     virtual void setMargins(const QMargins &margins);
     virtual QMargins margins() const;
     virtual void setGeometry(const QRectF &rect);
+    virtual void invalidate();
+
+    // Deferred layout passes requested through ChartPresenter::scheduleLayout()
+    bool markDirty();
+    void setDirty(bool dirty) { m_dirty = dirty; }
+    bool isDirty() const { return m_dirty; }
+
+    // Instrumentation for how many layout requests were coalesced into a single pass
+    int layoutRequestCount() const { return m_layoutRequestCount; }
+    int layoutPassCount() const { return m_layoutPassCount; }
+    int savedLayoutPassCount() const { return qMax(0, m_layoutRequestCount - m_layoutPassCount); }
+    void resetLayoutCounters();
 
 protected:
     virtual QRectF calculateBackgroundGeometry(const QRectF &geometry, ChartBackground *background) const;
@@ -83,6 +95,9 @@ protected:
     ChartPresenter *m_presenter;
     QMargins m_margins;
     QRectF m_minAxisRect;
+    bool m_dirty;
+    int m_layoutRequestCount;
+    int m_layoutPassCount;
 };
 
 QT_CHARTS_END_NAMESPACE
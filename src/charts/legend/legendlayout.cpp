@@ -35,13 +35,21 @@
 #include <private/qlegendmarker_p.h>
 #include <private/legendmarkeritem_p.h>
 #include <QtCharts/QLegendMarker>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Legends with more markers than this lay out only the markers around the visible part of the
+// legend
+static const int virtualLayoutThreshold = 100;
+
 LegendLayout::LegendLayout(QLegend *legend)
     : m_legend(legend),
       m_offsetX(0),
-      m_offsetY(0)
+      m_offsetY(0),
+      m_virtualExtent(0),
+      m_virtualPage(0),
+      m_virtualHorizontal(false)
 {
 
 }
@@ -51,7 +59,7 @@ LegendLayout::~LegendLayout()
 
 }
 
-void LegendLayout::setOffset(qreal x, qreal y)
+bool LegendLayout::scrollsHorizontally() const
 {
     bool scrollHorizontal = true;
     switch (m_legend->alignment()) {
@@ -68,6 +76,12 @@ void LegendLayout::setOffset(qreal x, qreal y)
     // If detached, the scrolling direction is vertical instead of horizontal and vice versa.
     if (!m_legend->isAttachedToChart())
         scrollHorizontal = !scrollHorizontal;
+    return scrollHorizontal;
+}
+
+void LegendLayout::setOffset(qreal x, qreal y)
+{
+    const bool scrollHorizontal = scrollsHorizontally();
 
     QRectF boundingRect = geometry();
     qreal left, top, right, bottom;
@@ -82,6 +96,7 @@ void LegendLayout::setOffset(qreal x, qreal y)
         if (x != m_offsetX) {
             m_offsetX = qBound(m_minOffsetX, x, m_maxOffsetX);
             m_legend->d_ptr->items()->setPos(-m_offsetX, boundingRect.top());
+            layoutVisibleItems();
         }
     } else {
         if (m_height <= boundingRect.height())
@@ -90,6 +105,7 @@ void LegendLayout::setOffset(qreal x, qreal y)
         if (y != m_offsetY) {
             m_offsetY = qBound(m_minOffsetY, y, m_maxOffsetY);
             m_legend->d_ptr->items()->setPos(boundingRect.left(), -m_offsetY);
+            layoutVisibleItems();
         }
     }
 }
@@ -101,6 +117,9 @@ QPointF LegendLayout::offset() const
 
 void LegendLayout::invalidate()
 {
+    // The markers might be gone
+    m_virtualItems.clear();
+
     QGraphicsLayout::invalidate();
     if (m_legend->isAttachedToChart())
         m_legend->d_ptr->m_presenter->layout()->invalidate();
@@ -110,6 +129,10 @@ void LegendLayout::setGeometry(const QRectF &rect)
 {
     m_legend->d_ptr->items()->setVisible(m_legend->isVisible());
 
+    m_virtualItems.clear();
+    m_virtualExtent = 0;
+    m_virtualHorizontal = scrollsHorizontally();
+
     QGraphicsLayout::setGeometry(rect);
 
     if (m_legend->isAttachedToChart())
@@ -145,13 +168,17 @@ void LegendLayout::setAttachedGeometry(const QRectF &rect)
     switch(m_legend->alignment()) {
     case Qt::AlignTop:
     case Qt::AlignBottom: {
-            // Calculate the space required for items and add them to a sorted list.
+            // Calculate the space required for items and add them to a sorted list. So many
+            // markers that they are laid out virtually would not fit even when truncated, so
+            // they keep their preferred widths and the legend scrolls instead.
+            int markerCount = m_legend->d_ptr->markers().count();
+            const bool virtualLayout = markerCount > virtualLayoutThreshold;
             qreal markerItemsWidth = 0;
             qreal itemMargins = 0;
             QList<LegendWidthStruct *> legendWidthList;
             foreach (QLegendMarker *marker, m_legend->d_ptr->markers()) {
                 LegendMarkerItem *item = marker->d_ptr->item();
-                if (item->isVisible()) {
+                if (item->isVisible() && !virtualLayout) {
                     QSizeF dummySize;
                     qreal itemWidth = item->sizeHint(Qt::PreferredSize, dummySize).width();
                     LegendWidthStruct *structItem = new LegendWidthStruct;
@@ -214,7 +241,6 @@ void LegendLayout::setAttachedGeometry(const QRectF &rect)
 
             QPointF point(0,0);
 
-            int markerCount = m_legend->d_ptr->markers().count();
             for (int i = 0; i < markerCount; i++) {
                 QLegendMarker *marker;
                 if (m_legend->d_ptr->m_reverseMarkers)
@@ -222,7 +248,16 @@ void LegendLayout::setAttachedGeometry(const QRectF &rect)
                 else
                     marker = m_legend->d_ptr->markers().at(i);
                 LegendMarkerItem *item = marker->d_ptr->item();
-                if (item->isVisible()) {
+                if (item->isVisible() && virtualLayout) {
+                    const QSizeF itemSize = layoutItem(item, geometry, true);
+                    QRectF itemRect = geometry;
+                    itemRect.setWidth(itemSize.width());
+                    item->setPos(point.x(), geometry.height() / 2 - itemSize.height() / 2);
+                    addVirtualItem(item, QRectF(item->pos(), itemSize), itemRect);
+                    size = size.expandedTo(itemSize);
+                    m_width = m_width + itemSize.width() - item->m_margin;
+                    point.setX(point.x() + itemSize.width());
+                } else if (item->isVisible()) {
                     QRectF itemRect = geometry;
                     qreal availableWidth = 0;
                     for (int i = 0; i < legendWidthList.size(); ++i) {
@@ -258,6 +293,7 @@ void LegendLayout::setAttachedGeometry(const QRectF &rect)
     case Qt::AlignRight: {
             QPointF point(0,0);
             int markerCount = m_legend->d_ptr->markers().count();
+            const bool virtualLayout = markerCount > virtualLayoutThreshold;
             for (int i = 0; i < markerCount; i++) {
                 QLegendMarker *marker;
                 if (m_legend->d_ptr->m_reverseMarkers)
@@ -265,7 +301,16 @@ void LegendLayout::setAttachedGeometry(const QRectF &rect)
                 else
                     marker = m_legend->d_ptr->markers().at(i);
                 LegendMarkerItem *item = marker->d_ptr->item();
-                if (item->isVisible()) {
+                if (item->isVisible() && virtualLayout) {
+                    // The height of a marker doesn't depend on the truncation of its label, so
+                    // the size hint is enough to place it
+                    const QSizeF itemSize = layoutItem(item, geometry, true);
+                    item->setPos(point);
+                    addVirtualItem(item, QRectF(point, itemSize), geometry);
+                    size = size.expandedTo(itemSize);
+                    m_height += itemSize.height();
+                    point.setY(point.y() + itemSize.height());
+                } else if (item->isVisible()) {
                     item->setGeometry(geometry);
                     item->setPos(point);
                     const QRectF &rect = item->boundingRect();
@@ -293,7 +338,63 @@ void LegendLayout::setAttachedGeometry(const QRectF &rect)
     m_maxOffsetX = m_width - geometry.width() - right;
     m_maxOffsetY = m_height - geometry.height() - bottom;
 
+    finishVirtualLayout(geometry);
     setOffset(oldOffsetX, oldOffsetY);
+    layoutVisibleItems();
+}
+
+// Returns the size of the item laid out in the geometry. With the virtual layout the item is only
+// measured by its size hint, and laid out once it gets near the visible part of the legend.
+QSizeF LegendLayout::layoutItem(LegendMarkerItem *item, const QRectF &geometry, bool virtualLayout)
+{
+    if (virtualLayout) {
+        // A laid out item is a margin wider than its size hint
+        const QSizeF size = item->sizeHint(Qt::PreferredSize, QSizeF());
+        return QSizeF(qMin(size.width() + item->m_margin, geometry.width()), size.height());
+    }
+    item->setGeometry(geometry);
+    return item->boundingRect().size();
+}
+
+void LegendLayout::addVirtualItem(LegendMarkerItem *item, const QRectF &rect,
+                                  const QRectF &geometry)
+{
+    VirtualItem virtualItem;
+    virtualItem.item = item;
+    virtualItem.position = m_virtualHorizontal ? rect.left() : rect.top();
+    virtualItem.geometry = geometry;
+    virtualItem.laidOut = false;
+    m_virtualItems.append(virtualItem);
+    m_virtualExtent = qMax(m_virtualExtent, m_virtualHorizontal ? rect.width() : rect.height());
+}
+
+// Sorts the virtually placed markers by their position, as the rows and columns of a detached
+// legend can be placed from the right or from the bottom
+void LegendLayout::finishVirtualLayout(const QRectF &geometry)
+{
+    m_virtualPage = m_virtualHorizontal ? geometry.width() : geometry.height();
+    std::stable_sort(m_virtualItems.begin(), m_virtualItems.end(), positionLessThan);
+}
+
+// Lays out the virtually placed markers that are within a page of the visible part of the legend
+void LegendLayout::layoutVisibleItems()
+{
+    if (m_virtualItems.isEmpty())
+        return;
+
+    const qreal offset = m_virtualHorizontal ? m_offsetX : m_offsetY;
+    const qreal first = offset - m_virtualPage - m_virtualExtent;
+    const qreal last = offset + 2 * m_virtualPage;
+
+    QVector<VirtualItem>::iterator i = std::lower_bound(m_virtualItems.begin(),
+                                                        m_virtualItems.end(), first,
+                                                        positionBefore);
+    for (; i != m_virtualItems.end() && i->position < last; ++i) {
+        if (!i->laidOut) {
+            i->item->setGeometry(i->geometry);
+            i->laidOut = true;
+        }
+    }
 }
 
 void LegendLayout::setDettachedGeometry(const QRectF &rect)
@@ -322,6 +423,8 @@ void LegendLayout::setDettachedGeometry(const QRectF &rect)
     if (markers.isEmpty())
         return;
 
+    const bool virtualLayout = markers.count() > virtualLayoutThreshold;
+
     switch (m_legend->alignment()) {
     case Qt::AlignTop: {
         QPointF point(0, 0);
@@ -330,11 +433,12 @@ void LegendLayout::setDettachedGeometry(const QRectF &rect)
         for (int i = 0; i < markers.count(); i++) {
             LegendMarkerItem *item = markers.at(i)->d_ptr->item();
             if (item->isVisible()) {
-                item->setGeometry(geometry);
+                const QSizeF itemSize = layoutItem(item, geometry, virtualLayout);
                 item->setPos(point.x(),point.y());
-                const QRectF &boundingRect = item->boundingRect();
-                qreal w = boundingRect.width();
-                qreal h = boundingRect.height();
+                if (virtualLayout)
+                    addVirtualItem(item, QRectF(item->pos(), itemSize), geometry);
+                qreal w = itemSize.width();
+                qreal h = itemSize.height();
                 m_width = qMax(m_width,w);
                 m_height = qMax(m_height,h);
                 point.setX(point.x() + w);
@@ -363,13 +467,14 @@ void LegendLayout::setDettachedGeometry(const QRectF &rect)
         for (int i = 0; i < markers.count(); i++) {
             LegendMarkerItem *item = markers.at(i)->d_ptr->item();
             if (item->isVisible()) {
-                item->setGeometry(geometry);
-                const QRectF &boundingRect = item->boundingRect();
-                qreal w = boundingRect.width();
-                qreal h = boundingRect.height();
+                const QSizeF itemSize = layoutItem(item, geometry, virtualLayout);
+                qreal w = itemSize.width();
+                qreal h = itemSize.height();
                 m_width = qMax(m_width,w);
                 m_height = qMax(m_height,h);
                 item->setPos(point.x(),point.y() - h);
+                if (virtualLayout)
+                    addVirtualItem(item, QRectF(item->pos(), itemSize), geometry);
                 point.setX(point.x() + w);
                 if (point.x() + w > geometry.left() + geometry.width() - right) {
                     // Next item would go off rect.
@@ -397,13 +502,14 @@ void LegendLayout::setDettachedGeometry(const QRectF &rect)
         for (int i = 0; i < markers.count(); i++) {
             LegendMarkerItem *item = markers.at(i)->d_ptr->item();
             if (item->isVisible()) {
-                item->setGeometry(geometry);
-                const QRectF &boundingRect = item->boundingRect();
-                qreal w = boundingRect.width();
-                qreal h = boundingRect.height();
+                const QSizeF itemSize = layoutItem(item, geometry, virtualLayout);
+                qreal w = itemSize.width();
+                qreal h = itemSize.height();
                 m_height = qMax(m_height,h);
                 maxWidth = qMax(maxWidth,w);
                 item->setPos(point.x(),point.y());
+                if (virtualLayout)
+                    addVirtualItem(item, QRectF(item->pos(), itemSize), geometry);
                 point.setY(point.y() + h);
                 if (point.y() + h > geometry.bottom() - bottom) {
                     // Next item would go off rect.
@@ -433,13 +539,14 @@ void LegendLayout::setDettachedGeometry(const QRectF &rect)
         for (int i = 0; i < markers.count(); i++) {
             LegendMarkerItem *item = markers.at(i)->d_ptr->item();
             if (item->isVisible()) {
-                item->setGeometry(geometry);
-                const QRectF &boundingRect = item->boundingRect();
-                qreal w = boundingRect.width();
-                qreal h = boundingRect.height();
+                const QSizeF itemSize = layoutItem(item, geometry, virtualLayout);
+                qreal w = itemSize.width();
+                qreal h = itemSize.height();
                 m_height = qMax(m_height,h);
                 maxWidth = qMax(maxWidth,w);
                 item->setPos(point.x() - w,point.y());
+                if (virtualLayout)
+                    addVirtualItem(item, QRectF(item->pos(), itemSize), geometry);
                 point.setY(point.y() + h);
                 if (point.y() + h > geometry.bottom()-bottom) {
                     // Next item would go off rect.
@@ -465,7 +572,9 @@ void LegendLayout::setDettachedGeometry(const QRectF &rect)
         break;
     }
 
+    finishVirtualLayout(geometry);
     setOffset(oldOffsetX, oldOffsetY);
+    layoutVisibleItems();
 }
 
 QSizeF LegendLayout::sizeHint(Qt::SizeHint which, const QSizeF &constraint) const
@@ -518,4 +627,14 @@ bool LegendLayout::widthLongerThan(const LegendWidthStruct *item1,
     return item1->width > item2->width;
 }
 
+bool LegendLayout::positionLessThan(const VirtualItem &item1, const VirtualItem &item2)
+{
+    return item1.position < item2.position;
+}
+
+bool LegendLayout::positionBefore(const VirtualItem &item, qreal position)
+{
+    return item.position < position;
+}
+
 QT_CHARTS_END_NAMESPACE
@@ -40,6 +40,7 @@
 #define LEGENDLAYOUT_H
 #include <QtWidgets/QGraphicsLayout>
 #include <QtCharts/QChartGlobal>
+#include <QtCore/QVector>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -68,6 +69,11 @@ protected:
 private:
     void setAttachedGeometry(const QRectF &rect);
     void setDettachedGeometry(const QRectF &rect);
+    bool scrollsHorizontally() const;
+    QSizeF layoutItem(LegendMarkerItem *item, const QRectF &geometry, bool virtualLayout);
+    void addVirtualItem(LegendMarkerItem *item, const QRectF &rect, const QRectF &geometry);
+    void finishVirtualLayout(const QRectF &geometry);
+    void layoutVisibleItems();
 
     struct LegendWidthStruct {
         LegendMarkerItem *item;
@@ -76,6 +82,15 @@ private:
     static bool widthLongerThan(const LegendWidthStruct *item1,
                                 const LegendWidthStruct *item2);
 
+    struct VirtualItem {
+        LegendMarkerItem *item;
+        qreal position; // along the scrolling direction
+        QRectF geometry;
+        bool laidOut;
+    };
+    static bool positionLessThan(const VirtualItem &item1, const VirtualItem &item2);
+    static bool positionBefore(const VirtualItem &item, qreal position);
+
 private:
     QLegend *m_legend;
     qreal m_offsetX;
@@ -86,6 +101,13 @@ private:
     qreal m_maxOffsetY;
     qreal m_width;
     qreal m_height;
+
+    // Markers of a legend with many markers, which are placed by their size hints and only laid
+    // out when they are near the visible part of the legend
+    QVector<VirtualItem> m_virtualItems;
+    qreal m_virtualExtent; // the largest size of a marker in the scrolling direction
+    qreal m_virtualPage;
+    bool m_virtualHorizontal;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -112,6 +112,7 @@ void LegendMarkerItem::setFont(const QFont &font)
 {
     QFontMetrics fn(font);
     m_font = font;
+    m_labelSize = QSizeF();
 
     m_defaultMarkerRect = QRectF(0, 0, fn.height() / 2, fn.height() / 2);
     if (effectiveMarkerShape() != QLegend::MarkerShapeFromSeries)
@@ -127,6 +128,7 @@ QFont LegendMarkerItem::font() const
 void LegendMarkerItem::setLabel(const QString label)
 {
     m_label = label;
+    m_labelSize = QSizeF();
     updateGeometry();
 }
 
@@ -210,9 +212,11 @@ QSizeF LegendMarkerItem::sizeHint(Qt::SizeHint which, const QSizeF& constraint)
         break;
     }
     case Qt::PreferredSize: {
-        const QRectF labelRect = ChartPresenter::textBoundingRect(m_font, m_label);
-        sh = QSizeF(labelRect.width() + (2.0 * m_margin) + m_space + markerWidth,
-                    qMax(m_markerRect.height(), labelRect.height()) + (2.0 * m_margin));
+        // Measuring the label is the expensive part of the layout, so it's done only once
+        if (!m_labelSize.isValid())
+            m_labelSize = ChartPresenter::textBoundingRect(m_font, m_label).size();
+        sh = QSizeF(m_labelSize.width() + (2.0 * m_margin) + m_space + markerWidth,
+                    qMax(m_markerRect.height(), m_labelSize.height()) + (2.0 * m_margin));
         break;
     }
     default:
@@ -123,6 +123,7 @@ protected:
     qreal m_margin;
     qreal m_space;
     QString m_label;
+    mutable QSizeF m_labelSize; // Size of the whole label, invalid until measured
     QLegend::MarkerShape m_markerShape;
 
     QBrush m_labelBrush;
@@ -39,6 +39,7 @@
 #include <private/qlegendmarker_p.h>
 #include <private/legendmarkeritem_p.h>
 #include <private/chartdataset_p.h>
+#include <QtCore/QSet>
 #include <QtGui/QPainter>
 #include <QtGui/QPen>
 #include <QtWidgets/QGraphicsItemGroup>
@@ -56,6 +57,12 @@ QT_CHARTS_BEGIN_NAMESPACE
     detached to make it independent of chart layout. Legend objects cannot be created or deleted,
     but they can be referenced via the QChart class.
 
+    A legend with more than 100 markers places them by their preferred sizes and lays out only
+    the markers near its visible part, as it is scrolled. The labels of such an attached legend
+    at the top or bottom of the chart are not truncated to fit, and the legend scrolls instead.
+    Every marker still has its own QLegendMarker object and graphics item, so the memory and the
+    time it takes to add series grow with the number of markers.
+
     \image examples_percentbarchart_legend.png
 
     \sa QChart
@@ -264,6 +271,7 @@ QLegend::QLegend(QChart *chart): QGraphicsWidget(chart),
     setFlags(QGraphicsItem::ItemClipsChildrenToShape);
     QObject::connect(chart->d_ptr->m_dataset, SIGNAL(seriesAdded(QAbstractSeries*)), d_ptr.data(), SLOT(handleSeriesAdded(QAbstractSeries*)));
     QObject::connect(chart->d_ptr->m_dataset, SIGNAL(seriesRemoved(QAbstractSeries*)), d_ptr.data(), SLOT(handleSeriesRemoved(QAbstractSeries*)));
+    QObject::connect(chart->d_ptr->m_dataset, SIGNAL(updateFinished()), d_ptr.data(), SLOT(handleUpdateFinished()));
     setLayout(d_ptr->m_layout);
 }
 
@@ -676,6 +684,7 @@ void QLegendPrivate::handleSeriesRemoved(QAbstractSeries *series)
     if (m_series.contains(series)) {
         m_series.removeOne(series);
     }
+    m_countChangedSeries.removeOne(series);
 
     // Find out, which markers to remove
     QList<QLegendMarker *> removed;
@@ -713,28 +722,64 @@ void QLegendPrivate::handleCountChanged()
     // Can happen for example when pieslice(s) have been added to or removed from pieseries.
 
     QAbstractSeriesPrivate *series = qobject_cast<QAbstractSeriesPrivate *> (sender());
-    QList<QLegendMarker *> createdMarkers = series->createLegendMarkers(q_ptr);
 
-    // Find out removed markers and created markers
-    QList<QLegendMarker *> removedMarkers;
-    foreach (QLegendMarker *oldMarker, m_markers) {
-        // we have marker, which is related to sender.
-        if (oldMarker->series() == series->q_ptr) {
-            bool found = false;
-            foreach(QLegendMarker *newMarker, createdMarkers) {
-                // New marker considered existing if:
-                // - d_ptr->relatedObject() is same for both markers.
-                if (newMarker->d_ptr->relatedObject() == oldMarker->d_ptr->relatedObject()) {
-                    // Delete the new marker, since we already have existing marker, that might be connected on user side.
-                    found = true;
-                    createdMarkers.removeOne(newMarker);
-                    delete newMarker;
+    // During a chart update the markers of the series are synchronized once when it ends.
+    // Removed slices and sets are deleted before that, so their markers go with them.
+    if (m_presenter->isUpdating()) {
+        if (!m_countChangedSeries.contains(series->q_ptr)) {
+            m_countChangedSeries << series->q_ptr;
+            foreach (QLegendMarker *marker, m_markers) {
+                if (marker->series() == series->q_ptr) {
+                    QObject::connect(marker->d_ptr->relatedObject(), SIGNAL(destroyed(QObject*)),
+                                     this, SLOT(handleRelatedObjectDestroyed(QObject*)),
+                                     Qt::UniqueConnection);
                 }
             }
-            if (!found) {
-                // No related object found for marker, add to removedMarkers list
-                removedMarkers << oldMarker;
-            }
+        }
+        return;
+    }
+
+    updateMarkers(series);
+}
+
+void QLegendPrivate::handleRelatedObjectDestroyed(QObject *object)
+{
+    QLegendMarker *marker = m_relatedMarkers.value(object);
+    if (marker) {
+        removeMarkers(QList<QLegendMarker *>() << marker);
+        q_ptr->layout()->invalidate();
+    }
+}
+
+void QLegendPrivate::handleUpdateFinished()
+{
+    QList<QAbstractSeries *> series;
+    series.swap(m_countChangedSeries);
+    foreach (QAbstractSeries *s, series)
+        updateMarkers(s->d_ptr.data());
+}
+
+void QLegendPrivate::updateMarkers(QAbstractSeriesPrivate *series)
+{
+    const QList<QObject *> objects = series->legendMarkerObjects();
+    QSet<QObject *> objectSet;
+    objectSet.reserve(objects.count());
+
+    // Existing markers are kept, since they might be connected on user side. Markers are only
+    // created for the related objects that don't have one yet.
+    QList<QLegendMarker *> createdMarkers;
+    foreach (QObject *object, objects) {
+        objectSet.insert(object);
+        if (!m_relatedMarkers.contains(object))
+            createdMarkers << series->createLegendMarker(object, q_ptr);
+    }
+
+    // Markers of the sender whose related object is gone are removed
+    QList<QLegendMarker *> removedMarkers;
+    foreach (QLegendMarker *oldMarker, m_markers) {
+        if (oldMarker->series() == series->q_ptr
+            && !objectSet.contains(oldMarker->d_ptr->relatedObject())) {
+            removedMarkers << oldMarker;
         }
     }
 
@@ -751,6 +796,7 @@ void QLegendPrivate::addMarkers(QList<QLegendMarker *> markers)
         m_items->addToGroup(marker->d_ptr.data()->item());
         m_markers << marker;
         m_markerHash.insert(marker->d_ptr->item(), marker);
+        m_relatedMarkers.insert(marker->d_ptr->relatedObject(), marker);
     }
 }
 
@@ -761,6 +807,8 @@ void QLegendPrivate::removeMarkers(QList<QLegendMarker *> markers)
         m_items->removeFromGroup(marker->d_ptr->item());
         m_markers.removeOne(marker);
         m_markerHash.remove(marker->d_ptr->item());
+        if (m_relatedMarkers.value(marker->d_ptr->relatedObject()) == marker)
+            m_relatedMarkers.remove(marker->d_ptr->relatedObject());
         delete marker;
     }
 }
@@ -46,6 +46,7 @@ QT_CHARTS_BEGIN_NAMESPACE
 class QChart;
 class ChartPresenter;
 class QAbstractSeries;
+class QAbstractSeriesPrivate;
 class LegendLayout;
 class QLegendMarker;
 
@@ -70,12 +71,15 @@ public Q_SLOTS:
     void handleSeriesRemoved(QAbstractSeries *series);
     void handleSeriesVisibleChanged();
     void handleCountChanged();
+    void handleUpdateFinished();
+    void handleRelatedObjectDestroyed(QObject *object);
 
 private:
     // Internal helpers
     void addMarkers(QList<QLegendMarker *> markers);
     void removeMarkers(QList<QLegendMarker *> markers);
     void decorateMarkers(QList<QLegendMarker *> markers);
+    void updateMarkers(QAbstractSeriesPrivate *series);
     void updateToolTips();
 
 private:
@@ -99,8 +103,11 @@ private:
 
     QList<QLegendMarker *> m_markers;
     QList<QAbstractSeries *> m_series;
+    // Series whose marker count changed during a chart update
+    QList<QAbstractSeries *> m_countChangedSeries;
 
     QHash<QGraphicsItem *, QLegendMarker *> m_markerHash;
+    QHash<QObject *, QLegendMarker *> m_relatedMarkers;
 
     friend class QLegend;
     friend class LegendMarkerItem;
@@ -383,7 +383,7 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
     clipRect.adjust(-x1, -y1, qMax(x1, x2), qMax(y1, y2));
 
     painter->save();
-    painter->setPen(m_linePen);
+    painter->setPen(previewPen(m_linePen));
     bool alwaysUsePath = false;
 
     if (m_series->chart()->chartType() == QChart::ChartTypePolar) {
@@ -400,7 +400,7 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
         painter->setClipRegion(fullPolarClipRegion);
         alwaysUsePath = true; // required for proper clipping
     } else {
-        painter->setClipRect(clipRect);
+        painter->setClipRect(mapFromPlotArea(clipRect));
     }
 
     if (m_pointsVisible) {
@@ -418,7 +418,8 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
         }
     }
 
-    if (m_pointLabelsVisible) {
+    // Point labels are left out of interactive previews until the geometry is recalculated
+    if (m_pointLabelsVisible && !isPreviewTransformed()) {
         if (m_pointLabelsClipping)
             painter->setClipping(true);
         else
@@ -57,6 +57,9 @@ public:
     explicit LineChartItem(QLineSeries *series, QGraphicsItem *item = 0);
     ~LineChartItem() {}
 
+    //from ChartItem
+    bool supportsPreviewTransform() const { return true; }
+
     //from QGraphicsItem
     QRectF boundingRect() const;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
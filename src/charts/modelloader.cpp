@@ -0,0 +1,90 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/modelloader_p.h>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// The cancel flag is checked between blocks of values
+static const int cancelCheckInterval = 65536;
+
+ModelLoader::ModelLoader(QObject *parent)
+    : QThread(parent),
+      m_valueCount(0),
+      m_cancelled(0)
+{
+}
+
+ModelLoader::~ModelLoader()
+{
+    cancel();
+}
+
+// Requests the values [first, first + count) of a section, count -1 meaning all the values
+// after first. Must be called before the loader is started.
+void ModelLoader::addSection(const NumericSection &section, int first, int count)
+{
+    int valueCount = section.count() - first;
+    if (count != -1)
+        valueCount = qMin(valueCount, count);
+
+    Section request;
+    request.values = section;
+    request.first = first;
+    request.count = qMax(valueCount, 0);
+    m_sections << request;
+    m_valueCount += request.count;
+}
+
+// Stops the worker thread and waits for it. The values read so far are dropped.
+void ModelLoader::cancel()
+{
+    m_cancelled.store(1);
+    wait();
+}
+
+void ModelLoader::run()
+{
+    QVector<QVector<qreal> > values(m_sections.count());
+    for (int i = 0; i < m_sections.count(); i++) {
+        const Section &section = m_sections.at(i);
+        QVector<qreal> &sectionValues = values[i];
+        sectionValues.resize(section.count);
+        for (int j = 0; j < section.count; j++) {
+            if (j % cancelCheckInterval == 0 && isCancelled())
+                return;
+            sectionValues[j] = section.values.at(section.first + j);
+        }
+    }
+    m_values.swap(values);
+}
+
+#include "moc_modelloader_p.cpp"
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,92 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef MODELLOADER_P_H
+#define MODELLOADER_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <private/qnumericcolumnaccess_p.h>
+#include <QtCore/QThread>
+#include <QtCore/QVector>
+#include <QtCore/QAtomicInt>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Models mapping at least this many values are read in a worker thread when the background
+// loading of a mapper is enabled
+static const int backgroundLoadingThreshold = 10000;
+
+// Copies the values of numeric model sections in a worker thread. The sections are requested in
+// the thread of the model, the worker only reads the arrays the model has returned, so the mapper
+// has to wait for it before the model changes them.
+class ModelLoader : public QThread
+{
+    Q_OBJECT
+
+public:
+    explicit ModelLoader(QObject *parent = 0);
+    ~ModelLoader();
+
+    void addSection(const NumericSection &section, int first, int count);
+    int sectionCount() const { return m_sections.count(); }
+    int valueCount() const { return m_valueCount; }
+    QVector<qreal> values(int index) const { return m_values.at(index); }
+
+    void cancel();
+    bool isCancelled() const { return m_cancelled.load(); }
+
+protected:
+    void run() Q_DECL_OVERRIDE;
+
+    struct Section {
+        NumericSection values;
+        int first;
+        int count;
+    };
+
+    QVector<Section> m_sections;
+    int m_valueCount;
+
+private:
+    QVector<QVector<qreal> > m_values;
+    QAtomicInt m_cancelled;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // MODELLOADER_P_H
@@ -38,13 +38,15 @@
 #include <private/chartpresenter_p.h>
 #include <private/chartdataset_p.h>
 #include <private/pieanimation_p.h>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
 PieChartItem::PieChartItem(QPieSeries *series, QGraphicsItem* item)
     : ChartItem(series->d_func(),item),
       m_series(series),
-      m_animation(0)
+      m_animation(0),
+      m_labelCullingPending(false)
 {
     Q_ASSERT(series);
 
@@ -56,7 +58,7 @@ PieChartItem::PieChartItem(QPieSeries *series, QGraphicsItem* item)
     connect(p, SIGNAL(horizontalPositionChanged()), this, SLOT(updateLayout()));
     connect(p, SIGNAL(verticalPositionChanged()), this, SLOT(updateLayout()));
     connect(p, SIGNAL(pieSizeChanged()), this, SLOT(updateLayout()));
-    connect(p, SIGNAL(calculatedDataChanged()), this, SLOT(updateLayout()));
+    connect(p, SIGNAL(calculatedDataChanged(QList<QPieSlice*>)), this, SLOT(handleSlicesUpdated(QList<QPieSlice*>)));
 
     // Note: the following does not affect as long as the item does not have anything to paint
     setZValue(ChartPresenter::PieSeriesZValue);
@@ -153,16 +155,27 @@ void PieChartItem::updateLayout()
     m_holeSize *= m_series->holeSize();
 
     // set layouts for existing slice items
-    foreach (QPieSlice *slice, m_series->slices()) {
+    QList<QPieSlice *> slices = m_series->slices();
+    slices << m_series->aggregatedSlice();
+    foreach (QPieSlice *slice, slices) {
         PieSliceItem *sliceItem = m_sliceItems.value(slice);
-        if (sliceItem) {
-            PieSliceData sliceData = updateSliceGeometry(slice);
-            if (m_animation)
-                presenter()->startAnimation(m_animation->updateValue(sliceItem, sliceData));
-            else
-                sliceItem->setLayout(sliceData);
-        }
+        if (sliceItem)
+            updateSliceLayout(slice, sliceItem);
     }
+    scheduleLabelCulling();
+
+    update();
+}
+
+void PieChartItem::handleSlicesUpdated(const QList<QPieSlice *> &slices)
+{
+    // only the slices whose percentage or angles changed need a new layout
+    foreach (QPieSlice *slice, slices) {
+        PieSliceItem *sliceItem = m_sliceItems.value(slice);
+        if (sliceItem)
+            updateSliceLayout(slice, sliceItem);
+    }
+    scheduleLabelCulling();
 
     update();
 }
@@ -177,6 +190,10 @@ void PieChartItem::handleSlicesAdded(QList<QPieSlice *> slices)
 
     bool startupAnimation = m_sliceItems.isEmpty();
 
+    // the aggregated slice gets its item along with the first slices
+    if (!m_sliceItems.contains(m_series->aggregatedSlice()))
+        slices << m_series->aggregatedSlice();
+
     foreach(QPieSlice * slice, slices) {
         PieSliceItem *sliceItem = new PieSliceItem(this);
         m_sliceItems.insert(slice, sliceItem);
@@ -202,12 +219,14 @@ void PieChartItem::handleSlicesAdded(QList<QPieSlice *> slices)
         connect(sliceItem, SIGNAL(released(Qt::MouseButtons)), slice, SIGNAL(released()));
         connect(sliceItem, SIGNAL(doubleClicked(Qt::MouseButtons)), slice, SIGNAL(doubleClicked()));
 
+        sliceItem->setVisible(QPieSeriesPrivate::fromSeries(m_series)->isSliceDrawn(slice));
         PieSliceData sliceData = updateSliceGeometry(slice);
         if (m_animation)
             presenter()->startAnimation(m_animation->addSlice(sliceItem, sliceData, startupAnimation));
         else
             sliceItem->setLayout(sliceData);
     }
+    scheduleLabelCulling();
 }
 
 void PieChartItem::handleSlicesRemoved(QList<QPieSlice *> slices)
@@ -231,6 +250,7 @@ void PieChartItem::handleSlicesRemoved(QList<QPieSlice *> slices)
         else
             delete sliceItem;
     }
+    scheduleLabelCulling();
 }
 
 void PieChartItem::handleSliceChanged()
@@ -242,12 +262,8 @@ void PieChartItem::handleSliceChanged()
     }
     Q_ASSERT(m_sliceItems.contains(slice));
 
-    PieSliceItem *sliceItem = m_sliceItems.value(slice);
-    PieSliceData sliceData = updateSliceGeometry(slice);
-    if (m_animation)
-        presenter()->startAnimation(m_animation->updateValue(sliceItem, sliceData));
-    else
-        sliceItem->setLayout(sliceData);
+    updateSliceLayout(slice, m_sliceItems.value(slice));
+    scheduleLabelCulling();
 
     update();
 }
@@ -271,6 +287,69 @@ PieSliceData PieChartItem::updateSliceGeometry(QPieSlice *slice)
     return sliceData;
 }
 
+void PieChartItem::updateSliceLayout(QPieSlice *slice, PieSliceItem *sliceItem)
+{
+    // slices merged into the aggregated slice have no visible item
+    bool drawn = QPieSeriesPrivate::fromSeries(m_series)->isSliceDrawn(slice);
+    sliceItem->setVisible(drawn);
+    if (!drawn)
+        return;
+
+    PieSliceData sliceData = updateSliceGeometry(slice);
+    if (m_animation)
+        presenter()->startAnimation(m_animation->updateValue(sliceItem, sliceData));
+    else
+        sliceItem->setLayout(sliceData);
+}
+
+// Culls the labels once after all the changes of the current event, instead of after each of them
+void PieChartItem::scheduleLabelCulling()
+{
+    if (m_labelCullingPending)
+        return;
+    m_labelCullingPending = true;
+    QMetaObject::invokeMethod(this, "handleScheduledLabelCulling", Qt::QueuedConnection);
+}
+
+void PieChartItem::handleScheduledLabelCulling()
+{
+    m_labelCullingPending = false;
+    if (m_series)
+        cullLabels();
+}
+
+// Hides the labels that would overlap the label of a larger slice
+void PieChartItem::cullLabels()
+{
+    QList<QPieSlice *> slices;
+    foreach (QPieSlice *slice, m_sliceItems.keys()) {
+        PieSliceItem *sliceItem = m_sliceItems.value(slice);
+        if (sliceItem->isVisible() && !sliceItem->labelRect().isNull())
+            slices << slice;
+    }
+    if (slices.isEmpty())
+        return; // no labels shown
+    std::sort(slices.begin(), slices.end(), [](QPieSlice *a, QPieSlice *b) {
+        return a->angleSpan() > b->angleSpan();
+    });
+
+    QVector<QRectF> placed;
+    foreach (QPieSlice *slice, slices) {
+        PieSliceItem *sliceItem = m_sliceItems.value(slice);
+        const QRectF rect = sliceItem->labelRect();
+        bool overlaps = false;
+        foreach (const QRectF &placedRect, placed) {
+            if (placedRect.intersects(rect)) {
+                overlaps = true;
+                break;
+            }
+        }
+        sliceItem->setLabelCulled(overlaps);
+        if (!overlaps)
+            placed << rect;
+    }
+}
+
 #include "moc_piechartitem_p.cpp"
 
 QT_CHARTS_END_NAMESPACE
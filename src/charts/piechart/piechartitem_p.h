@@ -80,16 +80,24 @@ public Q_SLOTS:
     void handleSlicesAdded(QList<QPieSlice *> slices);
     void handleSlicesRemoved(QList<QPieSlice *> slices);
     void handleSliceChanged();
+    void handleSlicesUpdated(const QList<QPieSlice *> &slices);
     void handleSeriesVisibleChanged();
     void handleOpacityChanged();
+    void scheduleLabelCulling();
 
     void setAnimation(PieAnimation *animation);
     ChartAnimation *animation() const;
 
     // From ChartItem
     void cleanup();
+
+private Q_SLOTS:
+    void handleScheduledLabelCulling();
+
 private:
     PieSliceData updateSliceGeometry(QPieSlice *slice);
+    void updateSliceLayout(QPieSlice *slice, PieSliceItem *sliceItem);
+    void cullLabels();
 
 private:
     QHash<QPieSlice *, PieSliceItem *> m_sliceItems;
@@ -99,7 +107,7 @@ private:
     qreal m_pieRadius;
     qreal m_holeSize;
     PieAnimation *m_animation;
-
+    bool m_labelCullingPending;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -51,6 +51,8 @@ QPointF offset(qreal angle, qreal length)
 PieSliceItem::PieSliceItem(QGraphicsItem *parent)
     : QGraphicsObject(parent),
       m_hovered(false),
+      m_labelFits(false),
+      m_labelCulled(false),
       m_mousePressed(false)
 {
     setAcceptHoverEvents(true);
@@ -90,7 +92,7 @@ void PieSliceItem::paint(QPainter *painter, const QStyleOptionGraphicsItem * /*o
     painter->drawPath(m_slicePath);
     painter->restore();
 
-    if (m_data.m_isLabelVisible) {
+    if (m_data.m_isLabelVisible && !m_labelCulled) {
         painter->save();
 
         // Pen for label arm not defined in the QPieSeries api, let's use brush's color instead
@@ -144,6 +146,24 @@ void PieSliceItem::setLayout(const PieSliceData &sliceData)
     update();
 }
 
+// Returns the rectangle the label takes in the pie, or a null rectangle if the label is not shown
+// for other reasons than culling
+QRectF PieSliceItem::labelRect() const
+{
+    if (!m_data.m_isLabelVisible || !m_labelFits)
+        return QRectF();
+    return mapRectToParent(m_labelItem->mapRectToParent(m_labelItem->boundingRect()));
+}
+
+void PieSliceItem::setLabelCulled(bool culled)
+{
+    if (m_labelCulled == culled)
+        return;
+    m_labelCulled = culled;
+    m_labelItem->setVisible(m_data.m_isLabelVisible && m_labelFits && !m_labelCulled);
+    update();
+}
+
 void PieSliceItem::updateGeometry()
 {
     if (m_data.m_radius <= 0)
@@ -242,9 +262,10 @@ void PieSliceItem::updateGeometry()
                     < (labelRect.top() + m_labelItem->document()->documentMargin() + 1.0))
                 && (parentItem()->boundingRect().bottom()
                     > (labelRect.bottom() - m_labelItem->document()->documentMargin() - 1.0)))
-            m_labelItem->show();
+            m_labelFits = true;
         else
-            m_labelItem->hide();
+            m_labelFits = false;
+        m_labelItem->setVisible(m_labelFits && !m_labelCulled);
     }
 
     //  bounding rect
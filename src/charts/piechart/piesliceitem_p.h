@@ -74,6 +74,8 @@ public:
     void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
 
     void setLayout(const PieSliceData &sliceData);
+    QRectF labelRect() const;
+    void setLabelCulled(bool culled);
     static QPointF sliceCenter(QPointF point, qreal radius, QPieSlice *slice);
 
 Q_SIGNALS:
@@ -96,6 +98,8 @@ private:
     QRectF m_labelTextRect;
     bool m_hovered;
     QGraphicsTextItem *m_labelItem;
+    bool m_labelFits;
+    bool m_labelCulled;
 
     bool m_mousePressed;
 
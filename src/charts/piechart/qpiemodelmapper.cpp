@@ -32,9 +32,39 @@
 #include <QtCharts/QPieSeries>
 #include <QtCharts/QPieSlice>
 #include <QtCore/QAbstractItemModel>
+#include <private/qnumericcolumnaccess_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+/*!
+    \property QPieModelMapper::backgroundLoading
+    \brief Whether large models are read in the background.
+
+    When enabled, the initial read of a model that maps at least 10000 slices, and the reread
+    after the model is reset, are done in a worker thread, so that the application stays
+    responsive. The series keeps its previous slices until all the values have been read. The
+    new slices are then created and appended to the series at once.
+
+    Only the values section is read in the worker thread, and only if the model provides it with
+    QNumericColumnAccess. The labels are read through QAbstractItemModel::data() when the slices
+    are created. Other models are always read at once.
+
+    When the model announces a change while it is being loaded, the mapper waits for the worker
+    thread, passes the slices to the series, and then applies the change. Changes to the series
+    restart the loading.
+
+    By default, background loading is disabled.
+
+    \sa isLoading(), loadingFinished()
+*/
+
+/*!
+    \fn void QPieModelMapper::loadingFinished()
+    This signal is emitted when the slices read in the background have been passed to the
+    series.
+    \sa backgroundLoading
+*/
+
 QPieModelMapper::QPieModelMapper(QObject *parent)
     : QObject(parent),
       d_ptr(new QPieModelMapperPrivate(this))
@@ -67,6 +97,13 @@ void QPieModelMapper::setModel(QAbstractItemModel *model)
     connect(d->m_model, SIGNAL(columnsInserted(QModelIndex,int,int)), d, SLOT(modelColumnsAdded(QModelIndex,int,int)));
     connect(d->m_model, SIGNAL(columnsRemoved(QModelIndex,int,int)), d, SLOT(modelColumnsRemoved(QModelIndex,int,int)));
     connect(d->m_model, SIGNAL(destroyed()), d, SLOT(handleModelDestroyed()));
+    // the values read in the background must not change under the loader
+    connect(d->m_model, SIGNAL(rowsAboutToBeInserted(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(rowsAboutToBeRemoved(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(columnsAboutToBeInserted(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(columnsAboutToBeRemoved(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(modelAboutToBeReset()), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(layoutAboutToBeChanged()), d, SLOT(waitForLoading()));
 }
 
 QPieSeries *QPieModelMapper::series() const
@@ -198,6 +235,28 @@ void QPieModelMapper::setLabelsSection(int labelsSection)
     d->initializePieFromModel();
 }
 
+bool QPieModelMapper::backgroundLoading() const
+{
+    Q_D(const QPieModelMapper);
+    return d->m_backgroundLoading;
+}
+
+void QPieModelMapper::setBackgroundLoading(bool enabled)
+{
+    Q_D(QPieModelMapper);
+    d->m_backgroundLoading = enabled;
+}
+
+/*!
+    Returns true if the values of the model are being read in the background.
+    \sa backgroundLoading
+*/
+bool QPieModelMapper::isLoading() const
+{
+    Q_D(const QPieModelMapper);
+    return d->isLoading();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QPieModelMapperPrivate::QPieModelMapperPrivate(QPieModelMapper *q) :
@@ -211,12 +270,23 @@ QPieModelMapperPrivate::QPieModelMapperPrivate(QPieModelMapper *q) :
     m_labelsSection(-1),
     m_seriesSignalsBlock(false),
     m_modelSignalsBlock(false),
+    m_backgroundLoading(false),
+    m_loader(0),
     q_ptr(q)
 {
 }
 
+QPieModelMapperPrivate::~QPieModelMapperPrivate()
+{
+    stopLoading();
+}
+
 void QPieModelMapperPrivate::blockModelSignals(bool block)
 {
+    // The series is written to the model, the loading in progress is cancelled before the model
+    // changes
+    if (block)
+        stopLoading();
     m_modelSignalsBlock = block;
 }
 
@@ -312,6 +382,9 @@ void QPieModelMapperPrivate::slicesAdded(QList<QPieSlice *> slices)
         connect(slices.at(i - firstIndex), SIGNAL(valueChanged()), this, SLOT(sliceValueChanged()));
     }
 
+    // The series doesn't have the model data yet, reread it after the change
+    const bool loading = isLoading();
+
     blockModelSignals();
     if (m_orientation == Qt::Vertical)
         m_model->insertRows(firstIndex + m_first, slices.count());
@@ -323,6 +396,9 @@ void QPieModelMapperPrivate::slicesAdded(QList<QPieSlice *> slices)
         m_model->setData(labelModelIndex(i), slices.at(i - firstIndex)->label());
     }
     blockModelSignals(false);
+
+    if (loading)
+        initializePieFromModel();
 }
 
 void QPieModelMapperPrivate::slicesRemoved(QList<QPieSlice *> slices)
@@ -343,12 +419,18 @@ void QPieModelMapperPrivate::slicesRemoved(QList<QPieSlice *> slices)
     for (int i = firstIndex + slices.count() - 1; i >= firstIndex; i--)
         m_slices.removeAt(i);
 
+    // The series doesn't have the model data yet, reread it after the change
+    const bool loading = isLoading();
+
     blockModelSignals();
     if (m_orientation == Qt::Vertical)
         m_model->removeRows(firstIndex + m_first, slices.count());
     else
         m_model->removeColumns(firstIndex + m_first, slices.count());
     blockModelSignals(false);
+
+    if (loading)
+        initializePieFromModel();
 }
 
 void QPieModelMapperPrivate::sliceLabelChanged()
@@ -356,10 +438,16 @@ void QPieModelMapperPrivate::sliceLabelChanged()
     if (m_seriesSignalsBlock)
         return;
 
+    // The series doesn't have the model data yet, reread it after the change
+    const bool loading = isLoading();
+
     blockModelSignals();
     QPieSlice *slice = qobject_cast<QPieSlice *>(QObject::sender());
     m_model->setData(labelModelIndex(m_series->slices().indexOf(slice)), slice->label());
     blockModelSignals(false);
+
+    if (loading)
+        initializePieFromModel();
 }
 
 void QPieModelMapperPrivate::sliceValueChanged()
@@ -367,14 +455,21 @@ void QPieModelMapperPrivate::sliceValueChanged()
     if (m_seriesSignalsBlock)
         return;
 
+    // The series doesn't have the model data yet, reread it after the change
+    const bool loading = isLoading();
+
     blockModelSignals();
     QPieSlice *slice = qobject_cast<QPieSlice *>(QObject::sender());
     m_model->setData(valueModelIndex(m_series->slices().indexOf(slice)), slice->value());
     blockModelSignals(false);
+
+    if (loading)
+        initializePieFromModel();
 }
 
 void QPieModelMapperPrivate::handleSeriesDestroyed()
 {
+    stopLoading();
     m_series = 0;
 }
 
@@ -386,6 +481,8 @@ void QPieModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex botto
     if (m_modelSignalsBlock)
         return;
 
+    waitForLoading();
+
     blockSeriesSignals();
     QModelIndex index;
     QPieSlice *slice;
@@ -463,9 +560,21 @@ void QPieModelMapperPrivate::modelColumnsRemoved(QModelIndex parent, int start,
 
 void QPieModelMapperPrivate::handleModelDestroyed()
 {
+    stopLoading();
     m_model = 0;
 }
 
+// The model is about to change the values the loader reads: the slices are passed to the series
+// before the change is applied
+void QPieModelMapperPrivate::waitForLoading()
+{
+    if (!m_loader)
+        return;
+
+    m_loader->wait();
+    handleLoadingFinished();
+}
+
 void QPieModelMapperPrivate::insertData(int start, int end)
 {
     if (m_model == 0 || m_series == 0)
@@ -545,9 +654,14 @@ void QPieModelMapperPrivate::removeData(int start, int end)
 
 void QPieModelMapperPrivate::initializePieFromModel()
 {
+    stopLoading();
+
     if (m_model == 0 || m_series == 0)
         return;
 
+    if (m_backgroundLoading && startLoading())
+        return;
+
     blockSeriesSignals();
     // clear current content
     m_series->clear();
@@ -558,11 +672,8 @@ void QPieModelMapperPrivate::initializePieFromModel()
     QModelIndex valueIndex = valueModelIndex(slicePos);
     QModelIndex labelIndex = labelModelIndex(slicePos);
     while (valueIndex.isValid() && labelIndex.isValid()) {
-        QPieSlice *slice = new QPieSlice;
-        slice->setLabel(m_model->data(labelIndex, Qt::DisplayRole).toString());
-        slice->setValue(m_model->data(valueIndex, Qt::DisplayRole).toDouble());
-        connect(slice, SIGNAL(labelChanged()), this, SLOT(sliceLabelChanged()));
-        connect(slice, SIGNAL(valueChanged()), this, SLOT(sliceValueChanged()));
+        QPieSlice *slice = createSlice(m_model->data(labelIndex, Qt::DisplayRole).toString(),
+                                       m_model->data(valueIndex, Qt::DisplayRole).toDouble());
         m_series->append(slice);
         m_slices.append(slice);
         slicePos++;
@@ -572,6 +683,77 @@ void QPieModelMapperPrivate::initializePieFromModel()
     blockSeriesSignals(false);
 }
 
+QPieSlice *QPieModelMapperPrivate::createSlice(const QString &label, qreal value)
+{
+    QPieSlice *slice = new QPieSlice;
+    slice->setLabel(label);
+    slice->setValue(value);
+    connect(slice, SIGNAL(labelChanged()), this, SLOT(sliceLabelChanged()));
+    connect(slice, SIGNAL(valueChanged()), this, SLOT(sliceValueChanged()));
+    return slice;
+}
+
+// Starts reading the slice values in a worker thread. Returns false if the model is read at
+// once, because it is small or does not provide numeric access to the values section.
+bool QPieModelMapperPrivate::startLoading()
+{
+    if (!valueModelIndex(0).isValid() || !labelModelIndex(0).isValid())
+        return false;
+
+    NumericSection values(m_model, m_orientation, m_valuesSection);
+    const int sectionCount = m_orientation == Qt::Vertical ? m_model->rowCount() : m_model->columnCount();
+    int count = qMin(values.count(), sectionCount) - m_first;
+    if (m_count != -1)
+        count = qMin(count, m_count);
+    if (!values.isValid() || count < backgroundLoadingThreshold)
+        return false;
+
+    m_loader = new ModelLoader(this);
+    m_loader->addSection(values, m_first, count);
+    connect(m_loader, SIGNAL(finished()), this, SLOT(handleLoadingFinished()));
+    m_loader->start();
+    return true;
+}
+
+// Cancels the loading in progress. Returns true if the model was being loaded.
+bool QPieModelMapperPrivate::stopLoading()
+{
+    if (!m_loader)
+        return false;
+
+    delete m_loader;
+    m_loader = 0;
+    return true;
+}
+
+void QPieModelMapperPrivate::handleLoadingFinished()
+{
+    // The finished() signal of a loader already handled by waitForLoading() is ignored
+    if (!m_loader || !m_loader->isFinished())
+        return;
+
+    // The labels are not numeric, they are read here
+    const QVector<qreal> values = m_loader->values(0);
+    stopLoading();
+
+    QList<QPieSlice *> slices;
+    slices.reserve(values.count());
+    for (int slicePos = 0; slicePos < values.count(); slicePos++) {
+        QModelIndex labelIndex = labelModelIndex(slicePos);
+        slices.append(createSlice(m_model->data(labelIndex, Qt::DisplayRole).toString(),
+                                  values.at(slicePos)));
+    }
+
+    blockSeriesSignals();
+    m_series->clear();
+    m_series->append(slices);
+    m_slices = slices;
+    blockSeriesSignals(false);
+
+    Q_Q(QPieModelMapper);
+    emit q->loadingFinished();
+}
+
 #include "moc_qpiemodelmapper_p.cpp"
 #include "moc_qpiemodelmapper.cpp"
 
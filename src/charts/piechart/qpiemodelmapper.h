@@ -45,6 +45,15 @@ class QPieSeries;
 class QT_CHARTS_EXPORT QPieModelMapper : public QObject
 {
     Q_OBJECT
+    Q_PROPERTY(bool backgroundLoading READ backgroundLoading WRITE setBackgroundLoading)
+
+public:
+    bool backgroundLoading() const;
+    void setBackgroundLoading(bool enabled);
+    bool isLoading() const;
+
+Q_SIGNALS:
+    void loadingFinished();
 
 protected:
     explicit QPieModelMapper(QObject *parent = Q_NULLPTR);
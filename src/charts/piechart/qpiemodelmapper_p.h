@@ -41,6 +41,7 @@
 
 #include <QtCore/QObject>
 #include <QtCharts/QPieModelMapper>
+#include <private/modelloader_p.h>
 
 QT_BEGIN_NAMESPACE
 class QModelIndex;
@@ -56,6 +57,9 @@ class QPieModelMapperPrivate : public QObject
 
 public:
     explicit QPieModelMapperPrivate(QPieModelMapper *q);
+    ~QPieModelMapperPrivate();
+
+    bool isLoading() const { return m_loader != 0; }
 
 public Q_SLOTS:
     // for the model
@@ -65,6 +69,7 @@ public Q_SLOTS:
     void modelColumnsAdded(QModelIndex parent, int start, int end);
     void modelColumnsRemoved(QModelIndex parent, int start, int end);
     void handleModelDestroyed();
+    void waitForLoading();
 
     // for the series
     void slicesAdded(QList<QPieSlice *> slices);
@@ -74,6 +79,7 @@ public Q_SLOTS:
     void handleSeriesDestroyed();
 
     void initializePieFromModel();
+    void handleLoadingFinished();
 
 private:
     QPieSlice *pieSlice(QModelIndex index) const;
@@ -86,6 +92,9 @@ private:
 
     void blockModelSignals(bool block = true);
     void blockSeriesSignals(bool block = true);
+    QPieSlice *createSlice(const QString &label, qreal value);
+    bool startLoading();
+    bool stopLoading();
 
 private:
     QPieSeries *m_series;
@@ -98,6 +107,8 @@ private:
     int m_labelsSection;
     bool m_seriesSignalsBlock;
     bool m_modelSignalsBlock;
+    bool m_backgroundLoading;
+    ModelLoader *m_loader;
 
 private:
 
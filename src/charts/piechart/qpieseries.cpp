@@ -306,6 +306,23 @@ QT_CHARTS_BEGIN_NAMESPACE
     \sa sum
 */
 
+/*!
+    \property QPieSeries::aggregationThreshold
+    \brief The percentage below which slices are merged into the aggregated slice.
+
+    When at least two slices have a smaller percentage than the threshold, they are drawn and
+    shown in the legend as one slice, aggregatedSlice(), which is placed at the end of the pie.
+    The aggregated slices keep their value and percentage, but their angle span is 0.
+
+    The value is between 0.0 and 1.0. The default value 0.0 disables the aggregation.
+*/
+
+/*!
+    \fn void QPieSeries::aggregationThresholdChanged()
+    This signal is emitted when the aggregation threshold changes.
+    \sa aggregationThreshold
+*/
+
 /*!
     \fn void QPieSeries::added(QList<QPieSlice*> slices)
 
@@ -450,6 +467,14 @@ QPieSeries::QPieSeries(QObject *parent)
 {
     Q_D(QPieSeries);
     QObject::connect(this, SIGNAL(countChanged()), d, SIGNAL(countChanged()));
+
+    d->m_aggregatedSlice = new QPieSlice(QStringLiteral("Others"), 0, this);
+    QPieSlicePrivate::fromSlice(d->m_aggregatedSlice)->m_series = this;
+    QObject::connect(d->m_aggregatedSlice, SIGNAL(clicked()), d, SLOT(sliceClicked()));
+    QObject::connect(d->m_aggregatedSlice, SIGNAL(hovered(bool)), d, SLOT(sliceHovered(bool)));
+    QObject::connect(d->m_aggregatedSlice, SIGNAL(pressed()), d, SLOT(slicePressed()));
+    QObject::connect(d->m_aggregatedSlice, SIGNAL(released()), d, SLOT(sliceReleased()));
+    QObject::connect(d->m_aggregatedSlice, SIGNAL(doubleClicked()), d, SLOT(sliceDoubleClicked()));
 }
 
 /*!
@@ -640,6 +665,7 @@ bool QPieSeries::take(QPieSlice *slice)
         return false;
 
     QPieSlicePrivate::fromSlice(slice)->m_series = 0;
+    QPieSlicePrivate::fromSlice(slice)->m_aggregated = false;
     slice->disconnect(d);
 
     d->updateDerivativeData();
@@ -858,6 +884,37 @@ void QPieSeries::setLabelsPosition(QPieSlice::LabelPosition position)
         s->setLabelPosition(position);
 }
 
+void QPieSeries::setAggregationThreshold(qreal threshold)
+{
+    Q_D(QPieSeries);
+    threshold = qBound((qreal)0.0, threshold, (qreal)1.0);
+    if (qFuzzyCompare(d->m_aggregationThreshold, threshold))
+        return;
+    d->m_aggregationThreshold = threshold;
+    d->updateSliceData();
+    emit aggregationThresholdChanged();
+}
+
+qreal QPieSeries::aggregationThreshold() const
+{
+    Q_D(const QPieSeries);
+    return d->m_aggregationThreshold;
+}
+
+/*!
+    Returns the slice that stands for the slices below the aggregation threshold. The slice is
+    owned by the series and is not included in slices(). Its value is the sum of the aggregated
+    slices, and it can be styled like any other slice. The mouse signals of the series, such as
+    clicked(), are emitted with this slice when the aggregated slice is clicked.
+
+    \sa aggregationThreshold
+*/
+QPieSlice *QPieSeries::aggregatedSlice() const
+{
+    Q_D(const QPieSeries);
+    return d->m_aggregatedSlice;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
@@ -869,7 +926,13 @@ QPieSeriesPrivate::QPieSeriesPrivate(QPieSeries *parent) :
     m_pieStartAngle(0),
     m_pieEndAngle(360),
     m_sum(0),
-    m_holeRelativeSize(0.0)
+    m_runningSum(0),
+    m_sumCompensation(0),
+    m_sumChangeCount(0),
+    m_holeRelativeSize(0.0),
+    m_aggregationThreshold(0.0),
+    m_aggregatedSlice(0),
+    m_aggregatedCount(0)
 {
 }
 
@@ -879,34 +942,126 @@ QPieSeriesPrivate::~QPieSeriesPrivate()
 
 void QPieSeriesPrivate::updateDerivativeData()
 {
-    // calculate sum of all slices
-    qreal sum = 0;
-    foreach (QPieSlice *s, m_slices)
-        sum += s->value();
+    resetSum();
+    setSum(m_runningSum + m_sumCompensation);
+    updateSliceData();
+}
 
-    if (!qFuzzyCompare(m_sum, sum)) {
-        m_sum = sum;
-        emit q_func()->sumChanged();
+// Sums up the values of all slices again
+void QPieSeriesPrivate::resetSum()
+{
+    m_runningSum = 0;
+    m_sumCompensation = 0;
+    m_sumChangeCount = 0;
+    foreach (QPieSlice *s, m_slices) {
+        QPieSlicePrivate::fromSlice(s)->m_summedValue = s->value();
+        addToSum(s->value());
     }
+}
+
+// Adds the value to the running sum of the slice values. The rounding error of every addition is
+// kept in a separate compensation (the Neumaier variant of Kahan summation), so that the sum does
+// not drift when slices of very different sizes change many times.
+void QPieSeriesPrivate::addToSum(qreal value)
+{
+    const qreal sum = m_runningSum + value;
+    if (qAbs(m_runningSum) >= qAbs(value))
+        m_sumCompensation += (m_runningSum - sum) + value;
+    else
+        m_sumCompensation += (value - sum) + m_runningSum;
+    m_runningSum = sum;
+}
+
+bool QPieSeriesPrivate::setSum(qreal sum)
+{
+    const bool changed = !qFuzzyCompare(m_sum, sum);
+    m_sum = sum;
+    if (changed)
+        emit q_func()->sumChanged();
+    return changed;
+}
+
+// Updates the percentages and angles of all slices. They all depend on the sum, so a change of
+// any value changes all of them.
+void QPieSeriesPrivate::updateSliceData()
+{
+    // a slice moving into or out of the aggregated slice changes the legend
+    if (updateAggregation())
+        emit countChanged(); // the legend shows the aggregated slice instead of its slices
 
     // nothing to show..
     if (qFuzzyCompare(m_sum, 0))
         return;
 
-    // update slice attributes
     qreal sliceAngle = m_pieStartAngle;
+
+    // update slice attributes
     qreal pieSpan = m_pieEndAngle - m_pieStartAngle;
-    QVector<QPieSlice *> changed;
+    QList<QPieSlice *> changed;
     foreach (QPieSlice *s, m_slices) {
         QPieSlicePrivate *d = QPieSlicePrivate::fromSlice(s);
-        d->setPercentage(s->value() / m_sum);
-        d->setStartAngle(sliceAngle);
-        d->setAngleSpan(pieSpan * s->percentage());
+        bool sliceChanged = d->setPercentage(s->value() / m_sum);
+        sliceChanged |= d->setStartAngle(sliceAngle);
+        sliceChanged |= d->setAngleSpan(d->m_aggregated ? 0.0 : pieSpan * s->percentage());
         sliceAngle += s->angleSpan();
+
+        if (sliceChanged)
+            changed << s;
+    }
+
+    // the aggregated slice takes the end of the pie
+    QPieSlicePrivate *d = QPieSlicePrivate::fromSlice(m_aggregatedSlice);
+    bool sliceChanged = d->setPercentage(m_aggregatedSlice->value() / m_sum);
+    sliceChanged |= d->setAngleSpan(pieSpan * m_aggregatedSlice->percentage());
+    sliceChanged |= d->setStartAngle(m_pieEndAngle - m_aggregatedSlice->angleSpan());
+    if (sliceChanged)
+        changed << m_aggregatedSlice;
+
+    if (!changed.isEmpty())
+        emit calculatedDataChanged(changed);
+}
+
+// Marks the slices below the aggregation threshold as aggregated, when there are at least two of
+// them, and sums them up into the aggregated slice. Returns true if the aggregated slices changed.
+bool QPieSeriesPrivate::updateAggregation()
+{
+    const qreal limit = m_aggregationThreshold * m_sum;
+    if (limit <= 0 && m_aggregatedCount == 0)
+        return false;
+
+    int count = 0;
+    foreach (QPieSlice *s, m_slices) {
+        if (s->value() < limit)
+            count++;
+    }
+    if (count < 2)
+        count = 0;
+
+    bool changed = count != m_aggregatedCount;
+    qreal value = 0;
+    foreach (QPieSlice *s, m_slices) {
+        QPieSlicePrivate *d = QPieSlicePrivate::fromSlice(s);
+        const bool aggregated = count > 0 && s->value() < limit;
+        if (d->m_aggregated != aggregated) {
+            d->m_aggregated = aggregated;
+            changed = true;
+        }
+        if (aggregated)
+            value += s->value();
     }
 
+    m_aggregatedCount = count;
+    m_aggregatedSlice->setValue(value);
+    return changed;
+}
 
-    emit calculatedDataChanged();
+// Aggregated slices are drawn as a part of the aggregated slice, which is drawn only when there
+// are aggregated slices
+bool QPieSeriesPrivate::isSliceDrawn(QPieSlice *slice) const
+{
+    if (slice == m_aggregatedSlice)
+        return m_aggregatedCount > 0;
+    return !QPieSlicePrivate::fromSlice(slice)->m_aggregated;
 }
 
 void QPieSeriesPrivate::setSizes(qreal innerSize, qreal outerSize)
@@ -934,14 +1089,27 @@ QPieSeriesPrivate *QPieSeriesPrivate::fromSeries(QPieSeries *series)
 
 void QPieSeriesPrivate::sliceValueChanged()
 {
-    Q_ASSERT(m_slices.contains(qobject_cast<QPieSlice *>(sender())));
-    updateDerivativeData();
+    QPieSlice *slice = qobject_cast<QPieSlice *>(sender());
+    Q_ASSERT(m_slices.contains(slice));
+
+    // the sum is adjusted by the value change, and summed up again after as many changes as
+    // there are slices, which bounds the rounding error at a constant cost per change
+    QPieSlicePrivate *d = QPieSlicePrivate::fromSlice(slice);
+    if (++m_sumChangeCount >= m_slices.count()) {
+        resetSum();
+    } else {
+        addToSum(-d->m_summedValue);
+        addToSum(slice->value());
+        d->m_summedValue = slice->value();
+    }
+    setSum(m_runningSum + m_sumCompensation);
+    updateSliceData();
 }
 
 void QPieSeriesPrivate::sliceClicked()
 {
     QPieSlice *slice = qobject_cast<QPieSlice *>(sender());
-    Q_ASSERT(m_slices.contains(slice));
+    Q_ASSERT(m_slices.contains(slice) || slice == m_aggregatedSlice);
     Q_Q(QPieSeries);
     emit q->clicked(slice);
 }
@@ -950,7 +1118,7 @@ void QPieSeriesPrivate::sliceHovered(bool state)
 {
     QPieSlice *slice = qobject_cast<QPieSlice *>(sender());
     if (!m_slices.isEmpty()) {
-        Q_ASSERT(m_slices.contains(slice));
+        Q_ASSERT(m_slices.contains(slice) || slice == m_aggregatedSlice);
         Q_Q(QPieSeries);
         emit q->hovered(slice, state);
     }
@@ -959,7 +1127,7 @@ void QPieSeriesPrivate::sliceHovered(bool state)
 void QPieSeriesPrivate::slicePressed()
 {
     QPieSlice *slice = qobject_cast<QPieSlice *>(sender());
-    Q_ASSERT(m_slices.contains(slice));
+    Q_ASSERT(m_slices.contains(slice) || slice == m_aggregatedSlice);
     Q_Q(QPieSeries);
     emit q->pressed(slice);
 }
@@ -967,7 +1135,7 @@ void QPieSeriesPrivate::slicePressed()
 void QPieSeriesPrivate::sliceReleased()
 {
     QPieSlice *slice = qobject_cast<QPieSlice *>(sender());
-    Q_ASSERT(m_slices.contains(slice));
+    Q_ASSERT(m_slices.contains(slice) || slice == m_aggregatedSlice);
     Q_Q(QPieSeries);
     emit q->released(slice);
 }
@@ -975,7 +1143,7 @@ void QPieSeriesPrivate::sliceReleased()
 void QPieSeriesPrivate::sliceDoubleClicked()
 {
     QPieSlice *slice = qobject_cast<QPieSlice *>(sender());
-    Q_ASSERT(m_slices.contains(slice));
+    Q_ASSERT(m_slices.contains(slice) || slice == m_aggregatedSlice);
     Q_Q(QPieSeries);
     emit q->doubleClicked(slice);
 }
@@ -1010,15 +1178,31 @@ void QPieSeriesPrivate::initializeAnimations(QtCharts::QChart::AnimationOptions
 
 QList<QLegendMarker*> QPieSeriesPrivate::createLegendMarkers(QLegend* legend)
 {
-    Q_Q(QPieSeries);
     QList<QLegendMarker*> markers;
-    foreach(QPieSlice* slice, q->slices()) {
-        QPieLegendMarker* marker = new QPieLegendMarker(q,slice,legend);
-        markers << marker;
-    }
+    foreach (QObject *slice, legendMarkerObjects())
+        markers << createLegendMarker(slice, legend);
     return markers;
 }
 
+QList<QObject *> QPieSeriesPrivate::legendMarkerObjects()
+{
+    QList<QObject *> objects;
+    objects.reserve(m_slices.count() + 1);
+    foreach (QPieSlice *slice, m_slices) {
+        if (isSliceDrawn(slice))
+            objects << slice;
+    }
+    if (isSliceDrawn(m_aggregatedSlice))
+        objects << m_aggregatedSlice;
+    return objects;
+}
+
+QLegendMarker *QPieSeriesPrivate::createLegendMarker(QObject *object, QLegend *legend)
+{
+    Q_Q(QPieSeries);
+    return new QPieLegendMarker(q, static_cast<QPieSlice *>(object), legend);
+}
+
 void QPieSeriesPrivate::initializeAxes()
 {
 
@@ -1065,6 +1249,19 @@ void QPieSeriesPrivate::initializeTheme(int index, ChartTheme* theme, bool force
         if (forced || d->m_data.m_labelFont.isThemed())
             d->setLabelFont(theme->labelFont(), true);
     }
+
+    // the aggregated slice gets the color from the start of the gradient, which no slice uses
+    QPieSlicePrivate *d = QPieSlicePrivate::fromSlice(m_aggregatedSlice);
+    const QGradient &gradient = gradients.at(index % gradients.size());
+    qreal pos = 0.5 / qMax(m_slices.count(), 1);
+    if (forced || d->m_data.m_slicePen.isThemed())
+        d->setPen(ChartThemeManager::colorAt(gradient, 0.0), true);
+    if (forced || d->m_data.m_sliceBrush.isThemed())
+        d->setBrush(ChartThemeManager::colorAt(gradient, pos), true);
+    if (forced || d->m_data.m_labelBrush.isThemed())
+        d->setLabelBrush(theme->labelBrush().color(), true);
+    if (forced || d->m_data.m_labelFont.isThemed())
+        d->setLabelFont(theme->labelFont(), true);
 }
 
 
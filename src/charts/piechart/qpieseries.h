@@ -47,6 +47,7 @@ class QT_CHARTS_EXPORT QPieSeries : public QAbstractSeries
     Q_PROPERTY(int count READ count NOTIFY countChanged)
     Q_PROPERTY(qreal sum READ sum NOTIFY sumChanged)
     Q_PROPERTY(qreal holeSize READ holeSize WRITE setHoleSize)
+    Q_PROPERTY(qreal aggregationThreshold READ aggregationThreshold WRITE setAggregationThreshold NOTIFY aggregationThresholdChanged)
 
 public:
     explicit QPieSeries(QObject *parent = Q_NULLPTR);
@@ -93,6 +94,10 @@ public:
     void setLabelsVisible(bool visible = true);
     void setLabelsPosition(QPieSlice::LabelPosition position);
 
+    void setAggregationThreshold(qreal threshold);
+    qreal aggregationThreshold() const;
+    QPieSlice *aggregatedSlice() const;
+
 Q_SIGNALS:
     void added(QList<QPieSlice *> slices);
     void removed(QList<QPieSlice *> slices);
@@ -103,6 +108,7 @@ Q_SIGNALS:
     void doubleClicked(QPieSlice *slice);
     void countChanged();
     void sumChanged();
+    void aggregationThresholdChanged();
 
 private:
     Q_DECLARE_PRIVATE(QPieSeries)
@@ -61,17 +61,25 @@ public:
     void initializeTheme(int index, ChartTheme* theme, bool forced = false);
 
     QList<QLegendMarker *> createLegendMarkers(QLegend *legend);
+    QList<QObject *> legendMarkerObjects();
+    QLegendMarker *createLegendMarker(QObject *object, QLegend *legend);
 
     QAbstractAxis::AxisType defaultAxisType(Qt::Orientation orientation) const;
     QAbstractAxis* createDefaultAxis(Qt::Orientation orientation) const;
 
     void updateDerivativeData();
+    void resetSum();
+    void addToSum(qreal value);
+    bool setSum(qreal sum);
+    void updateSliceData();
+    bool updateAggregation();
+    bool isSliceDrawn(QPieSlice *slice) const;
     void setSizes(qreal innerSize, qreal outerSize);
 
     static QPieSeriesPrivate *fromSeries(QPieSeries *series);
 
 Q_SIGNALS:
-    void calculatedDataChanged();
+    void calculatedDataChanged(const QList<QPieSlice *> &slices);
     void pieSizeChanged();
     void pieStartAngleChanged();
     void pieEndAngleChanged();
@@ -94,7 +102,13 @@ private:
     qreal m_pieStartAngle;
     qreal m_pieEndAngle;
     qreal m_sum;
+    qreal m_runningSum;
+    qreal m_sumCompensation;
+    int m_sumChangeCount;
     qreal m_holeRelativeSize;
+    qreal m_aggregationThreshold;
+    QPieSlice *m_aggregatedSlice;
+    int m_aggregatedCount;
 
 public:
     friend class QLegendPrivate;
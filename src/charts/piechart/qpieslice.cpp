@@ -740,7 +740,9 @@ QPieSeries *QPieSlice::series() const
 QPieSlicePrivate::QPieSlicePrivate(QPieSlice *parent)
     : QObject(parent),
       q_ptr(parent),
-      m_series(0)
+      m_series(0),
+      m_aggregated(false),
+      m_summedValue(0)
 {
 
 }
@@ -811,28 +813,34 @@ void QPieSlicePrivate::setLabelFont(const QFont &font, bool themed)
     }
 }
 
-void QPieSlicePrivate::setPercentage(qreal percentage)
+bool QPieSlicePrivate::setPercentage(qreal percentage)
 {
     if (!qFuzzyCompare(m_data.m_percentage, percentage)) {
         m_data.m_percentage = percentage;
         emit q_ptr->percentageChanged();
+        return true;
     }
+    return false;
 }
 
-void QPieSlicePrivate::setStartAngle(qreal angle)
+bool QPieSlicePrivate::setStartAngle(qreal angle)
 {
     if (!qFuzzyCompare(m_data.m_startAngle, angle)) {
         m_data.m_startAngle = angle;
         emit q_ptr->startAngleChanged();
+        return true;
     }
+    return false;
 }
 
-void QPieSlicePrivate::setAngleSpan(qreal span)
+bool QPieSlicePrivate::setAngleSpan(qreal span)
 {
     if (!qFuzzyCompare(m_data.m_angleSpan, span)) {
         m_data.m_angleSpan = span;
         emit q_ptr->angleSpanChanged();
+        return true;
     }
+    return false;
 }
 
 QT_CHARTS_END_NAMESPACE
@@ -61,9 +61,9 @@ public:
     void setLabelBrush(const QBrush &brush, bool themed);
     void setLabelFont(const QFont &font, bool themed);
 
-    void setPercentage(qreal percentage);
-    void setStartAngle(qreal angle);
-    void setAngleSpan(qreal span);
+    bool setPercentage(qreal percentage);
+    bool setStartAngle(qreal angle);
+    bool setAngleSpan(qreal span);
 
 Q_SIGNALS:
     void labelPositionChanged();
@@ -82,6 +82,8 @@ private:
 
     PieSliceData m_data;
     QPieSeries *m_series;
+    bool m_aggregated; // drawn as a part of the aggregated slice of the series
+    qreal m_summedValue; // the value included in the sum of the series
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -468,6 +468,23 @@ void QAbstractSeriesPrivate::initializeAnimations(QChart::AnimationOptions optio
     Q_UNUSED(curve);
 }
 
+// Returns the objects the legend markers of the series are related to. Series whose marker count
+// can change reimplement this and createLegendMarker(), so that the legend can add and remove
+// markers one by one.
+QList<QObject *> QAbstractSeriesPrivate::legendMarkerObjects()
+{
+    return QList<QObject *>() << q_ptr;
+}
+
+QLegendMarker *QAbstractSeriesPrivate::createLegendMarker(QObject *object, QLegend *legend)
+{
+    Q_UNUSED(object);
+    QList<QLegendMarker *> markers = createLegendMarkers(legend);
+    QLegendMarker *marker = markers.takeFirst();
+    qDeleteAll(markers);
+    return marker;
+}
+
 // This function can be used to explicitly block OpenGL use from some otherwise supported series,
 // such as the line series used as edge series of an area series.
 void QAbstractSeriesPrivate::setBlockOpenGL(bool enable)
@@ -107,6 +107,7 @@ protected:
     friend class DeclarativeChart;
     friend class QAreaSeries;
     friend class GLWidget;
+    friend class QValueAxisPrivate;
 };
 
 QT_CHARTS_END_NAMESPACE
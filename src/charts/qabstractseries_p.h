@@ -76,6 +76,8 @@ public:
                                       QEasingCurve &curve) = 0;
 
     virtual QList<QLegendMarker*> createLegendMarkers(QLegend* legend) = 0;
+    virtual QList<QObject *> legendMarkerObjects();
+    virtual QLegendMarker *createLegendMarker(QObject *object, QLegend *legend);
 
     virtual QAbstractAxis::AxisType defaultAxisType(Qt::Orientation) const = 0;
     virtual QAbstractAxis* createDefaultAxis(Qt::Orientation) const = 0;
@@ -219,6 +219,26 @@ QT_CHARTS_BEGIN_NAMESPACE
   \sa localizeNumbers
 */
 
+/*!
+  \property QChart::interactivePreviewEnabled
+  \brief Whether zooming and scrolling are previewed before the chart is updated.
+
+  When \c{true}, zooming and scrolling the chart first scale and move the series graphics that
+  have already been drawn, which gives immediate feedback even for series with a very large number
+  of points. The series geometry, the axes, and the point labels are updated once no further
+  zooming or scrolling has been requested for a short while, so that a continuous gesture, such as
+  turning the mouse wheel, results in a single update.
+
+  Until then, axis ranges, mapToValue(), and mapToPosition() reflect the ranges the chart had
+  before the gesture started. Calling zoomReset() or isZoomed(), resizing the plot area, or adding
+  series applies a pending preview right away.
+
+  Changes are only previewed for cartesian charts without series animations whose series are all
+  line, spline, or area series not drawn with OpenGL. Otherwise, they are applied right away.
+
+  Defaults to \c{false}.
+*/
+
 /*!
   \property QChart::plotArea
   \brief The rectangle within which the chart is drawn.
@@ -279,6 +299,23 @@ void QChart::addSeries(QAbstractSeries *series)
     d_ptr->m_dataset->addSeries(series);
 }
 
+/*!
+ \overload
+ Adds the list of series specified by \a series to the chart, takes ownership of them, and
+ attaches the axes specified by \a axes to each of them. The axes must have been added to the
+ chart using addAxis().
+
+ This is much faster than adding the series and attaching the axes one by one when adding
+ hundreds of series, as the domains of the series, the auto range of the axes, and the graphics
+ of the series are set up once for the final configuration.
+
+ \sa addAxis(), QAbstractSeries::attachAxis()
+ */
+void QChart::addSeries(const QList<QAbstractSeries *> &series, const QList<QAbstractAxis *> &axes)
+{
+    d_ptr->m_dataset->addSeries(series, axes);
+}
+
 /*!
  Removes the series \a series from the chart.
  The chart releases the ownership of the specified \a series object.
@@ -291,6 +328,40 @@ void QChart::removeSeries(QAbstractSeries *series)
     d_ptr->m_dataset->removeSeries(series);
 }
 
+/*!
+ Starts a batch of changes to the chart.
+
+ Until the matching endUpdate() call, series and axes added to the chart are not shown. The chart
+ creates their graphics, applies the theme to them, adds their legend markers, and lays itself out
+ only once when the update ends, instead of after every change. Value axes with automatic range
+ fit their range to the attached series once at the end of the update.
+
+ Changes to what the chart already shows are batched too. Axes attached to a series take effect
+ on its domain once, a theme set with setTheme() is applied once, legend markers follow the
+ slices or sets added to and removed from a series once, and the layout passes requested by the
+ changes are combined into one when the update ends.
+
+ The series and axes are part of the chart during the update, so they can be attached to each
+ other, configured, and removed again. Calls can be nested; the changes take effect when the
+ outermost update ends.
+
+ \sa endUpdate()
+ */
+void QChart::beginUpdate()
+{
+    d_ptr->m_dataset->beginUpdate();
+}
+
+/*!
+ Ends a batch of changes started with beginUpdate() and shows the series and axes added during it.
+
+ \sa beginUpdate()
+ */
+void QChart::endUpdate()
+{
+    d_ptr->m_dataset->endUpdate();
+}
+
 /*!
  Removes and deletes all series objects that have been added to the chart.
 
@@ -693,6 +764,16 @@ void QChart::scroll(qreal dx, qreal dy)
     d_ptr->scroll(dx,dy);
 }
 
+void QChart::setInteractivePreviewEnabled(bool enabled)
+{
+    d_ptr->m_presenter->setPreviewEnabled(enabled);
+}
+
+bool QChart::isInteractivePreviewEnabled() const
+{
+    return d_ptr->m_presenter->isPreviewEnabled();
+}
+
 void QChart::setBackgroundVisible(bool visible)
 {
     d_ptr->m_presenter->setBackgroundVisible(visible);
@@ -835,6 +916,8 @@ QChartPrivate::QChartPrivate(QChart *q, QChart::ChartType type):
     QObject::connect(m_dataset, SIGNAL(seriesRemoved(QAbstractSeries*)), m_themeManager, SLOT(handleSeriesRemoved(QAbstractSeries*)));
     QObject::connect(m_dataset, SIGNAL(axisAdded(QAbstractAxis*)), m_themeManager, SLOT(handleAxisAdded(QAbstractAxis*)));
     QObject::connect(m_dataset, SIGNAL(axisRemoved(QAbstractAxis*)), m_themeManager, SLOT(handleAxisRemoved(QAbstractAxis*)));
+    QObject::connect(m_dataset, SIGNAL(updateFinished()), m_themeManager, SLOT(handleUpdateFinished()));
+    QObject::connect(m_dataset, SIGNAL(updateFinished()), m_presenter, SLOT(handleUpdateFinished()));
     QObject::connect(m_presenter, &ChartPresenter::plotAreaChanged, q, &QChart::plotAreaChanged);
 }
 
@@ -898,6 +981,9 @@ void QChartPrivate::zoomIn(const QRectF &rect)
     if (!r.isValid())
         return;
 
+    if (m_presenter->previewZoom(r))
+        return;
+
     QPointF zoomPoint(r.center().x() / geometry.width(), r.center().y() / geometry.height());
     m_presenter->setState(ChartPresenter::ZoomInState,zoomPoint);
     m_dataset->zoomInDomain(r);
@@ -907,11 +993,13 @@ void QChartPrivate::zoomIn(const QRectF &rect)
 
 void QChartPrivate::zoomReset()
 {
+    m_presenter->commitPreview();
     m_dataset->zoomResetDomain();
 }
 
 bool QChartPrivate::isZoomed()
 {
+    m_presenter->commitPreview();
     return m_dataset->isZoomedDomain();
 }
 
@@ -925,6 +1013,13 @@ void QChartPrivate::zoomOut(qreal factor)
     if (!r.isValid())
         return;
 
+    // Zooming out by factor shows a factor times larger area around the center
+    QRectF previewRect;
+    previewRect.setSize(geometry.size() * factor);
+    previewRect.moveCenter(r.center());
+    if (m_presenter->previewZoom(previewRect))
+        return;
+
     QPointF zoomPoint(r.center().x() / geometry.width(), r.center().y() / geometry.height());
     m_presenter->setState(ChartPresenter::ZoomOutState,zoomPoint);
     m_dataset->zoomOutDomain(r);
@@ -933,6 +1028,11 @@ void QChartPrivate::zoomOut(qreal factor)
 
 void QChartPrivate::scroll(qreal dx, qreal dy)
 {
+    // The domains move up for a positive dy, which is towards smaller plot area coordinates
+    const QRectF geometry = m_presenter->geometry();
+    if (m_presenter->previewZoom(QRectF(QPointF(dx, -dy), geometry.size())))
+        return;
+
     if (dx < 0) m_presenter->setState(ChartPresenter::ScrollLeftState,QPointF());
     if (dx > 0) m_presenter->setState(ChartPresenter::ScrollRightState,QPointF());
     if (dy < 0) m_presenter->setState(ChartPresenter::ScrollUpState,QPointF());
@@ -64,6 +64,7 @@ class QT_CHARTS_EXPORT QChart : public QGraphicsWidget
     Q_PROPERTY(bool localizeNumbers READ localizeNumbers WRITE setLocalizeNumbers)
     Q_PROPERTY(QLocale locale READ locale WRITE setLocale)
     Q_PROPERTY(QRectF plotArea READ plotArea NOTIFY plotAreaChanged)
+    Q_PROPERTY(bool interactivePreviewEnabled READ isInteractivePreviewEnabled WRITE setInteractivePreviewEnabled)
     Q_ENUMS(ChartTheme)
     Q_ENUMS(AnimationOption)
     Q_ENUMS(ChartType)
@@ -100,10 +101,15 @@ public:
     ~QChart();
 
     void addSeries(QAbstractSeries *series);
+    void addSeries(const QList<QAbstractSeries *> &series,
+                   const QList<QAbstractAxis *> &axes = QList<QAbstractAxis *>());
     void removeSeries(QAbstractSeries *series);
     void removeAllSeries();
     QList<QAbstractSeries *> series() const;
 
+    void beginUpdate();
+    void endUpdate();
+
     // *** deprecated ***
     void setAxisX(QAbstractAxis *axis, QAbstractSeries *series = Q_NULLPTR);
     void setAxisY(QAbstractAxis *axis, QAbstractSeries *series = Q_NULLPTR);
@@ -156,6 +162,9 @@ public:
 
     void scroll(qreal dx, qreal dy);
 
+    void setInteractivePreviewEnabled(bool enabled);
+    bool isInteractivePreviewEnabled() const;
+
     QLegend *legend() const;
 
     void setMargins(const QMargins &margins);
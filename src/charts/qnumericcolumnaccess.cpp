@@ -0,0 +1,97 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtCharts/QNumericColumnAccess>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QNumericColumnAccess
+    \inmodule Qt Charts
+    \brief The QNumericColumnAccess class is an interface for models that store numeric data in
+    contiguous memory.
+
+    The model mappers read the data of a model one cell at a time through
+    QAbstractItemModel::data(), converting each QVariant to a number. A model that keeps its
+    numeric data in arrays can implement this interface to let the mappers copy the values
+    directly instead. The model has to declare the interface with the Q_INTERFACES() macro:
+
+    \code
+    class TableModel : public QAbstractTableModel, public QNumericColumnAccess
+    {
+        Q_OBJECT
+        Q_INTERFACES(QtCharts::QNumericColumnAccess)
+        ...
+    };
+    \endcode
+
+    The interface is used by QVXYModelMapper, QHXYModelMapper, QVBarModelMapper,
+    QHBarModelMapper, QVBoxPlotModelMapper, QHBoxPlotModelMapper,
+    QVCandlestickModelMapper, and QHCandlestickModelMapper when they read the whole model,
+    which happens when the model, the series, or the mapped sections are set and when the
+    model is reset. The values of a section must be the same numbers the model returns from
+    data() for the same role.
+
+    When the \c backgroundLoading property of a mapper is enabled, the mapper calls
+    numericSection() in the thread of the model and then copies the values in a worker thread.
+    The model must therefore not free or move the arrays it has returned without emitting one
+    of the signals that announce a change first: rowsAboutToBeInserted(),
+    rowsAboutToBeRemoved(), columnsAboutToBeInserted(), columnsAboutToBeRemoved(),
+    modelAboutToBeReset(), or layoutAboutToBeChanged(). The mapper waits for the worker
+    thread when it receives one of them. A value changed in place is read again by the mapper
+    when the model emits dataChanged(). The model must not be destroyed while a mapper is
+    loading it.
+*/
+
+/*!
+    Destroys the interface.
+*/
+QNumericColumnAccess::~QNumericColumnAccess()
+{
+}
+
+/*!
+    \fn const qreal *QNumericColumnAccess::numericSection(Qt::Orientation orientation, int section, int role, int *count, int *stride) const
+
+    Returns a pointer to the values of the model for \a role in the column \a section if
+    \a orientation is Qt::Vertical, or in the row \a section if \a orientation is
+    Qt::Horizontal. The value of row or column \c i is found at the returned pointer plus
+    \c{i * stride}.
+
+    The number of values is stored in \a count and the distance between two consecutive values,
+    in number of qreal values, in \a stride. Returns 0 if the section does not have
+    numeric data for \a role, in which case the mappers read the section through
+    QAbstractItemModel::data().
+
+    The returned pointer must stay valid until the model is changed. It may be read from
+    another thread, see the class description.
+*/
+
+QT_CHARTS_END_NAMESPACE
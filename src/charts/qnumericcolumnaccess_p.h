@@ -0,0 +1,84 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef QNUMERICCOLUMNACCESS_P_H
+#define QNUMERICCOLUMNACCESS_P_H
+
+#include <QtCharts/QNumericColumnAccess>
+#include <QtCore/QAbstractItemModel>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// The values of a model section, if the model provides them through QNumericColumnAccess
+class NumericSection
+{
+public:
+    NumericSection()
+        : m_data(0),
+          m_count(0),
+          m_stride(0)
+    {
+    }
+
+    NumericSection(const QAbstractItemModel *model, Qt::Orientation orientation, int section,
+                   int role = Qt::DisplayRole)
+        : m_data(0),
+          m_count(0),
+          m_stride(0)
+    {
+        QNumericColumnAccess *access = qobject_cast<QNumericColumnAccess *>(model);
+        if (access && section >= 0)
+            m_data = access->numericSection(orientation, section, role, &m_count, &m_stride);
+        if (!m_data)
+            m_count = 0;
+    }
+
+    bool isValid() const { return m_data != 0; }
+    int count() const { return m_count; }
+    qreal at(int i) const { return m_data[i * m_stride]; }
+
+private:
+    const qreal *m_data;
+    int m_count;
+    int m_stride;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QNUMERICCOLUMNACCESS_P_H
@@ -441,7 +441,7 @@ void SplineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *o
     QRectF clipRect = QRectF(QPointF(0, 0), domain()->size());
 
     painter->save();
-    painter->setPen(m_linePen);
+    painter->setPen(previewPen(m_linePen));
     painter->setBrush(Qt::NoBrush);
 
     if (m_series->chart()->chartType() == QChart::ChartTypePolar) {
@@ -457,20 +457,21 @@ void SplineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *o
         painter->drawPath(m_pathPolarRight);
         painter->setClipRegion(fullPolarClipRegion);
     } else {
-        painter->setClipRect(clipRect);
+        painter->setClipRect(mapFromPlotArea(clipRect));
     }
 
     painter->drawPath(m_path);
 
     if (m_pointsVisible) {
-        painter->setPen(m_pointPen);
+        painter->setPen(previewPen(m_pointPen));
         if (m_series->chart()->chartType() == QChart::ChartTypePolar)
             painter->drawPoints(m_visiblePoints);
         else
             painter->drawPoints(geometryPoints());
     }
 
-    if (m_pointLabelsVisible) {
+    // Point labels are left out of interactive previews until the geometry is recalculated
+    if (m_pointLabelsVisible && !isPreviewTransformed()) {
         if (m_pointLabelsClipping)
             painter->setClipping(true);
         else
@@ -53,6 +53,9 @@ class SplineChartItem : public XYChart
 public:
     SplineChartItem(QSplineSeries *series, QGraphicsItem *item = 0);
 
+    //from ChartItem
+    bool supportsPreviewTransform() const { return true; }
+
     //from QGraphicsItem
     QRectF boundingRect() const;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
@@ -30,12 +30,57 @@
 #include <QtCharts/QXYModelMapper>
 #include <private/qxymodelmapper_p.h>
 #include <QtCharts/QXYSeries>
+#include <private/qxyseries_p.h>
+#include <private/qnumericcolumnaccess_p.h>
 #include <QtCore/QAbstractItemModel>
 #include <QtCore/QDateTime>
 #include <QtCore/QDebug>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Returns the points [first, first + count) of numeric sections. The loader, if given, is
+// checked for cancellation.
+static QVector<QPointF> numericPoints(const NumericSection &xValues, const NumericSection &yValues,
+                                      int first, int count, const ModelLoader *loader = 0)
+{
+    QVector<QPointF> points;
+    points.reserve(count);
+    for (int i = first; i < first + count; i++) {
+        if (loader && (i - first) % 65536 == 0 && loader->isCancelled())
+            return QVector<QPointF>();
+        points << QPointF(xValues.at(i), yValues.at(i));
+    }
+    return points;
+}
+
+/*!
+    \property QXYModelMapper::backgroundLoading
+    \brief Whether large models are read in the background.
+
+    When enabled, the initial read of a model that maps at least 10000 points, and the reread
+    after the model is reset, are done in a worker thread, so that the application stays
+    responsive. The series keeps its previous data until all the points have been read, and then
+    receives them with a single QXYSeries::replace() call.
+
+    Only models that provide the mapped sections with QNumericColumnAccess can be read in the
+    background, other models are always read at once through QAbstractItemModel::data().
+
+    When the model announces a change while it is being loaded, the mapper waits for the worker
+    thread, passes the points to the series, and then applies the change. Changes to the series
+    restart the loading.
+
+    By default, background loading is disabled.
+
+    \sa isLoading(), loadingFinished()
+*/
+
+/*!
+    \fn void QXYModelMapper::loadingFinished()
+    This signal is emitted when the points read in the background have been passed to the
+    series.
+    \sa backgroundLoading
+*/
+
 /*!
     Constructs a mapper object which is a child of \a parent.
 */
@@ -76,6 +121,13 @@ void QXYModelMapper::setModel(QAbstractItemModel *model)
     connect(d->m_model, SIGNAL(columnsRemoved(QModelIndex,int,int)), d, SLOT(modelColumnsRemoved(QModelIndex,int,int)));
     connect(d->m_model, SIGNAL(modelReset()), d, SLOT(initializeXYFromModel()));
     connect(d->m_model, SIGNAL(destroyed()), d, SLOT(handleModelDestroyed()));
+    // the values read in the background must not change under the loader
+    connect(d->m_model, SIGNAL(rowsAboutToBeInserted(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(rowsAboutToBeRemoved(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(columnsAboutToBeInserted(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(columnsAboutToBeRemoved(QModelIndex,int,int)), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(modelAboutToBeReset()), d, SLOT(waitForLoading()));
+    connect(d->m_model, SIGNAL(layoutAboutToBeChanged()), d, SLOT(waitForLoading()));
 }
 
 /*!
@@ -210,6 +262,28 @@ void QXYModelMapper::setYSection(int ySection)
     d->initializeXYFromModel();
 }
 
+bool QXYModelMapper::backgroundLoading() const
+{
+    Q_D(const QXYModelMapper);
+    return d->m_backgroundLoading;
+}
+
+void QXYModelMapper::setBackgroundLoading(bool enabled)
+{
+    Q_D(QXYModelMapper);
+    d->m_backgroundLoading = enabled;
+}
+
+/*!
+    Returns true if the points of the model are being read in the background.
+    \sa backgroundLoading
+*/
+bool QXYModelMapper::isLoading() const
+{
+    Q_D(const QXYModelMapper);
+    return d->isLoading();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QXYModelMapperPrivate::QXYModelMapperPrivate(QXYModelMapper *q) :
@@ -223,10 +297,17 @@ QXYModelMapperPrivate::QXYModelMapperPrivate(QXYModelMapper *q) :
     m_ySection(-1),
     m_seriesSignalsBlock(false),
     m_modelSignalsBlock(false),
+    m_backgroundLoading(false),
+    m_loader(0),
     q_ptr(q)
 {
 }
 
+QXYModelMapperPrivate::~QXYModelMapperPrivate()
+{
+    stopLoading();
+}
+
 void QXYModelMapperPrivate::blockModelSignals(bool block)
 {
     m_modelSignalsBlock = block;
@@ -292,6 +373,9 @@ void QXYModelMapperPrivate::handlePointAdded(int pointPos)
     if (m_seriesSignalsBlock)
         return;
 
+    // The series doesn't have the model data yet, reread it after the change
+    const bool loading = stopLoading();
+
     if (m_count != -1)
         m_count += 1;
 
@@ -304,6 +388,9 @@ void QXYModelMapperPrivate::handlePointAdded(int pointPos)
     setValueToModel(xModelIndex(pointPos), m_series->points().at(pointPos).x());
     setValueToModel(yModelIndex(pointPos), m_series->points().at(pointPos).y());
     blockModelSignals(false);
+
+    if (loading)
+        initializeXYFromModel();
 }
 
 void QXYModelMapperPrivate::handlePointRemoved(int pointPos)
@@ -311,6 +398,9 @@ void QXYModelMapperPrivate::handlePointRemoved(int pointPos)
     if (m_seriesSignalsBlock)
         return;
 
+    // The series doesn't have the model data yet, reread it after the change
+    const bool loading = stopLoading();
+
     if (m_count != -1)
         m_count -= 1;
 
@@ -320,6 +410,9 @@ void QXYModelMapperPrivate::handlePointRemoved(int pointPos)
     else
         m_model->removeColumn(pointPos + m_first);
     blockModelSignals(false);
+
+    if (loading)
+        initializeXYFromModel();
 }
 
 void QXYModelMapperPrivate::handlePointsRemoved(int pointPos, int count)
@@ -327,6 +420,9 @@ void QXYModelMapperPrivate::handlePointsRemoved(int pointPos, int count)
     if (m_seriesSignalsBlock)
         return;
 
+    // The series doesn't have the model data yet, reread it after the change
+    const bool loading = stopLoading();
+
     m_count -= count;
 
     if (m_count < -1)
@@ -338,6 +434,9 @@ void QXYModelMapperPrivate::handlePointsRemoved(int pointPos, int count)
     else
         m_model->removeColumns(pointPos + m_first, count);
     blockModelSignals(false);
+
+    if (loading)
+        initializeXYFromModel();
 }
 
 void QXYModelMapperPrivate::handlePointReplaced(int pointPos)
@@ -345,14 +444,21 @@ void QXYModelMapperPrivate::handlePointReplaced(int pointPos)
     if (m_seriesSignalsBlock)
         return;
 
+    // The series doesn't have the model data yet, reread it after the change
+    const bool loading = stopLoading();
+
     blockModelSignals();
     setValueToModel(xModelIndex(pointPos), m_series->points().at(pointPos).x());
     setValueToModel(yModelIndex(pointPos), m_series->points().at(pointPos).y());
     blockModelSignals(false);
+
+    if (loading)
+        initializeXYFromModel();
 }
 
 void QXYModelMapperPrivate::handleSeriesDestroyed()
 {
+    stopLoading();
     m_series = 0;
 }
 
@@ -364,39 +470,51 @@ void QXYModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex bottom
     if (m_modelSignalsBlock)
         return;
 
-    blockSeriesSignals();
-    QModelIndex index;
-    QPointF oldPoint;
-    QPointF newPoint;
-    for (int row = topLeft.row(); row <= bottomRight.row(); row++) {
-        for (int column = topLeft.column(); column <= bottomRight.column(); column++) {
-            index = topLeft.sibling(row, column);
-            if (m_orientation == Qt::Vertical && (index.column() == m_xSection || index.column() == m_ySection)) {
-                if (index.row() >= m_first && (m_count == - 1 || index.row() < m_first + m_count)) {
-                    QModelIndex xIndex = xModelIndex(index.row() - m_first);
-                    QModelIndex yIndex = yModelIndex(index.row() - m_first);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        oldPoint = m_series->points().at(index.row() - m_first);
-                        newPoint.setX(valueFromModel(xIndex));
-                        newPoint.setY(valueFromModel(yIndex));
-                    }
-                }
-            } else if (m_orientation == Qt::Horizontal && (index.row() == m_xSection || index.row() == m_ySection)) {
-                if (index.column() >= m_first && (m_count == - 1 || index.column() < m_first + m_count)) {
-                    QModelIndex xIndex = xModelIndex(index.column() - m_first);
-                    QModelIndex yIndex = yModelIndex(index.column() - m_first);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        oldPoint = m_series->points().at(index.column() - m_first);
-                        newPoint.setX(valueFromModel(xIndex));
-                        newPoint.setY(valueFromModel(yIndex));
-                    }
-                }
-            } else {
-                continue;
-            }
-            m_series->replace(oldPoint, newPoint);
+    waitForLoading();
+
+    // Find the range of points touched by the change, so that it can be pushed to the series
+    // with a single notification
+    const int pointCount = m_series->count();
+    int first;
+    int last;
+    if (m_orientation == Qt::Vertical) {
+        if ((m_xSection < topLeft.column() || m_xSection > bottomRight.column())
+            && (m_ySection < topLeft.column() || m_ySection > bottomRight.column())) {
+            return;
         }
+        first = topLeft.row() - m_first;
+        last = bottomRight.row() - m_first;
+    } else {
+        if ((m_xSection < topLeft.row() || m_xSection > bottomRight.row())
+            && (m_ySection < topLeft.row() || m_ySection > bottomRight.row())) {
+            return;
+        }
+        first = topLeft.column() - m_first;
+        last = bottomRight.column() - m_first;
+    }
+    first = qMax(first, 0);
+    last = qMin(last, pointCount - 1);
+    if (m_count != -1)
+        last = qMin(last, m_count - 1);
+    if (first > last)
+        return;
+
+    QVector<QPointF> points;
+    points.reserve(last - first + 1);
+    for (int pointPos = first; pointPos <= last; pointPos++) {
+        QModelIndex xIndex = xModelIndex(pointPos);
+        QModelIndex yIndex = yModelIndex(pointPos);
+        if (xIndex.isValid() && yIndex.isValid())
+            points << QPointF(valueFromModel(xIndex), valueFromModel(yIndex));
+        else
+            points << m_series->at(pointPos);
     }
+
+    blockSeriesSignals();
+    if (points.count() == 1)
+        m_series->replace(first, points.first());
+    else
+        QXYSeriesPrivate::get(m_series)->replacePoints(first, points);
     blockSeriesSignals(false);
 }
 
@@ -458,9 +576,21 @@ void QXYModelMapperPrivate::modelColumnsRemoved(QModelIndex parent, int start, i
 
 void QXYModelMapperPrivate::handleModelDestroyed()
 {
+    stopLoading();
     m_model = 0;
 }
 
+// The model is about to change the values the loader reads: the points are passed to the series
+// before the change is applied
+void QXYModelMapperPrivate::waitForLoading()
+{
+    if (!m_loader)
+        return;
+
+    m_loader->wait();
+    handleLoadingFinished();
+}
+
 void QXYModelMapperPrivate::insertData(int start, int end)
 {
     if (m_model == 0 || m_series == 0)
@@ -474,22 +604,18 @@ void QXYModelMapperPrivate::insertData(int start, int end)
             addedCount = m_count;
         int first = qMax(start, m_first);
         int last = qMin(first + addedCount - 1, m_orientation == Qt::Vertical ? m_model->rowCount() - 1 : m_model->columnCount() - 1);
+        QVector<QPointF> points;
         for (int i = first; i <= last; i++) {
-            QPointF point;
             QModelIndex xIndex = xModelIndex(i - m_first);
             QModelIndex yIndex = yModelIndex(i - m_first);
-            if (xIndex.isValid() && yIndex.isValid()) {
-                point.setX(valueFromModel(xIndex));
-                point.setY(valueFromModel(yIndex));
-                m_series->insert(i - m_first, point);
-            }
+            if (xIndex.isValid() && yIndex.isValid())
+                points << QPointF(valueFromModel(xIndex), valueFromModel(yIndex));
         }
+        insertPoints(first - m_first, points);
 
         // remove excess of points (above m_count)
-        if (m_count != -1 && m_series->points().size() > m_count)
-            for (int i = m_series->points().size() - 1; i >= m_count; i--) {
-                m_series->remove(m_series->points().at(i));
-            }
+        if (m_count != -1 && m_series->count() > m_count)
+            removePoints(m_count, m_series->count() - m_count);
     }
 }
 
@@ -505,9 +631,8 @@ void QXYModelMapperPrivate::removeData(int start, int end)
         int toRemove = qMin(m_series->count(), removedCount);     // first find how many items can actually be removed
         int first = qMax(start, m_first);    // get the index of the first item that will be removed.
         int last = qMin(first + toRemove - 1, m_series->count() + m_first - 1);    // get the index of the last item that will be removed.
-        for (int i = last; i >= first; i--) {
-            m_series->remove(m_series->points().at(i - m_first));
-        }
+        if (last >= first)
+            removePoints(first - m_first, last - first + 1);
 
         if (m_count != -1) {
             int itemsAvailable;     // check how many are available to be added
@@ -517,26 +642,65 @@ void QXYModelMapperPrivate::removeData(int start, int end)
                 itemsAvailable = m_model->columnCount() - m_first - m_series->count();
             int toBeAdded = qMin(itemsAvailable, m_count - m_series->count());     // add not more items than there is space left to be filled.
             int currentSize = m_series->count();
-            if (toBeAdded > 0)
-                for (int i = m_series->count(); i < currentSize + toBeAdded; i++) {
-                    QPointF point;
-                    QModelIndex xIndex = xModelIndex(i);
-                    QModelIndex yIndex = yModelIndex(i);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        point.setX(valueFromModel(xIndex));
-                        point.setY(valueFromModel(yIndex));
-                        m_series->insert(i, point);
-                    }
-                }
+            QVector<QPointF> points;
+            for (int i = currentSize; i < currentSize + toBeAdded; i++) {
+                QModelIndex xIndex = xModelIndex(i);
+                QModelIndex yIndex = yModelIndex(i);
+                if (xIndex.isValid() && yIndex.isValid())
+                    points << QPointF(valueFromModel(xIndex), valueFromModel(yIndex));
+            }
+            insertPoints(currentSize, points);
         }
     }
 }
 
+// A single point goes through the public API, so that the series emits pointAdded() for it.
+// Several points are inserted with a single pointsReplaced().
+void QXYModelMapperPrivate::insertPoints(int index, const QVector<QPointF> &points)
+{
+    if (points.count() == 1)
+        m_series->insert(index, points.first());
+    else
+        QXYSeriesPrivate::get(m_series)->insertPoints(index, points);
+}
+
+void QXYModelMapperPrivate::removePoints(int index, int count)
+{
+    if (count == 1)
+        m_series->remove(index);
+    else
+        m_series->removePoints(index, count);
+}
+
 void QXYModelMapperPrivate::initializeXYFromModel()
 {
+    stopLoading();
+
     if (m_model == 0 || m_series == 0)
         return;
 
+    NumericSection xValues(m_model, m_orientation, m_xSection);
+    NumericSection yValues(m_model, m_orientation, m_ySection);
+    if (xValues.isValid() && yValues.isValid()) {
+        int pointCount = qMin(xValues.count(), yValues.count());
+        pointCount = qMin(pointCount, m_orientation == Qt::Vertical ? m_model->rowCount()
+                                                                    : m_model->columnCount());
+        pointCount -= m_first;
+        if (m_count != -1)
+            pointCount = qMin(pointCount, m_count);
+        pointCount = qMax(pointCount, 0);
+
+        if (m_backgroundLoading && pointCount >= backgroundLoadingThreshold) {
+            startLoading(new XYModelLoader(xValues, yValues, m_first, pointCount, this));
+            return;
+        }
+
+        blockSeriesSignals();
+        m_series->replace(numericPoints(xValues, yValues, m_first, pointCount));
+        blockSeriesSignals(false);
+        return;
+    }
+
     blockSeriesSignals();
     // clear current content
     m_series->clear();
@@ -573,6 +737,60 @@ void QXYModelMapperPrivate::initializeXYFromModel()
     blockSeriesSignals(false);
 }
 
+void QXYModelMapperPrivate::startLoading(XYModelLoader *loader)
+{
+    m_loader = loader;
+    connect(m_loader, SIGNAL(finished()), this, SLOT(handleLoadingFinished()));
+    m_loader->start();
+}
+
+// Cancels the loading in progress. Returns true if the model was being loaded.
+bool QXYModelMapperPrivate::stopLoading()
+{
+    if (!m_loader)
+        return false;
+
+    delete m_loader;
+    m_loader = 0;
+    return true;
+}
+
+void QXYModelMapperPrivate::handleLoadingFinished()
+{
+    // The finished() signal of a loader already handled by waitForLoading() is ignored
+    if (!m_loader || !m_loader->isFinished())
+        return;
+
+    QVector<QPointF> points = m_loader->points();
+    stopLoading();
+
+    if (m_series) {
+        blockSeriesSignals();
+        m_series->replace(points);
+        blockSeriesSignals(false);
+    }
+
+    Q_Q(QXYModelMapper);
+    emit q->loadingFinished();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+XYModelLoader::XYModelLoader(const NumericSection &xValues, const NumericSection &yValues,
+                             int first, int count, QObject *parent)
+    : ModelLoader(parent)
+{
+    addSection(xValues, first, count);
+    addSection(yValues, first, count);
+}
+
+void XYModelLoader::run()
+{
+    const Section &x = m_sections.at(0);
+    const Section &y = m_sections.at(1);
+    m_points = numericPoints(x.values, y.values, x.first, qMin(x.count, y.count), this);
+}
+
 #include "moc_qxymodelmapper.cpp"
 #include "moc_qxymodelmapper_p.cpp"
 
@@ -41,11 +41,13 @@
 
 #include <QtCharts/QXYModelMapper>
 #include <QtCore/QObject>
+#include <QtCore/QVector>
+#include <QtCore/QPointF>
+#include <private/modelloader_p.h>
 
 QT_BEGIN_NAMESPACE
 class QModelIndex;
 class QAbstractItemModel;
-class QPointF;
 QT_END_NAMESPACE
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -53,12 +55,31 @@ QT_CHARTS_BEGIN_NAMESPACE
 class QXYModelMapper;
 class QXYSeries;
 
+// Reads the points of an x and a y section in a worker thread
+class XYModelLoader : public ModelLoader
+{
+public:
+    XYModelLoader(const NumericSection &xValues, const NumericSection &yValues, int first,
+                  int count, QObject *parent = 0);
+
+    QVector<QPointF> points() const { return m_points; }
+
+protected:
+    void run() Q_DECL_OVERRIDE;
+
+private:
+    QVector<QPointF> m_points;
+};
+
 class QXYModelMapperPrivate : public QObject
 {
     Q_OBJECT
 
 public:
     QXYModelMapperPrivate(QXYModelMapper *q);
+    ~QXYModelMapperPrivate();
+
+    bool isLoading() const { return m_loader != 0; }
 
 public Q_SLOTS:
     // for the model
@@ -68,6 +89,7 @@ public Q_SLOTS:
     void modelColumnsAdded(QModelIndex parent, int start, int end);
     void modelColumnsRemoved(QModelIndex parent, int start, int end);
     void handleModelDestroyed();
+    void waitForLoading();
 
     // for the series
     void handlePointAdded(int pointPos);
@@ -77,16 +99,21 @@ public Q_SLOTS:
     void handleSeriesDestroyed();
 
     void initializeXYFromModel();
+    void handleLoadingFinished();
 
 private:
     QModelIndex xModelIndex(int xPos);
     QModelIndex yModelIndex(int yPos);
     void insertData(int start, int end);
     void removeData(int start, int end);
+    void insertPoints(int index, const QVector<QPointF> &points);
+    void removePoints(int index, int count);
     void blockModelSignals(bool block = true);
     void blockSeriesSignals(bool block = true);
     qreal valueFromModel(QModelIndex index);
     void setValueToModel(QModelIndex index, qreal value);
+    void startLoading(XYModelLoader *loader);
+    bool stopLoading();
 
 private:
     QXYSeries *m_series;
@@ -98,6 +125,8 @@ private:
     int m_ySection;
     bool m_seriesSignalsBlock;
     bool m_modelSignalsBlock;
+    bool m_backgroundLoading;
+    XYModelLoader *m_loader;
 
 private:
     QXYModelMapper *q_ptr;
@@ -31,6 +31,7 @@
 #include <private/qxyseries_p.h>
 #include <private/abstractdomain_p.h>
 #include <QtCharts/QValueAxis>
+#include <private/qvalueaxis_p.h>
 #include <private/xychart_p.h>
 #include <QtCharts/QXYLegendMarker>
 #include <private/charthelpers_p.h>
@@ -527,8 +528,9 @@ void QXYSeries::append(const QPointF &point)
     Q_D(QXYSeries);
 
     if (isValidValue(point)) {
-        d->m_points << point;
-        emit pointAdded(d->m_points.count() - 1);
+        d->m_data->m_points << point;
+        d->m_data->expandBounds(point);
+        d->emitPointAdded(d->m_data->m_points.count() - 1);
     }
 }
 
@@ -562,7 +564,7 @@ void QXYSeries::replace(qreal oldX, qreal oldY, qreal newX, qreal newY)
 void QXYSeries::replace(const QPointF &oldPoint, const QPointF &newPoint)
 {
     Q_D(QXYSeries);
-    int index = d->m_points.indexOf(oldPoint);
+    int index = d->m_data->m_points.indexOf(oldPoint);
     if (index == -1)
         return;
     replace(index, newPoint);
@@ -587,8 +589,10 @@ void QXYSeries::replace(int index, const QPointF &newPoint)
 {
     Q_D(QXYSeries);
     if (isValidValue(newPoint)) {
-        d->m_points[index] = newPoint;
-        emit pointReplaced(index);
+        d->m_data->invalidateBounds(d->m_data->m_points.at(index));
+        d->m_data->m_points[index] = newPoint;
+        d->m_data->expandBounds(newPoint);
+        d->emitPointReplaced(index);
     }
 }
 
@@ -615,8 +619,9 @@ void QXYSeries::replace(QList<QPointF> points)
 void QXYSeries::replace(QVector<QPointF> points)
 {
     Q_D(QXYSeries);
-    d->m_points = points;
-    emit pointsReplaced();
+    d->m_data->m_points = points;
+    d->m_data->invalidateBounds();
+    d->emitPointsReplaced();
 }
 
 /*!
@@ -635,7 +640,7 @@ void QXYSeries::remove(qreal x, qreal y)
 void QXYSeries::remove(const QPointF &point)
 {
     Q_D(QXYSeries);
-    int index = d->m_points.indexOf(point);
+    int index = d->m_data->m_points.indexOf(point);
     if (index == -1)
         return;
     remove(index);
@@ -648,8 +653,9 @@ void QXYSeries::remove(const QPointF &point)
 void QXYSeries::remove(int index)
 {
     Q_D(QXYSeries);
-    d->m_points.remove(index);
-    emit pointRemoved(index);
+    d->m_data->invalidateBounds(d->m_data->m_points.at(index));
+    d->m_data->m_points.remove(index);
+    d->emitPointRemoved(index);
 }
 
 /*!
@@ -663,8 +669,14 @@ void QXYSeries::removePoints(int index, int count)
     // remove(qreal, qreal) overload in some implicit casting cases.
     Q_D(QXYSeries);
     if (count > 0) {
-        d->m_points.remove(index, count);
-        emit pointsRemoved(index, count);
+        if (count == d->m_data->m_points.size()) {
+            d->m_data->invalidateBounds();
+        } else {
+            for (int i = index; i < index + count; i++)
+                d->m_data->invalidateBounds(d->m_data->m_points.at(i));
+        }
+        d->m_data->m_points.remove(index, count);
+        d->emitPointsRemoved(index, count);
     }
 }
 
@@ -677,9 +689,10 @@ void QXYSeries::insert(int index, const QPointF &point)
 {
     Q_D(QXYSeries);
     if (isValidValue(point)) {
-        index = qMax(0, qMin(index, d->m_points.size()));
-        d->m_points.insert(index, point);
-        emit pointAdded(index);
+        index = qMax(0, qMin(index, d->m_data->m_points.size()));
+        d->m_data->m_points.insert(index, point);
+        d->m_data->expandBounds(point);
+        d->emitPointAdded(index);
     }
 }
 
@@ -690,7 +703,7 @@ void QXYSeries::insert(int index, const QPointF &point)
 void QXYSeries::clear()
 {
     Q_D(QXYSeries);
-    removePoints(0, d->m_points.size());
+    removePoints(0, d->m_data->m_points.size());
 }
 
 /*!
@@ -700,7 +713,7 @@ void QXYSeries::clear()
 QList<QPointF> QXYSeries::points() const
 {
     Q_D(const QXYSeries);
-    return d->m_points.toList();
+    return d->m_data->m_points.toList();
 }
 
 /*!
@@ -710,7 +723,7 @@ QList<QPointF> QXYSeries::points() const
 QVector<QPointF> QXYSeries::pointsVector() const
 {
     Q_D(const QXYSeries);
-    return d->m_points;
+    return d->m_data->m_points;
 }
 
 /*!
@@ -720,7 +733,7 @@ QVector<QPointF> QXYSeries::pointsVector() const
 const QPointF &QXYSeries::at(int index) const
 {
     Q_D(const QXYSeries);
-    return d->m_points.at(index);
+    return d->m_data->m_points.at(index);
 }
 
 /*!
@@ -729,7 +742,45 @@ const QPointF &QXYSeries::at(int index) const
 int QXYSeries::count() const
 {
     Q_D(const QXYSeries);
-    return d->m_points.count();
+    return d->m_data->m_points.count();
+}
+
+/*!
+    Makes the series use the data points of \a series without copying them.
+    The points of this series are discarded.
+
+    Any number of series, in the same or in different charts, can share their data this way.
+    A change made through any of them is seen by all of them, and each series emits the
+    corresponding point signal. The bounds of the shared points are only calculated once for all
+    of the series.
+
+    \sa detachData()
+*/
+void QXYSeries::shareData(QXYSeries *series)
+{
+    Q_D(QXYSeries);
+    if (!series || series->d_func()->m_data == d->m_data)
+        return;
+
+    d->setData(series->d_func()->m_data);
+    emit pointsReplaced();
+    d->updateAutoRangeAxes();
+}
+
+/*!
+    Stops sharing the data points of the series with other series. The series keeps its current
+    points, and they are only copied once either side changes them.
+
+    \sa shareData()
+*/
+void QXYSeries::detachData()
+{
+    Q_D(QXYSeries);
+    if (d->m_data->m_series.count() > 1) {
+        XYSeriesData *data = new XYSeriesData(*d->m_data);
+        data->m_series.clear();
+        d->setData(QSharedPointer<XYSeriesData>(data));
+    }
 }
 
 
@@ -817,6 +868,7 @@ void QXYSeries::setPointLabelsFormat(const QString &format)
     Q_D(QXYSeries);
     if (d->m_pointLabelsFormat != format) {
         d->m_pointLabelsFormat = format;
+        d->m_pointLabelsTemplate = LabelTemplate(format, d->pointLabelTags());
         emit pointLabelsFormatChanged(format);
     }
 }
@@ -915,6 +967,70 @@ QXYSeries &QXYSeries::operator<< (const QList<QPointF>& points)
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+XYSeriesData::XYSeriesData()
+    : m_minX(0),
+      m_maxX(0),
+      m_minY(0),
+      m_maxY(0),
+      m_boundsDirty(true)
+{
+}
+
+/*
+ * Returns the bounds of the points, or false if there are none. A full scan is only needed
+ * after a point on the boundary has been removed or replaced, and is shared by all series
+ * viewing the data.
+ */
+bool XYSeriesData::bounds(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY) const
+{
+    if (m_points.isEmpty())
+        return false;
+
+    if (m_boundsDirty) {
+        m_minX = m_maxX = m_points.at(0).x();
+        m_minY = m_maxY = m_points.at(0).y();
+        for (int i = 1; i < m_points.count(); i++) {
+            const QPointF &point = m_points.at(i);
+            m_minX = qMin(m_minX, point.x());
+            m_maxX = qMax(m_maxX, point.x());
+            m_minY = qMin(m_minY, point.y());
+            m_maxY = qMax(m_maxY, point.y());
+        }
+        m_boundsDirty = false;
+    }
+
+    minX = m_minX;
+    maxX = m_maxX;
+    minY = m_minY;
+    maxY = m_maxY;
+    return true;
+}
+
+void XYSeriesData::expandBounds(const QPointF &point)
+{
+    if (m_boundsDirty)
+        return;
+
+    if (m_points.count() == 1) {
+        m_minX = m_maxX = point.x();
+        m_minY = m_maxY = point.y();
+    } else {
+        m_minX = qMin(m_minX, point.x());
+        m_maxX = qMax(m_maxX, point.x());
+        m_minY = qMin(m_minY, point.y());
+        m_maxY = qMax(m_maxY, point.y());
+    }
+}
+
+void XYSeriesData::invalidateBounds(const QPointF &point)
+{
+    if (point.x() == m_minX || point.x() == m_maxX
+        || point.y() == m_minY || point.y() == m_maxY) {
+        m_boundsDirty = true;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QXYSeriesPrivate::QXYSeriesPrivate(QXYSeries *q)
     : QAbstractSeriesPrivate(q),
@@ -922,11 +1038,18 @@ QXYSeriesPrivate::QXYSeriesPrivate(QXYSeries *q)
       m_brush(QChartPrivate::defaultBrush()),
       m_pointsVisible(false),
       m_pointLabelsFormat(QLatin1String("@xPoint, @yPoint")),
+      m_pointLabelsTemplate(m_pointLabelsFormat, pointLabelTags()),
       m_pointLabelsVisible(false),
       m_pointLabelsFont(QChartPrivate::defaultFont()),
       m_pointLabelsColor(QChartPrivate::defaultPen().color()),
       m_pointLabelsClipping(true)
 {
+    setData(QSharedPointer<XYSeriesData>(new XYSeriesData));
+}
+
+QXYSeriesPrivate::~QXYSeriesPrivate()
+{
+    m_data->m_series.removeOne(this);
 }
 
 void QXYSeriesPrivate::initializeDomain()
@@ -936,27 +1059,132 @@ void QXYSeriesPrivate::initializeDomain()
     qreal maxX(1);
     qreal maxY(1);
 
-    Q_Q(QXYSeries);
+    bounds(minX, maxX, minY, maxY);
+
+    domain()->setRange(minX, maxX, minY, maxY);
+}
 
-    const QVector<QPointF> &points = q->pointsVector();
-
-    if (!points.isEmpty()) {
-        minX = points[0].x();
-        minY = points[0].y();
-        maxX = minX;
-        maxY = minY;
-
-        for (int i = 0; i < points.count(); i++) {
-            qreal x = points[i].x();
-            qreal y = points[i].y();
-            minX = qMin(minX, x);
-            minY = qMin(minY, y);
-            maxX = qMax(maxX, x);
-            maxY = qMax(maxY, y);
+bool QXYSeriesPrivate::bounds(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY) const
+{
+    return m_data->bounds(minX, maxX, minY, maxY);
+}
+
+void QXYSeriesPrivate::updateAutoRangeAxes()
+{
+    foreach (QAbstractAxis *axis, m_axes) {
+        if (axis->type() == QAbstractAxis::AxisTypeValue)
+            static_cast<QValueAxisPrivate *>(axis->d_ptr.data())->updateAutoRange();
+    }
+}
+
+/*
+ * Makes the series view data, leaving the data it viewed so far. The data is deleted once the
+ * last series viewing it leaves.
+ */
+void QXYSeriesPrivate::setData(const QSharedPointer<XYSeriesData> &data)
+{
+    if (m_data)
+        m_data->m_series.removeOne(this);
+    m_data = data;
+    m_data->m_series.append(this);
+}
+
+/*
+ * The emit functions notify every series viewing the data of a change to it, so that a change
+ * made through one series updates the items and axes of all of them.
+ */
+void QXYSeriesPrivate::emitPointAdded(int index)
+{
+    foreach (QXYSeriesPrivate *series, m_data->m_series) {
+        emit series->q_func()->pointAdded(index);
+        series->updateAutoRangeAxes();
+    }
+}
+
+void QXYSeriesPrivate::emitPointReplaced(int index)
+{
+    foreach (QXYSeriesPrivate *series, m_data->m_series) {
+        emit series->q_func()->pointReplaced(index);
+        series->updateAutoRangeAxes();
+    }
+}
+
+void QXYSeriesPrivate::emitPointRemoved(int index)
+{
+    foreach (QXYSeriesPrivate *series, m_data->m_series) {
+        emit series->q_func()->pointRemoved(index);
+        series->updateAutoRangeAxes();
+    }
+}
+
+void QXYSeriesPrivate::emitPointsRemoved(int index, int count)
+{
+    foreach (QXYSeriesPrivate *series, m_data->m_series) {
+        emit series->q_func()->pointsRemoved(index, count);
+        series->updateAutoRangeAxes();
+    }
+}
+
+void QXYSeriesPrivate::emitPointsReplaced()
+{
+    foreach (QXYSeriesPrivate *series, m_data->m_series) {
+        emit series->q_func()->pointsReplaced();
+        series->updateAutoRangeAxes();
+    }
+}
+
+/*
+ * Replaces the points starting at index with points, emitting a single pointsReplaced() for the
+ * whole range. Invalid points leave the old points in place.
+ */
+void QXYSeriesPrivate::replacePoints(int index, const QVector<QPointF> &points)
+{
+    if (points.isEmpty())
+        return;
+
+    QVector<QPointF> &data = m_data->m_points;
+    const int count = qMin(points.count(), data.count() - index);
+    for (int i = 0; i < count; i++) {
+        const QPointF &point = points.at(i);
+        if (isValidValue(point)) {
+            m_data->invalidateBounds(data.at(index + i));
+            data[index + i] = point;
+            m_data->expandBounds(point);
         }
     }
+    emitPointsReplaced();
+}
 
-    domain()->setRange(minX, maxX, minY, maxY);
+/*
+ * Inserts points at index, emitting a single pointsReplaced() for the whole range.
+ * Invalid points are skipped.
+ */
+void QXYSeriesPrivate::insertPoints(int index, const QVector<QPointF> &points)
+{
+    QVector<QPointF> valid;
+    valid.reserve(points.count());
+    foreach (const QPointF &point, points) {
+        if (isValidValue(point))
+            valid << point;
+    }
+    if (valid.isEmpty())
+        return;
+
+    QVector<QPointF> &data = m_data->m_points;
+    if (data.isEmpty())
+        m_data->invalidateBounds();
+    index = qMax(0, qMin(index, data.size()));
+    data.insert(index, valid.count(), QPointF());
+    for (int i = 0; i < valid.count(); i++) {
+        data[index + i] = valid.at(i);
+        m_data->expandBounds(valid.at(i));
+    }
+    emitPointsReplaced();
+}
+
+QXYSeriesPrivate *QXYSeriesPrivate::get(QXYSeries *series)
+{
+    return series->d_func();
 }
 
 QList<QLegendMarker*> QXYSeriesPrivate::createLegendMarkers(QLegend* legend)
@@ -998,22 +1226,32 @@ void QXYSeriesPrivate::initializeAnimations(QtCharts::QChart::AnimationOptions o
     QAbstractSeriesPrivate::initializeAnimations(options, duration, curve);
 }
 
+QStringList QXYSeriesPrivate::pointLabelTags()
+{
+    // Tag indexes match the arguments of LabelTemplate::expand(): x first, then y
+    static const QStringList tags = QStringList() << QStringLiteral("@xPoint")
+                                                  << QStringLiteral("@yPoint");
+    return tags;
+}
+
 void QXYSeriesPrivate::drawSeriesPointLabels(QPainter *painter, const QVector<QPointF> &points,
                                              const int offset)
 {
-    static const QString xPointTag(QLatin1String("@xPoint"));
-    static const QString yPointTag(QLatin1String("@yPoint"));
     const int labelOffset = offset + 2;
 
     painter->setFont(m_pointLabelsFont);
     painter->setPen(QPen(m_pointLabelsColor));
     QFontMetrics fm(painter->font());
-    // m_points is used for the label here as it has the series point information
+    // m_data->m_points is used for the label here as it has the series point information
     // points variable passed is used for positioning because it has the coordinates
-    for (int i(0); i < m_points.size(); i++) {
-        QString pointLabel = m_pointLabelsFormat;
-        pointLabel.replace(xPointTag, presenter()->numberToString(m_points.at(i).x()));
-        pointLabel.replace(yPointTag, presenter()->numberToString(m_points.at(i).y()));
+    const bool hasX = m_pointLabelsTemplate.containsTag(0);
+    const bool hasY = m_pointLabelsTemplate.containsTag(1);
+    const QVector<QPointF> &seriesPoints = m_data->m_points;
+    for (int i(0); i < seriesPoints.size(); i++) {
+        const QPointF &point = seriesPoints.at(i);
+        QString pointLabel = m_pointLabelsTemplate.expand(
+                    hasX ? presenter()->numberToString(point.x()) : QString(),
+                    hasY ? presenter()->numberToString(point.y()) : QString());
 
         // Position text in relation to the point
         int pointLabelWidth = fm.width(pointLabel);
@@ -79,6 +79,9 @@ public:
     QVector<QPointF> pointsVector() const;
     const QPointF &at(int index) const;
 
+    void shareData(QXYSeries *series);
+    void detachData();
+
     QXYSeries &operator << (const QPointF &point);
     QXYSeries &operator << (const QList<QPointF> &points);
 
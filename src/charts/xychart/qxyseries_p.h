@@ -40,18 +40,45 @@
 #define QXYSERIES_P_H
 
 #include <private/qabstractseries_p.h>
+#include <private/labelformatter_p.h>
+#include <QtCore/QSharedPointer>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
 class QXYSeries;
+class QXYSeriesPrivate;
 class QAbstractAxis;
 
+// Points of one or more series sharing the same data, see QXYSeries::shareData()
+class XYSeriesData
+{
+public:
+    XYSeriesData();
+
+    bool bounds(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY) const;
+    void expandBounds(const QPointF &point);
+    void invalidateBounds(const QPointF &point);
+    void invalidateBounds() { m_boundsDirty = true; }
+
+    QVector<QPointF> m_points;
+    QList<QXYSeriesPrivate *> m_series;
+
+    // Bounds of m_points, expanded as points are added and recalculated lazily once a point
+    // on the boundary has been removed or replaced
+    mutable qreal m_minX;
+    mutable qreal m_maxX;
+    mutable qreal m_minY;
+    mutable qreal m_maxY;
+    mutable bool m_boundsDirty;
+};
+
 class QXYSeriesPrivate: public QAbstractSeriesPrivate
 {
     Q_OBJECT
 
 public:
     QXYSeriesPrivate(QXYSeries *q);
+    ~QXYSeriesPrivate();
 
     void initializeDomain();
     void initializeAxes();
@@ -66,15 +93,33 @@ public:
     void drawSeriesPointLabels(QPainter *painter, const QVector<QPointF> &points,
                                const int offset = 0);
 
+    static QStringList pointLabelTags();
+
+    bool bounds(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY) const;
+    void updateAutoRangeAxes();
+
+    void setData(const QSharedPointer<XYSeriesData> &data);
+    void emitPointAdded(int index);
+    void emitPointReplaced(int index);
+    void emitPointRemoved(int index);
+    void emitPointsRemoved(int index, int count);
+    void emitPointsReplaced();
+
+    void replacePoints(int index, const QVector<QPointF> &points);
+    void insertPoints(int index, const QVector<QPointF> &points);
+
+    static QXYSeriesPrivate *get(QXYSeries *series);
+
 Q_SIGNALS:
     void updated();
 
 protected:
-    QVector<QPointF> m_points;
+    QSharedPointer<XYSeriesData> m_data;
     QPen m_pen;
     QBrush m_brush;
     bool m_pointsVisible;
     QString m_pointLabelsFormat;
+    LabelTemplate m_pointLabelsTemplate;
     bool m_pointLabelsVisible;
     QFont m_pointLabelsFont;
     QColor m_pointLabelsColor;
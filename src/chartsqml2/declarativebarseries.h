@@ -76,6 +76,7 @@ Q_SIGNALS:
 
 private Q_SLOTS:
     void handleCountChanged(int index, int count);
+    void handleValuesReplaced();
     void handleBrushChanged();
 
 private:
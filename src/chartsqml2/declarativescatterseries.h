@@ -108,7 +108,7 @@ Q_SIGNALS:
 
 public Q_SLOTS:
     static void appendDeclarativeChildren(QQmlListProperty<QObject> *list, QObject *element);
-    void handleCountChanged(int index);
+    void handleCountChanged(int index = 0);
 
 private Q_SLOTS:
     void handleBrushChanged();
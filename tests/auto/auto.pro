@@ -4,6 +4,8 @@ SUBDIRS += \
            qchart \
            qlineseries \ 
            qbarset \
+           qboxplotseries \
+           qboxset \
            qbarseries \
            qstackedbarseries \
            qpercentbarseries \
@@ -13,6 +15,7 @@ SUBDIRS += \
            qscatterseries \
            qxymodelmapper \
            qbarmodelmapper \
+           qboxplotmodelmapper \
            qhorizontalbarseries \
            qhorizontalstackedbarseries \
            qhorizontalpercentbarseries \
@@ -22,6 +25,7 @@ SUBDIRS += \
            qbarcategoryaxis \
            domain \
            chartdataset \
+           labelformatter \
            qlegend \
            qareaseries \
            cmake \
@@ -41,5 +45,6 @@ qtHaveModule(quick) {
 
 !contains(QT_CONFIG, private_tests): SUBDIRS -= \
     domain \
-    chartdataset
+    chartdataset \
+    labelformatter
 
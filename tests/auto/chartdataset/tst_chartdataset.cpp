@@ -87,6 +87,7 @@ private Q_SLOTS:
     void detachAxis_data();
     void detachAxis();
     void domainChangePreservesRanges();
+    void addSeriesBatch();
 
 private:
     void compareDomain(QAbstractSeries *series, qreal minX, qreal maxX,
@@ -439,6 +440,47 @@ void tst_ChartDataSet::domainChangePreservesRanges()
     compareDomain(line, 4.0, 8.0, 3.0, 7.0);
 }
 
+void tst_ChartDataSet::addSeriesBatch()
+{
+    QValueAxis *axisX = new QValueAxis(this);
+    QValueAxis *axisY = new QValueAxis(this);
+    axisY->setAutoRange(true);
+    m_dataset->addAxis(axisX, Qt::AlignBottom);
+    m_dataset->addAxis(axisY, Qt::AlignLeft);
+
+    QList<QAbstractSeries *> seriesList;
+    for (int i = 0; i < 50; i++) {
+        QLineSeries *series = new QLineSeries(this);
+        series->append(0, i);
+        series->append(10, i + 1);
+        seriesList << series;
+    }
+
+    QSignalSpy spy(m_dataset, SIGNAL(seriesAdded(QAbstractSeries*)));
+    m_dataset->addSeries(seriesList, QList<QAbstractAxis *>() << axisX << axisY);
+
+    QCOMPARE(spy.count(), 50);
+    QCOMPARE(m_dataset->series(), seriesList);
+    foreach (QAbstractSeries *series, seriesList)
+        QCOMPARE(series->attachedAxes(), QList<QAbstractAxis *>() << axisX << axisY);
+
+    // the auto range covers all the series
+    QCOMPARE(axisY->min(), -5.0);
+    QCOMPARE(axisY->max(), 55.0);
+
+    // series already on the chart are skipped
+    m_dataset->addSeries(seriesList.mid(0, 10), QList<QAbstractAxis *>() << axisX);
+    QCOMPARE(spy.count(), 50);
+    QCOMPARE(m_dataset->series().count(), 50);
+
+    // removing a series detaches it from the axes
+    m_dataset->removeSeries(seriesList.first());
+    QCOMPARE(m_dataset->series().count(), 49);
+    QVERIFY(seriesList.first()->attachedAxes().isEmpty());
+    QVERIFY(m_dataset->attachAxis(seriesList.first(), axisX) == false);
+    seriesList.first()->setParent(this);
+}
+
 void tst_ChartDataSet::compareDomain(QAbstractSeries *series, qreal minX, qreal maxX,
                                      qreal minY, qreal maxY) const
 {
@@ -0,0 +1,128 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef NUMERICTABLEMODEL_H
+#define NUMERICTABLEMODEL_H
+
+#include <QtCharts/QNumericColumnAccess>
+#include <QtCore/QAbstractTableModel>
+#include <QtCore/QVector>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Table model storing its values row by row, readable through QNumericColumnAccess.
+// The value of a cell is row * columnCount + column.
+class NumericTableModel : public QAbstractTableModel, public QNumericColumnAccess
+{
+    Q_OBJECT
+    Q_INTERFACES(QtCharts::QNumericColumnAccess)
+
+public:
+    NumericTableModel(int rowCount, int columnCount, QObject *parent = 0)
+        : QAbstractTableModel(parent),
+          m_rowCount(rowCount),
+          m_columnCount(columnCount),
+          m_values(rowCount * columnCount),
+          m_dataCalls(0)
+    {
+        for (int i = 0; i < m_values.count(); i++)
+            m_values[i] = i;
+    }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const
+    {
+        return parent.isValid() ? 0 : m_rowCount;
+    }
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const
+    {
+        return parent.isValid() ? 0 : m_columnCount;
+    }
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const
+    {
+        if (role != Qt::DisplayRole)
+            return QVariant();
+        m_dataCalls++;
+        return m_values.at(index.row() * m_columnCount + index.column());
+    }
+
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole)
+    {
+        if (!index.isValid() || role != Qt::EditRole)
+            return false;
+        m_values[index.row() * m_columnCount + index.column()] = value.toReal();
+        emit dataChanged(index, index);
+        return true;
+    }
+
+    bool insertRows(int row, int count, const QModelIndex &parent = QModelIndex())
+    {
+        beginInsertRows(parent, row, row + count - 1);
+        m_values.insert(row * m_columnCount, count * m_columnCount, 0);
+        m_rowCount += count;
+        endInsertRows();
+        return true;
+    }
+
+    bool removeRows(int row, int count, const QModelIndex &parent = QModelIndex())
+    {
+        beginRemoveRows(parent, row, row + count - 1);
+        m_values.remove(row * m_columnCount, count * m_columnCount);
+        m_rowCount -= count;
+        endRemoveRows();
+        return true;
+    }
+
+    const qreal *numericSection(Qt::Orientation orientation, int section, int role,
+                                int *count, int *stride) const
+    {
+        if (role != Qt::DisplayRole)
+            return 0;
+        if (orientation == Qt::Vertical) {
+            if (section >= m_columnCount)
+                return 0;
+            *count = m_rowCount;
+            *stride = m_columnCount;
+            return m_values.constData() + section;
+        }
+        if (section >= m_rowCount)
+            return 0;
+        *count = m_columnCount;
+        *stride = 1;
+        return m_values.constData() + section * m_columnCount;
+    }
+
+    int m_rowCount;
+    int m_columnCount;
+    QVector<qreal> m_values;
+    mutable int m_dataCalls;
+};
+
+#endif // NUMERICTABLEMODEL_H
@@ -0,0 +1,7 @@
+!include( ../auto.pri ) {
+    error( "Couldn't find the auto.pri file!" )
+}
+
+QT += charts-private
+
+SOURCES += tst_labelformatter.cpp
@@ -0,0 +1,158 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+#include <private/labelformatter_p.h>
+#include <tst_definitions.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_LabelFormatter : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void nullFormat();
+    void toString_data();
+    void toString();
+    void toStringLocalized_data();
+    void toStringLocalized();
+    void labelTemplate_data();
+    void labelTemplate();
+};
+
+void tst_LabelFormatter::nullFormat()
+{
+    LabelFormatter formatter;
+    QVERIFY(formatter.isNull());
+    QCOMPARE(formatter.toString(1.0, false, QLocale::c()), QString());
+
+    formatter.setFormat(QString("%.2f"));
+    QVERIFY(!formatter.isNull());
+    QCOMPARE(formatter.format(), QString("%.2f"));
+
+    formatter.setFormat(QString());
+    QVERIFY(formatter.isNull());
+}
+
+void tst_LabelFormatter::toString_data()
+{
+    QTest::addColumn<QString>("format");
+    QTest::addColumn<qreal>("value");
+
+    QTest::newRow("%.2f") << QString("%.2f") << qreal(3.14159);
+    QTest::newRow("%f") << QString("%f") << qreal(-2.5);
+    QTest::newRow("%.0f") << QString("%.0f") << qreal(1234.5678);
+    QTest::newRow("prefix %.1f suffix") << QString("x = %.1f mV") << qreal(0.05);
+    QTest::newRow("%e") << QString("%e") << qreal(12345.678);
+    QTest::newRow("%.3E") << QString("%.3E") << qreal(0.000123);
+    QTest::newRow("%d") << QString("%d") << qreal(42.9);
+    QTest::newRow("%i suffix") << QString("%i units") << qreal(-7.0);
+    QTest::newRow("%+.2f") << QString("%+.2f") << qreal(1.5);
+    QTest::newRow("%08.3f") << QString("%08.3f") << qreal(2.25);
+    QTest::newRow("%g") << QString("%g") << qreal(0.0001);
+    QTest::newRow("%x") << QString("%x") << qreal(255.0);
+    QTest::newRow("%.2f %%") << QString("%.2f %%") << qreal(99.5);
+}
+
+void tst_LabelFormatter::toString()
+{
+    QFETCH(QString, format);
+    QFETCH(qreal, value);
+
+    LabelFormatter formatter(format);
+    const QByteArray array = format.toLatin1();
+    QString expected;
+    const int percent = format.indexOf(QLatin1Char('%'));
+    const QChar spec = format.at(format.indexOf(QRegExp("[dicuoxfegXFEG]"), percent));
+    if (spec == QLatin1Char('d') || spec == QLatin1Char('i'))
+        expected = QString().sprintf(array, qint64(value));
+    else if (spec == QLatin1Char('x'))
+        expected = QString().sprintf(array, quint64(value));
+    else
+        expected = QString().sprintf(array, value);
+
+    QCOMPARE(formatter.toString(value, false, QLocale::c()), expected);
+}
+
+void tst_LabelFormatter::toStringLocalized_data()
+{
+    QTest::addColumn<QString>("format");
+    QTest::addColumn<qreal>("value");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("%.2f") << QString("%.2f") << qreal(1234.567) << QString("1,234.57");
+    QTest::newRow("prefix %.1f suffix") << QString("x = %.1f mV") << qreal(0.26)
+                                        << QString("x = 0.3 mV");
+    QTest::newRow("%.0d") << QString("%.0d") << qreal(1234.0) << QString("1,234");
+    QTest::newRow("%f") << QString("%f") << qreal(1.0) << QString();
+}
+
+void tst_LabelFormatter::toStringLocalized()
+{
+    QFETCH(QString, format);
+    QFETCH(qreal, value);
+    QFETCH(QString, expected);
+
+    LabelFormatter formatter(format);
+    QCOMPARE(formatter.toString(value, true, QLocale(QLocale::English, QLocale::UnitedStates)),
+             expected);
+}
+
+void tst_LabelFormatter::labelTemplate_data()
+{
+    QTest::addColumn<QString>("format");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("default") << QString("@xPoint, @yPoint") << QString("1, 2");
+    QTest::newRow("y only") << QString("(@yPoint)") << QString("(2)");
+    QTest::newRow("repeated") << QString("@xPoint@xPoint") << QString("11");
+    QTest::newRow("no tags") << QString("label") << QString("label");
+    QTest::newRow("partial tag") << QString("@x @xPoin") << QString("@x @xPoin");
+}
+
+void tst_LabelFormatter::labelTemplate()
+{
+    QFETCH(QString, format);
+    QFETCH(QString, expected);
+
+    const QStringList tags = QStringList() << QString("@xPoint") << QString("@yPoint");
+    LabelTemplate labelTemplate(format, tags);
+    QCOMPARE(labelTemplate.format(), format);
+
+    QString replaced = format;
+    replaced.replace(tags.at(0), QString("1"));
+    replaced.replace(tags.at(1), QString("2"));
+    QCOMPARE(labelTemplate.expand(QString("1"), QString("2")), replaced);
+    QCOMPARE(labelTemplate.expand(QString("1"), QString("2")), expected);
+    QCOMPARE(labelTemplate.containsTag(0), format.contains(tags.at(0)));
+    QCOMPARE(labelTemplate.containsTag(1), format.contains(tags.at(1)));
+}
+
+QTEST_MAIN(tst_LabelFormatter)
+#include "tst_labelformatter.moc"
@@ -37,6 +37,7 @@
 #include <QtCharts/QVBarModelMapper>
 #include <QtCharts/QHBarModelMapper>
 #include <QtGui/QStandardItemModel>
+#include "numerictablemodel.h"
 
 QT_CHARTS_USE_NAMESPACE
 
@@ -63,6 +64,7 @@ class tst_qbarmodelmapper : public QObject
     void horizontalMapperCustomMapping_data();
     void horizontalMapperCustomMapping();
     void seriesUpdated();
+    void seriesValuesReplaced();
     void verticalModelInsertRows();
     void verticalModelRemoveRows();
     void verticalModelInsertColumns();
@@ -72,6 +74,8 @@ class tst_qbarmodelmapper : public QObject
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void numericColumnAccess();
+    void backgroundLoading();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -395,6 +399,53 @@ void tst_qbarmodelmapper::seriesUpdated()
     QCOMPARE(m_model->columnCount(), m_modelColumnCount + newBarSets.count());
 }
 
+void tst_qbarmodelmapper::seriesValuesReplaced()
+{
+    // setup the mapper
+    createVerticalMapper();
+    QBarSet *barSet = m_series->barSets().at(1);
+    QCOMPARE(barSet->count(), m_modelRowCount);
+
+    // fewer values remove the surplus rows, which are not read back into the set
+    QVector<qreal> values;
+    values << 11 << 12 << 13;
+    barSet->replace(values);
+    barSet = m_series->barSets().at(1);
+    QCOMPARE(m_model->rowCount(), values.count());
+    QCOMPARE(barSet->count(), values.count());
+    for (int i = 0; i < values.count(); i++) {
+        QCOMPARE(barSet->at(i), values.at(i));
+        QCOMPARE(m_model->data(m_model->index(i, 1)).toReal(), values.at(i));
+    }
+    QCOMPARE(m_series->barSets().first()->count(), values.count());
+
+    // more values add rows
+    values << 14 << 15;
+    barSet->replace(values);
+    barSet = m_series->barSets().at(1);
+    QCOMPARE(m_model->rowCount(), values.count());
+    QCOMPARE(barSet->count(), values.count());
+    QCOMPARE(barSet->at(4), 15.0);
+    QCOMPARE(m_model->data(m_model->index(4, 1)).toReal(), 15.0);
+
+    // with a limited row count only the mapped rows are resized
+    m_vMapper->setFirstRow(1);
+    m_vMapper->setRowCount(2);
+    barSet = m_series->barSets().at(1);
+    QCOMPARE(barSet->count(), 2);
+    values.clear();
+    values << 21;
+    barSet->replace(values);
+    barSet = m_series->barSets().at(1);
+    QCOMPARE(m_vMapper->rowCount(), 1);
+    QCOMPARE(m_model->rowCount(), 4);
+    QCOMPARE(barSet->count(), 1);
+    QCOMPARE(barSet->at(0), 21.0);
+    QCOMPARE(m_model->data(m_model->index(0, 1)).toReal(), 11.0);
+    QCOMPARE(m_model->data(m_model->index(1, 1)).toReal(), 21.0);
+    QCOMPARE(m_model->data(m_model->index(2, 1)).toReal(), 14.0);
+}
+
 void tst_qbarmodelmapper::verticalModelInsertRows()
 {
     // setup the mapper
@@ -629,6 +680,96 @@ void tst_qbarmodelmapper::modelUpdateCell()
     QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 44.0);
 }
 
+void tst_qbarmodelmapper::numericColumnAccess()
+{
+    NumericTableModel *model = new NumericTableModel(10, 4);
+
+    // the values are read from the numeric sections instead of data()
+    QBarSeries *series = new QBarSeries;
+    QVBarModelMapper *vMapper = new QVBarModelMapper;
+    vMapper->setFirstBarSetColumn(1);
+    vMapper->setLastBarSetColumn(3);
+    vMapper->setFirstRow(2);
+    vMapper->setRowCount(5);
+    vMapper->setSeries(series);
+    vMapper->setModel(model);
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(series->count(), 3);
+    QCOMPARE(series->barSets().at(0)->count(), 5);
+    QCOMPARE(series->barSets().at(0)->at(0), 9.0);
+    QCOMPARE(series->barSets().at(0)->at(4), 25.0);
+    QCOMPARE(series->barSets().at(2)->at(4), 27.0);
+    delete vMapper;
+    delete series;
+
+    series = new QBarSeries;
+    QHBarModelMapper *hMapper = new QHBarModelMapper;
+    hMapper->setFirstBarSetRow(0);
+    hMapper->setLastBarSetRow(9);
+    hMapper->setFirstColumn(1);
+    hMapper->setSeries(series);
+    hMapper->setModel(model);
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(series->count(), 10);
+    QCOMPARE(series->barSets().at(0)->count(), 3);
+    QCOMPARE(series->barSets().at(0)->at(0), 1.0);
+    QCOMPARE(series->barSets().at(9)->at(2), 39.0);
+    delete hMapper;
+    delete series;
+
+    delete model;
+}
+
+void tst_qbarmodelmapper::backgroundLoading()
+{
+    const int rowCount = 10000;
+    NumericTableModel *model = new NumericTableModel(rowCount, 3);
+
+    QBarSeries *series = new QBarSeries;
+    QVBarModelMapper *mapper = new QVBarModelMapper;
+    QVERIFY(!mapper->backgroundLoading());
+    mapper->setBackgroundLoading(true);
+    QSignalSpy spy(mapper, SIGNAL(loadingFinished()));
+    QSignalSpy addedSpy(series, SIGNAL(barsetsAdded(QList<QBarSet*>)));
+    mapper->setFirstBarSetColumn(0);
+    mapper->setLastBarSetColumn(2);
+    mapper->setSeries(series);
+    mapper->setModel(model);
+    QVERIFY(mapper->isLoading());
+    QCOMPARE(series->count(), 0);
+
+    QTRY_COMPARE(spy.count(), 1);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(addedSpy.count(), 1);
+    QCOMPARE(series->count(), 3);
+    QCOMPARE(series->barSets().at(2)->count(), rowCount);
+    QCOMPARE(series->barSets().at(2)->at(rowCount - 1), qreal(rowCount * 3 - 1));
+
+    // the bar sets are passed to the series before the model changes, then the model is read
+    // again
+    mapper->setFirstRow(1);
+    QVERIFY(mapper->isLoading());
+    model->removeRows(0, 1);
+    QCOMPARE(spy.count(), 2);
+    QVERIFY(mapper->isLoading());
+    QTRY_COMPARE(spy.count(), 3);
+    QCOMPARE(series->barSets().at(0)->count(), rowCount - 2);
+    QCOMPARE(series->barSets().at(0)->at(0), 6.0);
+
+    // a data change is applied after the bar sets are passed to the series
+    mapper->setFirstRow(0);
+    QVERIFY(mapper->isLoading());
+    model->setData(model->index(0, 1), -1);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(spy.count(), 4);
+    QCOMPARE(series->barSets().at(1)->at(0), -1.0);
+
+    delete mapper;
+    delete series;
+    delete model;
+}
+
 void tst_qbarmodelmapper::verticalMapperSignals()
 {
     QVBarModelMapper *mapper = new QVBarModelMapper;
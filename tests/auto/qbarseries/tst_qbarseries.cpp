@@ -72,6 +72,9 @@ private slots:
     void setLabelsFormat();
     void setLabelsPosition();
     void setLabelsAngle();
+    void labelsClipping();
+    void labelsCulling();
+    void labelsCache();
     void opacity();
     void mouseclicked_data();
     void mouseclicked();
@@ -430,6 +433,123 @@ void tst_QBarSeries::setLabelsAngle()
     QCOMPARE(m_barseries->labelsAngle(), 55.0);
 }
 
+// Counts the pixels in rect that are close to color
+static int colorPixels(const QImage &image, const QRect &rect, const QColor &color)
+{
+    int count = 0;
+    const QRect area = rect.intersected(image.rect());
+    for (int y = area.top(); y <= area.bottom(); y++) {
+        for (int x = area.left(); x <= area.right(); x++) {
+            const QColor pixel(image.pixel(x, y));
+            if (qAbs(pixel.red() - color.red()) < 40 && qAbs(pixel.green() - color.green()) < 40
+                && qAbs(pixel.blue() - color.blue()) < 40) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+static void showLabels(QChartView &view, QBarSeries *series)
+{
+    QFont font;
+    font.setPixelSize(30);
+    font.setBold(true);
+    foreach (QBarSet *set, series->barSets()) {
+        set->setColor(Qt::blue);
+        set->setBorderColor(Qt::blue);
+        set->setLabelFont(font);
+    }
+    series->setLabelsVisible(true);
+    view.resize(400, 300);
+    view.chart()->legend()->hide();
+    view.chart()->addSeries(series);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+}
+
+void tst_QBarSeries::labelsClipping()
+{
+    QBarSeries *series = new QBarSeries();
+    QBarSet *set = new QBarSet("set");
+    *set << 10 << 9;
+    set->setLabelColor(Qt::red);
+    series->append(set);
+    series->setLabelsPosition(QAbstractBarSeries::LabelsOutsideEnd);
+
+    QChartView view(new QChart());
+    showLabels(view, series);
+
+    // The label of the highest bar is above the plot area and not painted, the label of the
+    // other bar extends past the top of the plot area and is painted clipped to it
+    QImage image = view.grab().toImage();
+    QRect plotArea = view.mapFromScene(view.chart()->plotArea()).boundingRect();
+    QRect aboveFirst(plotArea.left(), 0, plotArea.width() / 2, plotArea.top() - 1);
+    QRect aboveSecond(plotArea.center().x(), 0, plotArea.width() / 2, plotArea.top() - 1);
+    QRect insideSecond(plotArea.center().x(), plotArea.top() + 1, plotArea.width() / 2, 30);
+    QCOMPARE(colorPixels(image, aboveFirst, Qt::red), 0);
+    QCOMPARE(colorPixels(image, aboveSecond, Qt::red), 0);
+    QVERIFY(colorPixels(image, insideSecond, Qt::red) > 0);
+}
+
+void tst_QBarSeries::labelsCulling()
+{
+    QBarSeries *series = new QBarSeries();
+    QBarSet *set1 = new QBarSet("set 1");
+    *set1 << 1;
+    set1->setLabelColor(Qt::red);
+    QBarSet *set2 = new QBarSet("set 2");
+    *set2 << 1;
+    set2->setLabelColor(Qt::green);
+    series->append(set1);
+    series->append(set2);
+
+    QChartView view(new QChart());
+    showLabels(view, series);
+    QRect plotArea = view.mapFromScene(view.chart()->plotArea()).boundingRect();
+
+    // Labels of adjacent bars don't overlap, both are painted
+    QImage image = view.grab().toImage();
+    QVERIFY(colorPixels(image, plotArea, Qt::red) > 0);
+    QVERIFY(colorPixels(image, plotArea, Qt::green) > 0);
+
+    // Labels wider than the bars overlap, the label of the later set is hidden
+    series->setLabelsFormat("@value is a label much wider than a bar");
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    image = view.grab().toImage();
+    QVERIFY(colorPixels(image, plotArea, Qt::red) > 0);
+    QCOMPARE(colorPixels(image, plotArea, Qt::green), 0);
+}
+
+void tst_QBarSeries::labelsCache()
+{
+    QBarSeries *series = new QBarSeries();
+    QBarSet *set = new QBarSet("set");
+    *set << 10 << 20 << 30;
+    series->append(set);
+    QChartView view(new QChart());
+    showLabels(view, series);
+    QImage before = view.grab().toImage();
+
+    // Cached labels are updated when values or the label format change, so the chart looks
+    // like one created with the new values and format
+    set->replace(0, 15);
+    series->setLabelsFormat("@value units");
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+    QBarSeries *expectedSeries = new QBarSeries();
+    QBarSet *expectedSet = new QBarSet("set");
+    *expectedSet << 15 << 20 << 30;
+    expectedSeries->append(expectedSet);
+    expectedSeries->setLabelsFormat("@value units");
+    QChartView expectedView(new QChart());
+    showLabels(expectedView, expectedSeries);
+
+    QImage after = view.grab().toImage();
+    QVERIFY(after != before);
+    QCOMPARE(after, expectedView.grab().toImage());
+}
+
 void tst_QBarSeries::opacity()
 {
     QSignalSpy opacitySpy(m_barseries, SIGNAL(opacityChanged()));
@@ -60,6 +60,8 @@ private slots:
     void remove();
     void replace_data();
     void replace();
+    void replaceAll_data();
+    void replaceAll();
     void at_data();
     void at();
     void atOperator_data();
@@ -349,6 +351,50 @@ void tst_QBarSet::replace()
     QVERIFY(valueSpy.count() == 2);
 }
 
+void tst_QBarSet::replaceAll_data()
+{
+
+}
+
+void tst_QBarSet::replaceAll()
+{
+    QSignalSpy addedSpy(m_barset, SIGNAL(valuesAdded(int,int)));
+    QSignalSpy removedSpy(m_barset, SIGNAL(valuesRemoved(int,int)));
+    QSignalSpy replacedSpy(m_barset, SIGNAL(valuesReplaced()));
+
+    m_barset->append(1.0);
+    m_barset->append(2.0);
+
+    // Replace with more values
+    QVector<qreal> values;
+    values << 3.0 << 4.0 << 5.0;
+    m_barset->replace(values);
+    QCOMPARE(m_barset->count(), 3);
+    QCOMPARE(m_barset->sum(), 12.0);
+    QCOMPARE(m_barset->at(0), 3.0);
+    QCOMPARE(m_barset->at(2), 5.0);
+
+    // Replace with fewer values
+    m_barset->replace(QList<qreal>() << 6.0);
+    QCOMPARE(m_barset->count(), 1);
+    QCOMPARE(m_barset->at(0), 6.0);
+
+    // Invalid values are dropped
+    values.clear();
+    values << 1.0 << qQNaN() << 2.0;
+    QTest::ignoreMessage(QtWarningMsg, "Ignored NaN, Inf, or -Inf value.");
+    m_barset->replace(values);
+    QCOMPARE(m_barset->count(), 2);
+    QCOMPARE(m_barset->at(1), 2.0);
+
+    m_barset->replace(QVector<qreal>());
+    QCOMPARE(m_barset->count(), 0);
+
+    QCOMPARE(addedSpy.count(), 2);
+    QCOMPARE(removedSpy.count(), 0);
+    QCOMPARE(replacedSpy.count(), 4);
+}
+
 void tst_QBarSet::at_data()
 {
 
@@ -0,0 +1,7 @@
+!include( ../auto.pri ) {
+    error( "Couldn't find the auto.pri file!" )
+}
+
+SOURCES += tst_qboxplotmodelmapper.cpp
+
+HEADERS += ../inc/numerictablemodel.h
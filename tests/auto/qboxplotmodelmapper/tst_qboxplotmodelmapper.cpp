@@ -0,0 +1,285 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChart>
+#include <QtCharts/QChartView>
+#include <QtCharts/QBoxPlotSeries>
+#include <QtCharts/QBoxSet>
+#include <QtCharts/QVBoxPlotModelMapper>
+#include <QtCharts/QHBoxPlotModelMapper>
+#include <QtGui/QStandardItemModel>
+#include "numerictablemodel.h"
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_qboxplotmodelmapper : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_qboxplotmodelmapper();
+
+public Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+private Q_SLOTS:
+    void verticalMapper_data();
+    void verticalMapper();
+    void horizontalMapper_data();
+    void horizontalMapper();
+    void modelUpdateCell();
+    void numericColumnAccess();
+    void backgroundLoading();
+
+private:
+    QStandardItemModel *m_model;
+    int m_modelRowCount;
+    int m_modelColumnCount;
+
+    QBoxPlotSeries *m_series;
+    QChart *m_chart;
+    QChartView *m_chartView;
+};
+
+tst_qboxplotmodelmapper::tst_qboxplotmodelmapper()
+    : m_model(0),
+      m_modelRowCount(10),
+      m_modelColumnCount(8),
+      m_series(0),
+      m_chart(0),
+      m_chartView(0)
+{
+}
+
+void tst_qboxplotmodelmapper::initTestCase()
+{
+    m_chart = new QChart;
+    m_chartView = new QChartView(m_chart);
+    m_chartView->resize(200, 200);
+    m_chartView->show();
+}
+
+void tst_qboxplotmodelmapper::cleanupTestCase()
+{
+    delete m_chartView;
+    QTest::qWait(1); // Allow final deleteLaters to run
+}
+
+void tst_qboxplotmodelmapper::init()
+{
+    m_series = new QBoxPlotSeries;
+    m_chart->addSeries(m_series);
+
+    m_model = new QStandardItemModel(m_modelRowCount, m_modelColumnCount, this);
+    for (int row = 0; row < m_modelRowCount; ++row) {
+        for (int column = 0; column < m_modelColumnCount; column++)
+            m_model->setData(m_model->index(row, column), row * column);
+    }
+}
+
+void tst_qboxplotmodelmapper::cleanup()
+{
+    m_chart->removeSeries(m_series);
+    delete m_series;
+    m_series = 0;
+
+    m_model->clear();
+    m_model->deleteLater();
+    m_model = 0;
+}
+
+void tst_qboxplotmodelmapper::verticalMapper_data()
+{
+    QTest::addColumn<int>("firstBoxSetColumn");
+    QTest::addColumn<int>("lastBoxSetColumn");
+    QTest::addColumn<int>("expectedBoxSetCount");
+    QTest::newRow("lastBoxSetColumn greater than firstBoxSetColumn") << 0 << 1 << 2;
+    QTest::newRow("lastBoxSetColumn equal to firstBoxSetColumn") << 1 << 1 << 1;
+    QTest::newRow("lastBoxSetColumn lesser than firstBoxSetColumn") << 1 << 0 << 0;
+    QTest::newRow("invalid firstBoxSetColumn and correct lastBoxSetColumn") << -3 << 1 << 0;
+    QTest::newRow("firstBoxSetColumn beyond the size of model and correct lastBoxSetColumn") << m_modelColumnCount << 1 << 0;
+}
+
+void tst_qboxplotmodelmapper::verticalMapper()
+{
+    QFETCH(int, firstBoxSetColumn);
+    QFETCH(int, lastBoxSetColumn);
+    QFETCH(int, expectedBoxSetCount);
+
+    QVBoxPlotModelMapper *mapper = new QVBoxPlotModelMapper;
+    mapper->setFirstBoxSetColumn(firstBoxSetColumn);
+    mapper->setLastBoxSetColumn(lastBoxSetColumn);
+    mapper->setModel(m_model);
+    mapper->setSeries(m_series);
+
+    QCOMPARE(m_series->count(), expectedBoxSetCount);
+    QCOMPARE(mapper->firstBoxSetColumn(), qMax(-1, firstBoxSetColumn));
+    QCOMPARE(mapper->lastBoxSetColumn(), qMax(-1, lastBoxSetColumn));
+    if (expectedBoxSetCount > 0)
+        QCOMPARE(m_series->boxSets().last()->at(QBoxSet::UpperExtreme), 4.0 * lastBoxSetColumn);
+
+    delete mapper;
+}
+
+void tst_qboxplotmodelmapper::horizontalMapper_data()
+{
+    QTest::addColumn<int>("firstBoxSetRow");
+    QTest::addColumn<int>("lastBoxSetRow");
+    QTest::addColumn<int>("expectedBoxSetCount");
+    QTest::newRow("lastBoxSetRow greater than firstBoxSetRow") << 0 << 1 << 2;
+    QTest::newRow("lastBoxSetRow equal to firstBoxSetRow") << 1 << 1 << 1;
+    QTest::newRow("lastBoxSetRow lesser than firstBoxSetRow") << 1 << 0 << 0;
+    QTest::newRow("invalid firstBoxSetRow and correct lastBoxSetRow") << -3 << 1 << 0;
+    QTest::newRow("firstBoxSetRow beyond the size of model and correct lastBoxSetRow") << m_modelRowCount << 1 << 0;
+}
+
+void tst_qboxplotmodelmapper::horizontalMapper()
+{
+    QFETCH(int, firstBoxSetRow);
+    QFETCH(int, lastBoxSetRow);
+    QFETCH(int, expectedBoxSetCount);
+
+    QHBoxPlotModelMapper *mapper = new QHBoxPlotModelMapper;
+    mapper->setFirstBoxSetRow(firstBoxSetRow);
+    mapper->setLastBoxSetRow(lastBoxSetRow);
+    mapper->setModel(m_model);
+    mapper->setSeries(m_series);
+
+    QCOMPARE(m_series->count(), expectedBoxSetCount);
+    QCOMPARE(mapper->firstBoxSetRow(), qMax(-1, firstBoxSetRow));
+    QCOMPARE(mapper->lastBoxSetRow(), qMax(-1, lastBoxSetRow));
+    if (expectedBoxSetCount > 0)
+        QCOMPARE(m_series->boxSets().last()->at(QBoxSet::UpperExtreme), 4.0 * lastBoxSetRow);
+
+    delete mapper;
+}
+
+void tst_qboxplotmodelmapper::modelUpdateCell()
+{
+    QVBoxPlotModelMapper *mapper = new QVBoxPlotModelMapper;
+    mapper->setFirstBoxSetColumn(0);
+    mapper->setLastBoxSetColumn(3);
+    mapper->setModel(m_model);
+    mapper->setSeries(m_series);
+
+    QVERIFY(m_model->setData(m_model->index(1, 2), 44));
+    QCOMPARE(m_series->boxSets().at(2)->at(QBoxSet::LowerQuartile), 44.0);
+    QVERIFY(m_model->setData(m_model->index(1, 2), 2));
+    QCOMPARE(m_series->boxSets().at(2)->at(QBoxSet::LowerQuartile), 2.0);
+
+    delete mapper;
+}
+
+void tst_qboxplotmodelmapper::numericColumnAccess()
+{
+    NumericTableModel *model = new NumericTableModel(8, 6);
+
+    // the values are read from the numeric sections instead of data()
+    QBoxPlotSeries *series = new QBoxPlotSeries;
+    QVBoxPlotModelMapper *vMapper = new QVBoxPlotModelMapper;
+    vMapper->setFirstBoxSetColumn(1);
+    vMapper->setLastBoxSetColumn(3);
+    vMapper->setFirstRow(2);
+    vMapper->setRowCount(5);
+    vMapper->setSeries(series);
+    vMapper->setModel(model);
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(series->count(), 3);
+    QBoxSet *set = series->boxSets().at(0);
+    QCOMPARE(set->at(QBoxSet::LowerExtreme), 13.0);
+    QCOMPARE(set->at(QBoxSet::LowerQuartile), 19.0);
+    QCOMPARE(set->at(QBoxSet::Median), 25.0);
+    QCOMPARE(set->at(QBoxSet::UpperQuartile), 31.0);
+    QCOMPARE(set->at(QBoxSet::UpperExtreme), 37.0);
+    delete vMapper;
+    delete series;
+
+    series = new QBoxPlotSeries;
+    QHBoxPlotModelMapper *hMapper = new QHBoxPlotModelMapper;
+    hMapper->setFirstBoxSetRow(1);
+    hMapper->setLastBoxSetRow(7);
+    hMapper->setFirstColumn(1);
+    hMapper->setSeries(series);
+    hMapper->setModel(model);
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(series->count(), 7);
+    set = series->boxSets().at(2);
+    QCOMPARE(set->at(QBoxSet::LowerExtreme), 19.0);
+    QCOMPARE(set->at(QBoxSet::Median), 21.0);
+    QCOMPARE(set->at(QBoxSet::UpperExtreme), 23.0);
+    delete hMapper;
+    delete series;
+
+    delete model;
+}
+
+QTEST_MAIN(tst_qboxplotmodelmapper)
+
+void tst_qboxplotmodelmapper::backgroundLoading()
+{
+    const int columnCount = 2000;
+    NumericTableModel *model = new NumericTableModel(5, columnCount);
+
+    QBoxPlotSeries *series = new QBoxPlotSeries;
+    QVBoxPlotModelMapper *mapper = new QVBoxPlotModelMapper;
+    mapper->setBackgroundLoading(true);
+    QSignalSpy spy(mapper, SIGNAL(loadingFinished()));
+    mapper->setFirstBoxSetColumn(0);
+    mapper->setLastBoxSetColumn(columnCount - 1);
+    mapper->setSeries(series);
+    mapper->setModel(model);
+    QVERIFY(mapper->isLoading());
+
+    QTRY_COMPARE(spy.count(), 1);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(series->count(), columnCount);
+    QBoxSet *set = series->boxSets().at(columnCount - 1);
+    QCOMPARE(set->at(QBoxSet::LowerExtreme), qreal(columnCount - 1));
+    QCOMPARE(set->at(QBoxSet::UpperExtreme), qreal(5 * columnCount - 1));
+
+    // a data change is applied after the box sets are passed to the series
+    mapper->setFirstBoxSetColumn(0);
+    QVERIFY(mapper->isLoading());
+    model->setData(model->index(0, 0), -1);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(spy.count(), 2);
+    QCOMPARE(series->count(), columnCount);
+    QCOMPARE(series->boxSets().at(0)->at(QBoxSet::LowerExtreme), -1.0);
+
+    delete mapper;
+    delete series;
+    delete model;
+}
+
+#include "tst_qboxplotmodelmapper.moc"
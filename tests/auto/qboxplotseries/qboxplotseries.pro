@@ -0,0 +1,5 @@
+!include( ../auto.pri ) {
+    error( "Couldn't find the auto.pri file!" )
+}
+
+SOURCES += tst_qboxplotseries.cpp
@@ -0,0 +1,254 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCharts/QBoxPlotSeries>
+#include <QtCharts/QBoxSet>
+#include <QtCharts/QChartView>
+#include <QtCharts/QValueAxis>
+#include <QtTest/QtTest>
+#include "tst_definitions.h"
+
+QT_CHARTS_USE_NAMESPACE
+
+Q_DECLARE_METATYPE(QBoxSet *)
+
+class tst_QBoxPlotSeries : public QObject
+{
+    Q_OBJECT
+
+public Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+private Q_SLOTS:
+    void appendColumns();
+    void boxSetsWithColumns();
+    void mouseColumns();
+
+private:
+    QBoxPlotSeries *m_series;
+};
+
+void tst_QBoxPlotSeries::initTestCase()
+{
+    qRegisterMetaType<QBoxSet *>("QBoxSet *");
+}
+
+void tst_QBoxPlotSeries::cleanupTestCase()
+{
+    QTest::qWait(1); // Allow final deleteLaters to run
+}
+
+void tst_QBoxPlotSeries::init()
+{
+    m_series = new QBoxPlotSeries();
+}
+
+void tst_QBoxPlotSeries::cleanup()
+{
+    delete m_series;
+    m_series = 0;
+}
+
+void tst_QBoxPlotSeries::appendColumns()
+{
+    QSignalSpy countSpy(m_series, SIGNAL(countChanged()));
+    QSignalSpy addedSpy(m_series, SIGNAL(boxsetsAdded(QList<QBoxSet *>)));
+
+    QVector<qreal> lowerExtremes;
+    QVector<qreal> lowerQuartiles;
+    QVector<qreal> medians;
+    QVector<qreal> upperQuartiles;
+    QVector<qreal> upperExtremes;
+    for (int i = 0; i < 3; ++i) {
+        lowerExtremes << i + 1.0;
+        lowerQuartiles << i + 2.0;
+        medians << i + 3.0;
+        upperQuartiles << i + 4.0;
+        upperExtremes << i + 5.0;
+    }
+
+    // Columns are appended without creating sets
+    QVERIFY(m_series->append(lowerExtremes, lowerQuartiles, medians, upperQuartiles,
+                             upperExtremes));
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(countSpy.count(), 1);
+    QCOMPARE(addedSpy.count(), 0);
+    QCOMPARE(m_series->findChildren<QBoxSet *>().count(), 0);
+
+    // Empty columns and columns of different lengths are not appended
+    QVERIFY(!m_series->append(QVector<qreal>(), QVector<qreal>(), QVector<qreal>(),
+                              QVector<qreal>(), QVector<qreal>()));
+    QVERIFY(!m_series->append(lowerExtremes, lowerQuartiles, medians, upperQuartiles,
+                              upperExtremes.mid(1)));
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(countSpy.count(), 1);
+
+    QVERIFY(m_series->append(lowerExtremes, lowerQuartiles, medians, upperQuartiles,
+                             upperExtremes));
+    QCOMPARE(m_series->count(), 6);
+    QCOMPARE(countSpy.count(), 2);
+
+    m_series->clear();
+    QCOMPARE(m_series->count(), 0);
+    QCOMPARE(countSpy.count(), 3);
+    QCOMPARE(m_series->boxSets().count(), 0);
+}
+
+void tst_QBoxPlotSeries::boxSetsWithColumns()
+{
+    QBoxSet *set = new QBoxSet(1.0, 2.0, 3.0, 4.0, 5.0);
+    QVERIFY(m_series->append(set));
+    QVector<qreal> values;
+    values << 6.0 << 7.0;
+    QVERIFY(m_series->append(values, values, values, values, values));
+    QCOMPARE(m_series->count(), 3);
+
+    // The first call to boxSets() creates the sets of the rows after the existing sets
+    QList<QBoxSet *> sets = m_series->boxSets();
+    QCOMPARE(sets.count(), 3);
+    QCOMPARE(sets.at(0), set);
+    for (int i = 0; i < values.count(); ++i) {
+        QCOMPARE(sets.at(i + 1)->count(), 5);
+        QCOMPARE(sets.at(i + 1)->at(QBoxSet::LowerExtreme), values.at(i));
+        QCOMPARE(sets.at(i + 1)->at(QBoxSet::Median), values.at(i));
+        QCOMPARE(sets.at(i + 1)->at(QBoxSet::UpperExtreme), values.at(i));
+    }
+    QCOMPARE(m_series->boxSets(), sets);
+    QCOMPARE(m_series->count(), 3);
+
+    // Appending a set after more rows keeps the rows before the set
+    QVERIFY(m_series->append(values, values, values, values, values));
+    QBoxSet *set2 = new QBoxSet(1.0, 2.0, 3.0, 4.0, 5.0);
+    QVERIFY(m_series->append(set2));
+    QCOMPARE(m_series->count(), 6);
+    sets = m_series->boxSets();
+    QCOMPARE(sets.count(), 6);
+    QCOMPARE(sets.at(3)->at(QBoxSet::Median), values.at(0));
+    QCOMPARE(sets.at(4)->at(QBoxSet::Median), values.at(1));
+    QCOMPARE(sets.at(5), set2);
+}
+
+void tst_QBoxPlotSeries::mouseColumns()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    QBoxPlotSeries *series = new QBoxPlotSeries();
+    QBoxSet *set = new QBoxSet(1.0, 2.0, 5.0, 8.0, 9.0);
+    QVERIFY(series->append(set));
+    QVERIFY(series->append(QVector<qreal>(3, 1.0), QVector<qreal>(3, 2.0), QVector<qreal>(3, 5.0),
+                           QVector<qreal>(3, 8.0), QVector<qreal>(3, 9.0)));
+    const int setCount = series->findChildren<QBoxSet *>().count();
+
+    QSignalSpy setClickedSpy(series, SIGNAL(clicked(QBoxSet *)));
+    QSignalSpy clickedSpy(series, SIGNAL(boxClicked(int)));
+    QSignalSpy pressedSpy(series, SIGNAL(boxPressed(int)));
+    QSignalSpy releasedSpy(series, SIGNAL(boxReleased(int)));
+    QSignalSpy doubleClickedSpy(series, SIGNAL(boxDoubleClicked(int)));
+    QSignalSpy hoveredSpy(series, SIGNAL(boxHovered(bool, int)));
+
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->legend()->hide();
+    view.chart()->addSeries(series);
+    QValueAxis *axisX = new QValueAxis();
+    QValueAxis *axisY = new QValueAxis();
+    view.chart()->addAxis(axisX, Qt::AlignBottom);
+    view.chart()->addAxis(axisY, Qt::AlignLeft);
+    series->attachAxis(axisX);
+    series->attachAxis(axisY);
+    axisX->setRange(-0.5, 3.5);
+    axisY->setRange(0, 10);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    // The boxes of rows emit the index based signals without creating sets
+    const QPoint row = view.chart()->mapToPosition(QPointF(2.0, 5.0), series).toPoint();
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, row);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(pressedSpy.count(), 1);
+    QCOMPARE(pressedSpy.takeFirst().at(0).toInt(), 2);
+    QCOMPARE(releasedSpy.count(), 1);
+    QCOMPARE(releasedSpy.takeFirst().at(0).toInt(), 2);
+    QCOMPARE(clickedSpy.count(), 1);
+    QCOMPARE(clickedSpy.takeFirst().at(0).toInt(), 2);
+    QCOMPARE(setClickedSpy.count(), 0);
+    QCOMPARE(series->findChildren<QBoxSet *>().count(), setCount);
+
+    QTest::mouseDClick(view.viewport(), Qt::LeftButton, 0, row);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(doubleClickedSpy.count(), 1);
+    QCOMPARE(doubleClickedSpy.takeFirst().at(0).toInt(), 2);
+    pressedSpy.clear();
+    releasedSpy.clear();
+    clickedSpy.clear();
+
+    // Next to the boxes, no signals are emitted
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0,
+                      view.chart()->mapToPosition(QPointF(2.0, 9.5), series).toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(pressedSpy.count(), 0);
+    QCOMPARE(clickedSpy.count(), 0);
+
+    // Sets emit the index based signals too
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0,
+                      view.chart()->mapToPosition(QPointF(0.0, 5.0), series).toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(setClickedSpy.count(), 1);
+    QCOMPARE(qvariant_cast<QBoxSet *>(setClickedSpy.takeFirst().at(0)), set);
+    QCOMPARE(clickedSpy.count(), 1);
+    QCOMPARE(clickedSpy.takeFirst().at(0).toInt(), 0);
+
+    SKIP_IF_FLAKY_MOUSE_MOVE();
+
+    // This is hack since view does not get events otherwise
+    view.setMouseTracking(true);
+
+    QTest::mouseMove(view.viewport(), row);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    TRY_COMPARE(hoveredSpy.count(), 1);
+    QList<QVariant> hoveredArgs = hoveredSpy.takeFirst();
+    QCOMPARE(hoveredArgs.at(0).toBool(), true);
+    QCOMPARE(hoveredArgs.at(1).toInt(), 2);
+
+    QTest::mouseMove(view.viewport(),
+                     view.chart()->mapToPosition(QPointF(2.0, 9.5), series).toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    TRY_COMPARE(hoveredSpy.count(), 1);
+    hoveredArgs = hoveredSpy.takeFirst();
+    QCOMPARE(hoveredArgs.at(0).toBool(), false);
+    QCOMPARE(hoveredArgs.at(1).toInt(), 2);
+    QCOMPARE(series->findChildren<QBoxSet *>().count(), setCount);
+}
+
+QTEST_MAIN(tst_QBoxPlotSeries)
+
+#include "tst_qboxplotseries.moc"
@@ -0,0 +1,339 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QBoxSet>
+#include <QtCore/QtNumeric>
+#include "tst_definitions.h"
+
+QT_CHARTS_USE_NAMESPACE
+
+Q_DECLARE_METATYPE(QVector<qreal>)
+
+class tst_QBoxSet : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+private slots:
+    void setSamples_data();
+    void setSamples();
+    void setNoSamples();
+    void appendSamples();
+    void samplesReplaceValues();
+    void selectMedian_data();
+    void selectMedian();
+    void appendSamplesIncrementally();
+    void sampleSketch();
+
+private:
+    void compareValues(const QVector<qreal> &expected);
+
+    QBoxSet *m_boxset;
+};
+
+// Calculates the values like the box-and-whiskers example does, from sorted samples
+static qreal findMedian(const QVector<qreal> &sorted, int begin, int end)
+{
+    int count = end - begin;
+    if (count % 2)
+        return sorted.at(count / 2 + begin);
+    return (sorted.at(count / 2 + begin) + sorted.at(count / 2 - 1 + begin)) / 2.0;
+}
+
+static QVector<qreal> exampleValues(QVector<qreal> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    int count = samples.count();
+    QVector<qreal> values;
+    values << samples.first()
+           << findMedian(samples, 0, count / 2)
+           << findMedian(samples, 0, count)
+           << findMedian(samples, count / 2 + (count % 2), count)
+           << samples.last();
+    return values;
+}
+
+void tst_QBoxSet::initTestCase()
+{
+}
+
+void tst_QBoxSet::cleanupTestCase()
+{
+    QTest::qWait(1); // Allow final deleteLaters to run
+}
+
+void tst_QBoxSet::init()
+{
+    m_boxset = new QBoxSet(QString("label"));
+}
+
+void tst_QBoxSet::cleanup()
+{
+    delete m_boxset;
+    m_boxset = 0;
+}
+
+void tst_QBoxSet::compareValues(const QVector<qreal> &expected)
+{
+    QCOMPARE(m_boxset->at(QBoxSet::LowerExtreme), expected.at(0));
+    QCOMPARE(m_boxset->at(QBoxSet::LowerQuartile), expected.at(1));
+    QCOMPARE(m_boxset->at(QBoxSet::Median), expected.at(2));
+    QCOMPARE(m_boxset->at(QBoxSet::UpperQuartile), expected.at(3));
+    QCOMPARE(m_boxset->at(QBoxSet::UpperExtreme), expected.at(4));
+}
+
+void tst_QBoxSet::setSamples_data()
+{
+    QTest::addColumn<QVector<qreal> >("samples");
+    QTest::addColumn<QVector<qreal> >("expected");
+
+    // A single sample is all of the values
+    QTest::newRow("1 sample") << (QVector<qreal>() << 5)
+                              << (QVector<qreal>() << 5 << 5 << 5 << 5 << 5);
+    QTest::newRow("2 samples") << (QVector<qreal>() << 3 << 1)
+                               << (QVector<qreal>() << 1 << 1 << 2 << 3 << 3);
+    QTest::newRow("3 samples") << (QVector<qreal>() << 3 << 1 << 2)
+                               << (QVector<qreal>() << 1 << 1 << 2 << 3 << 3);
+    QTest::newRow("4 samples") << (QVector<qreal>() << 4 << 1 << 3 << 2)
+                               << (QVector<qreal>() << 1 << 1.5 << 2.5 << 3.5 << 4);
+    QTest::newRow("7 samples") << (QVector<qreal>() << 7 << 1 << 5 << 3 << 6 << 2 << 4)
+                               << (QVector<qreal>() << 1 << 2 << 4 << 6 << 7);
+    QTest::newRow("8 samples") << (QVector<qreal>() << 8 << 3 << 1 << 6 << 2 << 7 << 5 << 4)
+                               << (QVector<qreal>() << 1 << 2.5 << 4.5 << 6.5 << 8);
+    QTest::newRow("duplicates") << (QVector<qreal>() << 2 << 2 << 2 << 1 << 3)
+                                << (QVector<qreal>() << 1 << 1.5 << 2 << 2.5 << 3);
+    QTest::newRow("negative") << (QVector<qreal>() << -1 << -5 << 0 << -3)
+                              << (QVector<qreal>() << -5 << -4 << -2 << -0.5 << 0);
+    QTest::newRow("invalid") << (QVector<qreal>() << 1 << qQNaN() << 3 << qInf())
+                             << (QVector<qreal>() << 1 << 1 << 2 << 3 << 3);
+}
+
+void tst_QBoxSet::setSamples()
+{
+    QFETCH(QVector<qreal>, samples);
+    QFETCH(QVector<qreal>, expected);
+
+    QSignalSpy valuesSpy(m_boxset, SIGNAL(valuesChanged()));
+    m_boxset->setSamples(samples);
+    QCOMPARE(valuesSpy.count(), 1);
+    QCOMPARE(m_boxset->count(), 5);
+    compareValues(expected);
+
+    int validCount = 0;
+    foreach (qreal sample, samples) {
+        if (qIsFinite(sample))
+            validCount++;
+    }
+    QCOMPARE(m_boxset->sampleCount(), validCount);
+}
+
+void tst_QBoxSet::setNoSamples()
+{
+    QSignalSpy valuesSpy(m_boxset, SIGNAL(valuesChanged()));
+    QSignalSpy clearedSpy(m_boxset, SIGNAL(cleared()));
+
+    // Nothing to clear
+    m_boxset->setSamples(QVector<qreal>());
+    QCOMPARE(clearedSpy.count(), 0);
+    QCOMPARE(valuesSpy.count(), 0);
+    QCOMPARE(m_boxset->sampleCount(), 0);
+
+    // Zero samples clear the values
+    m_boxset->setSamples(QVector<qreal>() << 1 << 2 << 3);
+    QCOMPARE(valuesSpy.count(), 1);
+    m_boxset->setSamples(QVector<qreal>());
+    QCOMPARE(clearedSpy.count(), 1);
+    QCOMPARE(m_boxset->sampleCount(), 0);
+    compareValues(QVector<qreal>() << 0 << 0 << 0 << 0 << 0);
+
+    // Only invalid samples are no samples either
+    m_boxset->setSamples(QVector<qreal>() << 1 << 2 << 3);
+    m_boxset->setSamples(QVector<qreal>() << qQNaN());
+    QCOMPARE(clearedSpy.count(), 2);
+    QCOMPARE(m_boxset->sampleCount(), 0);
+
+    // clear() removes the samples
+    m_boxset->setSamples(QVector<qreal>() << 1 << 2 << 3);
+    m_boxset->clear();
+    QCOMPARE(m_boxset->sampleCount(), 0);
+    m_boxset->appendSamples(QVector<qreal>() << 10);
+    compareValues(QVector<qreal>() << 10 << 10 << 10 << 10 << 10);
+}
+
+void tst_QBoxSet::appendSamples()
+{
+    QSignalSpy valuesSpy(m_boxset, SIGNAL(valuesChanged()));
+
+    m_boxset->appendSamples(QVector<qreal>() << 3 << 1 << 2);
+    QCOMPARE(valuesSpy.count(), 1);
+    QCOMPARE(m_boxset->sampleCount(), 3);
+    compareValues(QVector<qreal>() << 1 << 1 << 2 << 3 << 3);
+
+    // Values are recalculated from all samples
+    m_boxset->appendSamples(QVector<qreal>() << 8 << 6 << 7 << 5 << 4);
+    QCOMPARE(valuesSpy.count(), 2);
+    QCOMPARE(m_boxset->sampleCount(), 8);
+    compareValues(QVector<qreal>() << 1 << 2.5 << 4.5 << 6.5 << 8);
+
+    // Appending nothing valid changes nothing
+    m_boxset->appendSamples(QVector<qreal>());
+    m_boxset->appendSamples(QVector<qreal>() << qQNaN());
+    QCOMPARE(valuesSpy.count(), 2);
+    QCOMPARE(m_boxset->sampleCount(), 8);
+
+    // A single sample below all others moves the lower values only
+    m_boxset->appendSamples(QVector<qreal>() << 0);
+    QCOMPARE(m_boxset->sampleCount(), 9);
+    compareValues(QVector<qreal>() << 0 << 1.5 << 4 << 6.5 << 8);
+}
+
+void tst_QBoxSet::samplesReplaceValues()
+{
+    m_boxset->setSamples(QVector<qreal>() << 1 << 2 << 3);
+    m_boxset->setValue(QBoxSet::Median, 10);
+    QCOMPARE(m_boxset->at(QBoxSet::Median), 10.0);
+
+    // The samples are kept, and the values recalculated the next time they change
+    m_boxset->appendSamples(QVector<qreal>() << 4);
+    QCOMPARE(m_boxset->sampleCount(), 4);
+    compareValues(QVector<qreal>() << 1 << 1.5 << 2.5 << 3.5 << 4);
+}
+
+void tst_QBoxSet::selectMedian_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<int>("appendCount");
+
+    QTest::newRow("2") << 2 << 0;
+    QTest::newRow("5") << 5 << 0;
+    QTest::newRow("10") << 10 << 0;
+    QTest::newRow("101") << 101 << 0;
+    QTest::newRow("1000") << 1000 << 0;
+    QTest::newRow("1000 + 1") << 1000 << 1;
+    QTest::newRow("1001 + 10") << 1001 << 10;
+    QTest::newRow("1 + 1000") << 1 << 1000;
+}
+
+void tst_QBoxSet::selectMedian()
+{
+    QFETCH(int, count);
+    QFETCH(int, appendCount);
+
+    // The selection based values match the sorting based ones of the example, also when the
+    // samples are partially ordered by an earlier selection
+    qsrand(count * 1000 + appendCount);
+    QVector<qreal> samples;
+    for (int i = 0; i < count; i++)
+        samples << qrand() % 100;
+    QVector<qreal> appended;
+    for (int i = 0; i < appendCount; i++)
+        appended << qrand() % 100;
+
+    m_boxset->setSamples(samples);
+    if (count > 1)
+        compareValues(exampleValues(samples));
+    m_boxset->appendSamples(appended);
+    if (count + appendCount > 1)
+        compareValues(exampleValues(samples + appended));
+}
+
+void tst_QBoxSet::appendSamplesIncrementally()
+{
+    // Many small appends only partition the samples near the values again, which still gives
+    // the values of all samples, also with many equal samples
+    qsrand(37);
+    QVector<qreal> samples;
+    for (int i = 0; i < 5000; i++)
+        samples << qrand() % 50;
+    m_boxset->setSamples(samples);
+    compareValues(exampleValues(samples));
+
+    for (int i = 0; i < 300; i++) {
+        QVector<qreal> appended;
+        for (int j = qrand() % 3; j >= 0; j--)
+            appended << (i < 150 ? qrand() % 50 : 40 + qrand() % 20);
+        samples += appended;
+        m_boxset->appendSamples(appended);
+        compareValues(exampleValues(samples));
+    }
+    QCOMPARE(m_boxset->sampleCount(), samples.count());
+}
+
+void tst_QBoxSet::sampleSketch()
+{
+    QCOMPARE(m_boxset->sampleSketchThreshold(), 0);
+    m_boxset->setSampleSketchThreshold(3);
+    QCOMPARE(m_boxset->sampleSketchThreshold(), 5);
+    m_boxset->setSampleSketchThreshold(1000);
+
+    // Above the threshold the extremes stay exact and the other values become estimates
+    qsrand(41);
+    QVector<qreal> samples;
+    for (int i = 0; i < 100; i++) {
+        QVector<qreal> appended;
+        for (int j = 0; j < 200; j++)
+            appended << (qrand() % 100000) / 1000.0;
+        samples += appended;
+        m_boxset->appendSamples(appended);
+    }
+    QCOMPARE(m_boxset->sampleCount(), samples.count());
+    QVector<qreal> expected = exampleValues(samples);
+    QCOMPARE(m_boxset->at(QBoxSet::LowerExtreme), expected.at(0));
+    QCOMPARE(m_boxset->at(QBoxSet::UpperExtreme), expected.at(4));
+    for (int i = QBoxSet::LowerQuartile; i <= QBoxSet::UpperQuartile; i++)
+        QVERIFY(qAbs(m_boxset->at(i) - expected.at(i)) < 1.0);
+
+    // New samples below the threshold are kept again
+    samples = QVector<qreal>() << 4 << 1 << 3 << 2 << 6 << 5;
+    m_boxset->setSamples(samples);
+    QCOMPARE(m_boxset->sampleCount(), 6);
+    compareValues(exampleValues(samples));
+
+    // Lowering the threshold below the sample count switches to the estimates right away,
+    // starting from the values of the samples
+    QSignalSpy valuesSpy(m_boxset, SIGNAL(valuesChanged()));
+    m_boxset->setSampleSketchThreshold(5);
+    QCOMPARE(valuesSpy.count(), 1);
+    compareValues(exampleValues(samples));
+    m_boxset->appendSamples(QVector<qreal>() << 0 << 10);
+    QCOMPARE(valuesSpy.count(), 2);
+    QCOMPARE(m_boxset->sampleCount(), 8);
+    QCOMPARE(m_boxset->at(QBoxSet::LowerExtreme), 0.0);
+    QCOMPARE(m_boxset->at(QBoxSet::UpperExtreme), 10.0);
+}
+
+QTEST_MAIN(tst_QBoxSet)
+
+#include "tst_qboxset.moc"
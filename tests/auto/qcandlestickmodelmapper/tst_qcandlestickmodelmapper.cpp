@@ -35,6 +35,7 @@
 #include <QtCore/QString>
 #include <QtGui/QStandardItemModel>
 #include <QtTest/QtTest>
+#include "numerictablemodel.h"
 
 QT_CHARTS_USE_NAMESPACE
 
@@ -73,6 +74,8 @@ private Q_SLOTS:
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void numericColumnAccess();
+    void backgroundLoading();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -554,6 +557,100 @@ void tst_qcandlestickmodelmapper::modelUpdateCell()
     QCOMPARE(m_series->sets().at(index.row())->timestamp(), newValue);
 }
 
+void tst_qcandlestickmodelmapper::numericColumnAccess()
+{
+    NumericTableModel *model = new NumericTableModel(6, 6);
+
+    // the values are read from the numeric sections instead of data()
+    QCandlestickSeries *series = new QCandlestickSeries();
+    QVCandlestickModelMapper *vMapper = new QVCandlestickModelMapper();
+    vMapper->setTimestampRow(0);
+    vMapper->setOpenRow(1);
+    vMapper->setHighRow(2);
+    vMapper->setLowRow(3);
+    vMapper->setCloseRow(4);
+    vMapper->setFirstSetColumn(1);
+    vMapper->setLastSetColumn(3);
+    vMapper->setSeries(series);
+    vMapper->setModel(model);
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(series->count(), 3);
+    QCandlestickSet *set = series->sets().at(1);
+    QCOMPARE(set->timestamp(), 2.0);
+    QCOMPARE(set->open(), 8.0);
+    QCOMPARE(set->high(), 14.0);
+    QCOMPARE(set->low(), 20.0);
+    QCOMPARE(set->close(), 26.0);
+    delete vMapper;
+    delete series;
+
+    series = new QCandlestickSeries();
+    QHCandlestickModelMapper *hMapper = new QHCandlestickModelMapper();
+    hMapper->setTimestampColumn(0);
+    hMapper->setOpenColumn(1);
+    hMapper->setHighColumn(2);
+    hMapper->setLowColumn(3);
+    hMapper->setCloseColumn(4);
+    hMapper->setFirstSetRow(1);
+    hMapper->setLastSetRow(3);
+    hMapper->setSeries(series);
+    hMapper->setModel(model);
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(series->count(), 3);
+    set = series->sets().at(1);
+    QCOMPARE(set->timestamp(), 12.0);
+    QCOMPARE(set->open(), 13.0);
+    QCOMPARE(set->high(), 14.0);
+    QCOMPARE(set->low(), 15.0);
+    QCOMPARE(set->close(), 16.0);
+    delete hMapper;
+    delete series;
+
+    delete model;
+}
+
+void tst_qcandlestickmodelmapper::backgroundLoading()
+{
+    const int rowCount = 2100;
+    NumericTableModel *model = new NumericTableModel(rowCount, 5);
+
+    QCandlestickSeries *series = new QCandlestickSeries();
+    QHCandlestickModelMapper *mapper = new QHCandlestickModelMapper();
+    mapper->setBackgroundLoading(true);
+    QSignalSpy spy(mapper, SIGNAL(loadingFinished()));
+    mapper->setTimestampColumn(0);
+    mapper->setOpenColumn(1);
+    mapper->setHighColumn(2);
+    mapper->setLowColumn(3);
+    mapper->setCloseColumn(4);
+    mapper->setFirstSetRow(0);
+    mapper->setLastSetRow(rowCount - 1);
+    mapper->setSeries(series);
+    mapper->setModel(model);
+    QVERIFY(mapper->isLoading());
+
+    QTRY_COMPARE(spy.count(), 1);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(series->count(), rowCount);
+    QCandlestickSet *set = series->sets().at(rowCount - 1);
+    QCOMPARE(set->timestamp(), qreal(5 * (rowCount - 1)));
+    QCOMPARE(set->close(), qreal(5 * rowCount - 1));
+
+    // a change to the series is written to the model and the loading restarts
+    mapper->setLastSetRow(rowCount - 2);
+    QVERIFY(mapper->isLoading());
+    series->sets().at(0)->setOpen(-3.0);
+    QVERIFY(mapper->isLoading());
+    QTRY_COMPARE(spy.count(), 2);
+    QCOMPARE(series->count(), rowCount - 1);
+    QCOMPARE(series->sets().at(0)->open(), -3.0);
+
+    delete mapper;
+    delete series;
+    delete model;
+}
+
 void tst_qcandlestickmodelmapper::verticalMapperSignals()
 {
     QVCandlestickModelMapper *mapper = new QVCandlestickModelMapper();
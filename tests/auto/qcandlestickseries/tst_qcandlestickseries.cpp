@@ -30,6 +30,9 @@
 #include <QtCharts/QCandlestickSeries>
 #include <QtCharts/QCandlestickSet>
 #include <QtCharts/QChartView>
+#include <QtCharts/QHCandlestickModelMapper>
+#include <QtCharts/QValueAxis>
+#include <QtGui/QStandardItemModel>
 #include <QtTest/QtTest>
 #include "tst_definitions.h"
 
@@ -59,6 +62,9 @@ private Q_SLOTS:
     void clear();
     void sets();
     void count();
+    void appendColumns();
+    void countAndSetsWithColumns();
+    void appendColumnsWithMapper();
     void type();
     void maximumColumnWidth_data();
     void maximumColumnWidth();
@@ -79,6 +85,9 @@ private Q_SLOTS:
     void mousePressed();
     void mouseReleased();
     void mouseDoubleClicked();
+    void mouseColumns();
+    void bucketedCandlesticks();
+    void timestampGaps();
 
 private:
     QCandlestickSeries *m_series;
@@ -332,6 +341,124 @@ void tst_QCandlestickSeries::count()
     QCOMPARE(m_series->count(), m_series->sets().count());
 }
 
+void tst_QCandlestickSeries::appendColumns()
+{
+    QSignalSpy countSpy(m_series, SIGNAL(countChanged()));
+    QSignalSpy addedSpy(m_series, SIGNAL(candlestickSetsAdded(QList<QCandlestickSet *>)));
+
+    QVector<qreal> timestamps;
+    QVector<qreal> opens;
+    QVector<qreal> highs;
+    QVector<qreal> lows;
+    QVector<qreal> closes;
+    for (int i = 0; i < 3; ++i) {
+        timestamps << i * 10.0;
+        opens << i + 2.0;
+        highs << i + 4.0;
+        lows << i + 1.0;
+        closes << i + 3.0;
+    }
+
+    // Columns are appended without creating sets
+    QVERIFY(m_series->append(timestamps, opens, highs, lows, closes));
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(countSpy.count(), 1);
+    QCOMPARE(addedSpy.count(), 0);
+    QCOMPARE(m_series->findChildren<QCandlestickSet *>().count(), 0);
+
+    // Empty columns and columns of different lengths are not appended
+    QVERIFY(!m_series->append(QVector<qreal>(), QVector<qreal>(), QVector<qreal>(),
+                              QVector<qreal>(), QVector<qreal>()));
+    QVERIFY(!m_series->append(timestamps, opens, highs, lows, closes.mid(1)));
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(countSpy.count(), 1);
+
+    QVERIFY(m_series->append(timestamps, opens, highs, lows, closes));
+    QCOMPARE(m_series->count(), 6);
+    QCOMPARE(countSpy.count(), 2);
+
+    m_series->clear();
+    QCOMPARE(m_series->count(), 0);
+    QCOMPARE(m_series->sets().count(), 0);
+}
+
+void tst_QCandlestickSeries::countAndSetsWithColumns()
+{
+    QVERIFY(m_series->append(m_sets.at(0)));
+    QVector<qreal> timestamps;
+    timestamps << 1.0 << 2.0;
+    QVector<qreal> values;
+    values << 5.0 << 6.0;
+    QVERIFY(m_series->append(timestamps, values, values, values, values));
+    QCOMPARE(m_series->count(), 3);
+
+    // The first call to sets() creates the sets of the rows after the existing sets
+    QList<QCandlestickSet *> sets = m_series->sets();
+    QCOMPARE(sets.count(), 3);
+    QCOMPARE(sets.at(0), m_sets.at(0));
+    for (int i = 0; i < timestamps.count(); ++i) {
+        QCandlestickSet *set = sets.at(i + 1);
+        QCOMPARE(set->timestamp(), timestamps.at(i));
+        QCOMPARE(set->open(), values.at(i));
+        QCOMPARE(set->high(), values.at(i));
+        QCOMPARE(set->low(), values.at(i));
+        QCOMPARE(set->close(), values.at(i));
+    }
+    QCOMPARE(m_series->sets(), sets);
+    QCOMPARE(m_series->count(), 3);
+
+    // Appending a set after more rows keeps the rows before the set
+    QVERIFY(m_series->append(timestamps, values, values, values, values));
+    QVERIFY(m_series->append(m_sets.at(1)));
+    QCOMPARE(m_series->count(), 6);
+    sets = m_series->sets();
+    QCOMPARE(sets.count(), 6);
+    QCOMPARE(sets.at(3)->timestamp(), timestamps.at(0));
+    QCOMPARE(sets.at(4)->timestamp(), timestamps.at(1));
+    QCOMPARE(sets.at(5), m_sets.at(1));
+}
+
+void tst_QCandlestickSeries::appendColumnsWithMapper()
+{
+    QStandardItemModel *model = new QStandardItemModel(2, 5, this);
+    for (int row = 0; row < 2; ++row) {
+        for (int column = 0; column < 5; ++column)
+            model->setData(model->index(row, column), row * 10 + column);
+    }
+
+    QHCandlestickModelMapper *mapper = new QHCandlestickModelMapper(this);
+    mapper->setTimestampColumn(0);
+    mapper->setOpenColumn(1);
+    mapper->setHighColumn(2);
+    mapper->setLowColumn(3);
+    mapper->setCloseColumn(4);
+    mapper->setFirstSetRow(0);
+    mapper->setLastSetRow(1);
+    mapper->setModel(model);
+    mapper->setSeries(m_series);
+    QCOMPARE(m_series->count(), 2);
+
+    QVector<qreal> timestamps;
+    timestamps << 100.0 << 110.0 << 120.0;
+    QVector<qreal> values;
+    values << 1.0 << 2.0 << 3.0;
+    QVERIFY(m_series->append(timestamps, values, values, values, values));
+    QCOMPARE(m_series->count(), 5);
+
+    // Model changes update the mapped sets without creating sets for the rows
+    QVERIFY(model->setData(model->index(1, 1), 42.0));
+    QCOMPARE(m_series->findChildren<QCandlestickSet *>().count(), 0);
+    QCOMPARE(m_series->count(), 5);
+    QCOMPARE(m_series->sets().at(1)->open(), 42.0);
+
+    // Changing a mapped set updates the model
+    m_series->sets().at(0)->setClose(24.0);
+    QCOMPARE(model->data(model->index(0, 4)).toReal(), 24.0);
+
+    delete mapper;
+    delete model;
+}
+
 void tst_QCandlestickSeries::type()
 {
     QCOMPARE(m_series->type(), QAbstractSeries::SeriesTypeCandlestick);
@@ -932,6 +1059,245 @@ void tst_QCandlestickSeries::mouseDoubleClicked()
     QVERIFY(setSpy1.takeFirst().isEmpty());
 }
 
+// Counts the pixels in rect that have the given color
+static int colorPixels(const QImage &image, const QRect &rect, const QColor &color)
+{
+    int count = 0;
+    const QRect area = rect.intersected(image.rect());
+    for (int y = area.top(); y <= area.bottom(); ++y) {
+        for (int x = area.left(); x <= area.right(); ++x) {
+            if (QColor(image.pixel(x, y)) == color)
+                ++count;
+        }
+    }
+    return count;
+}
+
+void tst_QCandlestickSeries::mouseColumns()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    QCandlestickSeries *series = new QCandlestickSeries();
+    QCandlestickSet *set = new QCandlestickSet(2.0, 9.0, 1.0, 8.0, 0.0);
+    QVERIFY(series->append(set));
+    QVector<qreal> timestamps;
+    timestamps << 1.0 << 2.0 << 3.0;
+    QVERIFY(series->append(timestamps, QVector<qreal>(3, 2.0), QVector<qreal>(3, 9.0),
+                           QVector<qreal>(3, 1.0), QVector<qreal>(3, 8.0)));
+    const int setCount = series->findChildren<QCandlestickSet *>().count();
+
+    QSignalSpy setClickedSpy(series, SIGNAL(clicked(QCandlestickSet *)));
+    QSignalSpy clickedSpy(series, SIGNAL(candlestickClicked(int)));
+    QSignalSpy pressedSpy(series, SIGNAL(candlestickPressed(int)));
+    QSignalSpy releasedSpy(series, SIGNAL(candlestickReleased(int)));
+    QSignalSpy doubleClickedSpy(series, SIGNAL(candlestickDoubleClicked(int)));
+    QSignalSpy hoveredSpy(series, SIGNAL(candlestickHovered(bool, int)));
+
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->legend()->hide();
+    view.chart()->addSeries(series);
+    QValueAxis *axisX = new QValueAxis();
+    QValueAxis *axisY = new QValueAxis();
+    view.chart()->addAxis(axisX, Qt::AlignBottom);
+    view.chart()->addAxis(axisY, Qt::AlignLeft);
+    series->attachAxis(axisX);
+    series->attachAxis(axisY);
+    axisX->setRange(-0.5, 3.5);
+    axisY->setRange(0, 10);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    // The candlesticks of rows emit the index based signals without creating sets
+    const QPoint row = view.chart()->mapToPosition(QPointF(2.0, 5.0), series).toPoint();
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, row);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(pressedSpy.count(), 1);
+    QCOMPARE(pressedSpy.takeFirst().at(0).toInt(), 2);
+    QCOMPARE(releasedSpy.count(), 1);
+    QCOMPARE(releasedSpy.takeFirst().at(0).toInt(), 2);
+    QCOMPARE(clickedSpy.count(), 1);
+    QCOMPARE(clickedSpy.takeFirst().at(0).toInt(), 2);
+    QCOMPARE(setClickedSpy.count(), 0);
+    QCOMPARE(series->findChildren<QCandlestickSet *>().count(), setCount);
+
+    QTest::mouseDClick(view.viewport(), Qt::LeftButton, 0, row);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(doubleClickedSpy.count(), 1);
+    QCOMPARE(doubleClickedSpy.takeFirst().at(0).toInt(), 2);
+    pressedSpy.clear();
+    releasedSpy.clear();
+    clickedSpy.clear();
+
+    // Next to the candlesticks, no signals are emitted
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0,
+                      view.chart()->mapToPosition(QPointF(2.0, 9.5), series).toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(pressedSpy.count(), 0);
+    QCOMPARE(clickedSpy.count(), 0);
+
+    // Sets emit the index based signals too
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0,
+                      view.chart()->mapToPosition(QPointF(0.0, 5.0), series).toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(setClickedSpy.count(), 1);
+    QCOMPARE(qvariant_cast<QCandlestickSet *>(setClickedSpy.takeFirst().at(0)), set);
+    QCOMPARE(clickedSpy.count(), 1);
+    QCOMPARE(clickedSpy.takeFirst().at(0).toInt(), 0);
+
+    SKIP_IF_FLAKY_MOUSE_MOVE();
+
+    // This is hack since view does not get events otherwise
+    view.setMouseTracking(true);
+
+    QTest::mouseMove(view.viewport(), row);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    TRY_COMPARE(hoveredSpy.count(), 1);
+    QList<QVariant> hoveredArgs = hoveredSpy.takeFirst();
+    QCOMPARE(hoveredArgs.at(0).toBool(), true);
+    QCOMPARE(hoveredArgs.at(1).toInt(), 2);
+
+    QTest::mouseMove(view.viewport(),
+                     view.chart()->mapToPosition(QPointF(2.0, 9.5), series).toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    TRY_COMPARE(hoveredSpy.count(), 1);
+    hoveredArgs = hoveredSpy.takeFirst();
+    QCOMPARE(hoveredArgs.at(0).toBool(), false);
+    QCOMPARE(hoveredArgs.at(1).toInt(), 2);
+    QCOMPARE(series->findChildren<QCandlestickSet *>().count(), setCount);
+}
+
+void tst_QCandlestickSeries::bucketedCandlesticks()
+{
+    // Many more candlesticks than pixels, so the candlesticks of each pixel are merged into one
+    const int count = 2000;
+    const int spike = 1000;
+
+    QCandlestickSeries *series = new QCandlestickSeries();
+    series->setPen(QPen(Qt::red));
+    series->setIncreasingColor(Qt::blue);
+    series->setDecreasingColor(Qt::blue);
+    QList<QCandlestickSet *> sets;
+    for (int i = 0; i < count; ++i)
+        sets.append(new QCandlestickSet(2.0, i == spike ? 9.0 : 4.0, 1.0, 3.0, i));
+    QVERIFY(series->append(sets));
+
+    QSignalSpy seriesSpy(series, SIGNAL(clicked(QCandlestickSet *)));
+
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->legend()->hide();
+    view.chart()->addSeries(series);
+    QValueAxis *axisX = new QValueAxis();
+    QValueAxis *axisY = new QValueAxis();
+    axisX->setGridLineVisible(false);
+    axisY->setGridLineVisible(false);
+    view.chart()->addAxis(axisX, Qt::AlignBottom);
+    view.chart()->addAxis(axisY, Qt::AlignLeft);
+    series->attachAxis(axisX);
+    series->attachAxis(axisY);
+    axisX->setRange(0, count - 1);
+    axisY->setRange(0, 10);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+    QVERIFY(view.chart()->plotArea().width() < count);
+
+    // The merged candlestick of the spike keeps its high, the others end at the common high
+    QImage image = view.grab().toImage();
+    const QPoint spikeHigh = view.chart()->mapToPosition(QPointF(spike, 7.0), series).toPoint();
+    const QPoint otherHigh = view.chart()->mapToPosition(QPointF(spike / 2, 7.0), series).toPoint();
+    const QPoint otherBody = view.chart()->mapToPosition(QPointF(spike / 2, 2.5), series).toPoint();
+    QVERIFY(colorPixels(image, QRect(spikeHigh - QPoint(3, 0), QSize(7, 1)), Qt::red) > 0);
+    QCOMPARE(colorPixels(image, QRect(otherHigh - QPoint(3, 0), QSize(7, 1)), Qt::red), 0);
+    QVERIFY(colorPixels(image, QRect(otherBody - QPoint(3, 0), QSize(7, 1)), Qt::blue) > 0);
+
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // Merged candlesticks don't emit the mouse signals of the sets
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, otherBody);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 0);
+
+    // Zooming in far enough shows the candlesticks of the sets again
+    axisX->setRange(spike - 10, spike + 10);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    const QPoint spikeBody = view.chart()->mapToPosition(QPointF(spike, 2.5), series).toPoint();
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, spikeBody);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 1);
+    QCOMPARE(qvariant_cast<QCandlestickSet *>(seriesSpy.takeFirst().at(0)), sets.at(spike));
+}
+
+void tst_QCandlestickSeries::timestampGaps()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    QCandlestickSeries *series = new QCandlestickSeries();
+    series->setBodyWidth(1.0);
+    series->setMaximumColumnWidth(-1.0);
+    QList<qreal> timestamps;
+    timestamps << 0 << 1 << 2 << 10 << 11;
+    QMap<qreal, QCandlestickSet *> sets;
+    foreach (qreal timestamp, timestamps) {
+        QCandlestickSet *set = new QCandlestickSet(4.0, 4.0, 1.0, 1.0, timestamp);
+        sets.insert(timestamp, set);
+        QVERIFY(series->append(set));
+    }
+
+    QSignalSpy seriesSpy(series, SIGNAL(clicked(QCandlestickSet *)));
+
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->addSeries(series);
+    QValueAxis *axisX = new QValueAxis();
+    QValueAxis *axisY = new QValueAxis();
+    view.chart()->addAxis(axisX, Qt::AlignBottom);
+    view.chart()->addAxis(axisY, Qt::AlignLeft);
+    series->attachAxis(axisX);
+    series->attachAxis(axisY);
+    axisX->setRange(-1, 12);
+    axisY->setRange(0, 5);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    // Each candlestick is found at its own timestamp, and is as wide as the smallest gap
+    foreach (qreal timestamp, timestamps) {
+        QPoint point = view.chart()->mapToPosition(QPointF(timestamp, 2.5), series).toPoint();
+        QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, point);
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+        QCOMPARE(seriesSpy.count(), 1);
+        QCOMPARE(qvariant_cast<QCandlestickSet *>(seriesSpy.takeFirst().at(0)),
+                 sets.value(timestamp));
+    }
+    const QPoint point = view.chart()->mapToPosition(QPointF(10.8, 2.5), series).toPoint();
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, point);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 1);
+    QCOMPARE(qvariant_cast<QCandlestickSet *>(seriesSpy.takeFirst().at(0)), sets.value(11));
+
+    // Removing the candlesticks at 1 and 11 leaves gaps of 2 and 8, so the candlestick at 10
+    // gets twice as wide and reaches the same point
+    QVERIFY(series->remove(sets.take(1)));
+    QVERIFY(series->remove(sets.take(11)));
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, point);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 1);
+    QCOMPARE(qvariant_cast<QCandlestickSet *>(seriesSpy.takeFirst().at(0)), sets.value(10));
+
+    // Moving a candlestick into the gap updates the gaps again
+    sets.value(2)->setTimestamp(9);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, point);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 0);
+    const QPoint moved = view.chart()->mapToPosition(QPointF(9, 2.5), series).toPoint();
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, moved);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 1);
+    QCOMPARE(qvariant_cast<QCandlestickSet *>(seriesSpy.takeFirst().at(0)), sets.value(2));
+}
+
 QTEST_MAIN(tst_QCandlestickSeries)
 
 #include "tst_qcandlestickseries.moc"
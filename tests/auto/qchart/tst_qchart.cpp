@@ -40,6 +40,8 @@
 #include <QtCharts/QStackedBarSeries>
 #include <QtCharts/QValueAxis>
 #include <QtCharts/QBarCategoryAxis>
+#include <QtCharts/QLegendMarker>
+#include <private/chartpresenter_p.h>
 #include "tst_definitions.h"
 
 QT_CHARTS_USE_NAMESPACE
@@ -122,6 +124,11 @@ private slots:
     void createDefaultAxesForLineSeries();
     void axisPolarOrientation();
     void backgroundRoundness();
+    void beginEndUpdate();
+    void beginEndUpdateExistingSeries();
+    void deferredAxisLayout_data();
+    void deferredAxisLayout();
+    void interactivePreview();
 private:
     void createTestData();
 
@@ -1088,6 +1095,237 @@ void tst_QChart::backgroundRoundness()
     QVERIFY(m_chart->backgroundRoundness() == 100.0);
 }
 
+void tst_QChart::beginEndUpdate()
+{
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    QValueAxis *axisX = new QValueAxis();
+    QValueAxis *axisY = new QValueAxis();
+    axisY->setAutoRange(true);
+
+    m_chart->beginUpdate();
+    m_chart->addAxis(axisX, Qt::AlignBottom);
+    m_chart->addAxis(axisY, Qt::AlignLeft);
+    QList<QLineSeries *> series;
+    for (int i = 0; i < 10; i++) {
+        QLineSeries *line = new QLineSeries();
+        line->append(0, i);
+        line->append(1, i + 1);
+        m_chart->addSeries(line);
+        line->attachAxis(axisX);
+        line->attachAxis(axisY);
+        series << line;
+    }
+
+    // nested updates end with the outermost one
+    m_chart->beginUpdate();
+    QLineSeries *removed = series.takeLast();
+    m_chart->removeSeries(removed);
+    delete removed;
+    m_chart->endUpdate();
+
+    QCOMPARE(m_chart->series().count(), 9);
+    QCOMPARE(series.first()->chart(), m_chart);
+    QCOMPARE(series.first()->attachedAxes().count(), 2);
+    QVERIFY(m_chart->legend()->markers().isEmpty());
+
+    m_chart->endUpdate();
+    QCOMPARE(m_chart->legend()->markers().count(), 9);
+    QCOMPARE(axisY->min(), -0.9);
+    QCOMPARE(axisY->max(), 9.9);
+    QCOMPARE(m_chart->axes().count(), 2);
+
+    // unbalanced end is ignored
+    m_chart->endUpdate();
+    QLineSeries *line = new QLineSeries();
+    m_chart->addSeries(line);
+    QCOMPARE(m_chart->legend()->markers().count(), 10);
+}
+
+void tst_QChart::beginEndUpdateExistingSeries()
+{
+    SKIP_ON_POLAR();
+
+    m_chart->setTheme(QChart::ChartThemeLight);
+    QLineSeries *line = new QLineSeries();
+    line->append(0, 2);
+    line->append(1, 4);
+    QPieSeries *pie = new QPieSeries();
+    QPieSlice *removed = pie->append("a", 1);
+    pie->append("b", 2);
+    m_chart->addSeries(line);
+    m_chart->addSeries(pie);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+    QApplication::processEvents();
+    QCOMPARE(m_chart->legend()->markers(pie).count(), 2);
+
+    ChartPresenter *presenter = ChartPresenter::get(m_chart);
+    presenter->resetLayoutCounters();
+    const QBrush background = m_chart->backgroundBrush();
+    const QPointF center = m_chart->plotArea().center();
+    const QPointF value = m_chart->mapToValue(center, line);
+
+    QValueAxis *axisX = new QValueAxis();
+    QValueAxis *axisY = new QValueAxis();
+    axisY->setAutoRange(true);
+
+    m_chart->beginUpdate();
+    m_chart->addAxis(axisX, Qt::AlignBottom);
+    m_chart->addAxis(axisY, Qt::AlignLeft);
+    line->attachAxis(axisX);
+    line->attachAxis(axisY);
+    pie->remove(removed);
+    pie->append("c", 3);
+    pie->append("d", 4);
+    m_chart->setTheme(QChart::ChartThemeDark);
+    m_chart->setTitle("title");
+    QApplication::processEvents();
+
+    // The shown series keep their domain, markers, theme and layout until the update ends
+    QCOMPARE(line->attachedAxes().count(), 2);
+    QCOMPARE(m_chart->mapToValue(center, line), value);
+    QCOMPARE(m_chart->legend()->markers(pie).count(), 1);
+    QCOMPARE(m_chart->theme(), QChart::ChartThemeDark);
+    QCOMPARE(m_chart->backgroundBrush(), background);
+    QVERIFY(presenter->layoutRequestCount() > 0);
+    QCOMPARE(presenter->layoutPassCount(), 0);
+
+    m_chart->endUpdate();
+    QCOMPARE(m_chart->legend()->markers(pie).count(), 3);
+    QVERIFY(m_chart->backgroundBrush() != background);
+    QVERIFY(axisY->min() < 2.0);
+    QVERIFY(axisY->max() > 4.0);
+
+    // The requests made during the update are served by the passes after it
+    QApplication::processEvents();
+    QVERIFY(presenter->layoutPassCount() > 0);
+    QVERIFY(presenter->savedLayoutPassCount() > 0);
+}
+
+void tst_QChart::deferredAxisLayout_data()
+{
+    QTest::addColumn<QChart::AnimationOption>("animationOptions");
+    QTest::newRow("NoAnimation") << QChart::NoAnimation;
+    QTest::newRow("SeriesAnimations") << QChart::SeriesAnimations;
+    QTest::newRow("AllAnimations") << QChart::AllAnimations;
+}
+
+void tst_QChart::deferredAxisLayout()
+{
+    SKIP_ON_POLAR();
+
+    QFETCH(QChart::AnimationOption, animationOptions);
+    m_chart->setAnimationOptions(animationOptions);
+    m_chart->setAnimationDuration(100);
+
+    QLineSeries *series = new QLineSeries();
+    *series << QPointF(0, 0) << QPointF(1, 1);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    QValueAxis *axisY = qobject_cast<QValueAxis *>(m_chart->axisY());
+    QVERIFY(axisY != 0);
+    axisY->setRange(0, 1);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+    QApplication::processEvents();
+
+    // Wider labels need a new layout, which is deferred until the event loop runs
+    ChartPresenter *presenter = ChartPresenter::get(m_chart);
+    presenter->resetLayoutCounters();
+    const QRectF plotArea = m_chart->plotArea();
+    axisY->setRange(0, 10);
+    axisY->setRange(0, 1000);
+    axisY->setRange(0, 1000000);
+    QCOMPARE(m_chart->plotArea(), plotArea);
+    QVERIFY(presenter->layoutRequestCount() >= 3);
+    QCOMPARE(presenter->layoutPassCount(), 0);
+    const int requests = presenter->layoutRequestCount();
+    QApplication::processEvents();
+    QVERIFY(m_chart->plotArea().left() > plotArea.left());
+
+    // All requests were served by a single pass
+    QCOMPARE(presenter->layoutRequestCount(), requests);
+    QCOMPARE(presenter->layoutPassCount(), 1);
+    QCOMPARE(presenter->savedLayoutPassCount(), requests - 1);
+
+    // The deferred pass ends up with the same geometry as a chart created with the final range
+    QChartView view;
+    view.resize(m_view->size());
+    QLineSeries *series2 = new QLineSeries();
+    *series2 << QPointF(0, 0) << QPointF(1, 1);
+    view.chart()->addSeries(series2);
+    view.chart()->createDefaultAxes();
+    view.chart()->axisY()->setRange(0, 1000000);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+    QApplication::processEvents();
+    TRY_COMPARE(m_chart->plotArea(), view.chart()->plotArea());
+}
+
+void tst_QChart::interactivePreview()
+{
+    SKIP_ON_POLAR();
+
+    QLineSeries *series = new QLineSeries();
+    *series << QPointF(0, 0) << QPointF(100, 100);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(m_chart->axisX());
+    QValueAxis *axisY = qobject_cast<QValueAxis *>(m_chart->axisY());
+    QVERIFY(axisX != 0);
+    QVERIFY(axisY != 0);
+    axisX->setRange(0, 100);
+    axisY->setRange(0, 100);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    QCOMPARE(m_chart->isInteractivePreviewEnabled(), false);
+    m_chart->setInteractivePreviewEnabled(true);
+    QCOMPARE(m_chart->isInteractivePreviewEnabled(), true);
+
+    // Zooming in twice and out once is applied as a single range change once it settles
+    QSignalSpy rangeSpy(axisX, SIGNAL(rangeChanged(qreal,qreal)));
+    m_chart->zoomIn();
+    m_chart->zoomIn();
+    m_chart->zoomOut();
+    QCOMPARE(axisX->min(), 0.0);
+    QCOMPARE(axisX->max(), 100.0);
+    TRY_COMPARE(rangeSpy.count(), 1);
+    QVERIFY(qFuzzyCompare(axisX->min(), 25.0));
+    QVERIFY(qFuzzyCompare(axisX->max(), 75.0));
+    QVERIFY(qFuzzyCompare(axisY->min(), 25.0));
+    QVERIFY(qFuzzyCompare(axisY->max(), 75.0));
+
+    // Scrolling by a tenth of the plot area in both directions
+    const QRectF plotArea = m_chart->plotArea();
+    m_chart->scroll(plotArea.width() / 10, plotArea.height() / 10);
+    QVERIFY(qFuzzyCompare(axisX->min(), 25.0));
+    TRY_COMPARE(rangeSpy.count(), 2);
+    QVERIFY(qFuzzyCompare(axisX->min(), 30.0));
+    QVERIFY(qFuzzyCompare(axisX->max(), 80.0));
+    QVERIFY(qFuzzyCompare(axisY->min(), 30.0));
+    QVERIFY(qFuzzyCompare(axisY->max(), 80.0));
+
+    // Querying the zoom state applies a pending preview right away
+    m_chart->zoomIn();
+    QVERIFY(m_chart->isZoomed());
+    QCOMPARE(rangeSpy.count(), 3);
+    QVERIFY(qFuzzyCompare(axisX->min(), 42.5));
+    QVERIFY(qFuzzyCompare(axisX->max(), 67.5));
+
+    m_chart->zoomIn();
+    m_chart->zoomReset();
+    QVERIFY(qFuzzyIsNull(axisX->min()));
+    QVERIFY(qFuzzyCompare(axisX->max(), 100.0));
+
+    // Series without preview support are updated right away
+    m_chart->addSeries(new QScatterSeries());
+    m_chart->zoomIn();
+    QVERIFY(qFuzzyCompare(axisX->min(), 25.0));
+}
+
 QTEST_MAIN(tst_QChart)
 #include "tst_qchart.moc"
 
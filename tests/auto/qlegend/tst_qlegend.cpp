@@ -40,6 +40,8 @@
 #include <QtCharts/QBarSeries>
 #include <QtCharts/QBarSet>
 #include <QtCharts/QBarLegendMarker>
+#include <QtWidgets/QGraphicsTextItem>
+#include <QtWidgets/QGraphicsSceneMouseEvent>
 #include "tst_definitions.h"
 
 QT_CHARTS_USE_NAMESPACE
@@ -61,6 +63,7 @@ private slots:
     void qxyLegendMarker();
     void qbarLegendMarker();
     void markers();
+    void markersAfterCountChange();
     void addAndRemoveSeries();
     void pieMarkerProperties();
     void barMarkerProperties();
@@ -68,6 +71,9 @@ private slots:
     void xyMarkerPropertiesLine();
     void xyMarkerPropertiesScatter();
     void markerSignals();
+    void manyMarkers();
+    void manyMarkersAlignments_data();
+    void manyMarkersAlignments();
 
 private:
 
@@ -283,6 +289,47 @@ void tst_QLegend::markers()
     QVERIFY(legend->markers().count() == 3+2+1+1);
 }
 
+void tst_QLegend::markersAfterCountChange()
+{
+    SKIP_ON_POLAR();
+
+    QVERIFY(m_chart);
+    QLegend *legend = m_chart->legend();
+
+    QPieSeries *pie = new QPieSeries();
+    QPieSlice *slice1 = pie->append(QString("slice1"), 1);
+    QPieSlice *slice2 = pie->append(QString("slice2"), 2);
+    m_chart->addSeries(pie);
+    QList<QLegendMarker *> before = legend->markers(pie);
+    QCOMPARE(before.count(), 2);
+
+    // existing markers are kept when slices are added or removed
+    QPieSlice *slice3 = pie->append(QString("slice3"), 3);
+    QList<QLegendMarker *> after = legend->markers(pie);
+    QCOMPARE(after.count(), 3);
+    QCOMPARE(after.at(0), before.at(0));
+    QCOMPARE(after.at(1), before.at(1));
+    QCOMPARE(static_cast<QPieLegendMarker *>(after.at(2))->slice(), slice3);
+
+    pie->remove(slice1);
+    after = legend->markers(pie);
+    QCOMPARE(after.count(), 2);
+    QCOMPARE(after.at(0), before.at(1));
+    QCOMPARE(static_cast<QPieLegendMarker *>(after.at(0))->slice(), slice2);
+
+    QBarSeries *bar = new QBarSeries();
+    QBarSet *set0 = new QBarSet(QString("set0"));
+    bar->append(set0);
+    m_chart->addSeries(bar);
+    QLegendMarker *setMarker = legend->markers(bar).first();
+    bar->append(new QBarSet(QString("set1")));
+    QCOMPARE(legend->markers(bar).count(), 2);
+    QCOMPARE(legend->markers(bar).first(), setMarker);
+    bar->remove(set0);
+    QCOMPARE(legend->markers(bar).count(), 1);
+    QCOMPARE(legend->markers().count(), 3);
+}
+
 void tst_QLegend::addAndRemoveSeries()
 {
     SKIP_ON_POLAR();
@@ -569,6 +616,144 @@ void tst_QLegend::markerSignals()
     qDeleteAll(spies);
 }
 
+// Returns the labels of the markers that have been laid out, as the label text is set by the layout
+static QStringList laidOutLabels(QGraphicsScene *scene)
+{
+    QStringList labels;
+    foreach (QGraphicsItem *item, scene->items()) {
+        QGraphicsTextItem *textItem = qgraphicsitem_cast<QGraphicsTextItem *>(item);
+        if (textItem && textItem->toPlainText().startsWith(QLatin1String("line ")))
+            labels << textItem->toPlainText();
+    }
+    return labels;
+}
+
+static void dragLegend(QGraphicsScene *scene, QLegend *legend, const QPoint &delta)
+{
+    QGraphicsSceneMouseEvent press(QEvent::GraphicsSceneMousePress);
+    press.setButton(Qt::LeftButton);
+    press.setButtons(Qt::LeftButton);
+    scene->sendEvent(legend, &press);
+
+    QGraphicsSceneMouseEvent move(QEvent::GraphicsSceneMouseMove);
+    move.setButtons(Qt::LeftButton);
+    move.setScreenPos(delta);
+    scene->sendEvent(legend, &move);
+
+    QGraphicsSceneMouseEvent release(QEvent::GraphicsSceneMouseRelease);
+    release.setButton(Qt::LeftButton);
+    release.setScreenPos(delta);
+    scene->sendEvent(legend, &release);
+}
+
+void tst_QLegend::manyMarkers()
+{
+    SKIP_ON_POLAR();
+
+    QChart *chart = new QChart();
+    QLegend *legend = chart->legend();
+    legend->setAlignment(Qt::AlignLeft);
+
+    // enough markers for the legend to lay out only the visible ones
+    QList<QLineSeries *> series;
+    for (int i = 0; i < 300; i++) {
+        QLineSeries *line = new QLineSeries();
+        line->setName(QString("line %1").arg(i));
+        line->append(i, i);
+        chart->addSeries(line);
+        series << line;
+    }
+    QCOMPARE(legend->markers().count(), 300);
+
+    QChartView view(chart);
+    view.resize(400, 400);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    QVERIFY(legend->isVisible());
+    QVERIFY(legend->geometry().height() <= view.height());
+
+    // the markers far below the visible part are not laid out
+    QStringList labels = laidOutLabels(view.scene());
+    QVERIFY(labels.contains("line 0"));
+    QVERIFY(!labels.contains("line 299"));
+    QVERIFY(labels.count() < 300);
+
+    // scrolling to the end lays them out
+    dragLegend(view.scene(), legend, QPoint(0, -100000));
+    QApplication::processEvents();
+    labels = laidOutLabels(view.scene());
+    QVERIFY(labels.contains("line 299"));
+    QVERIFY(labels.contains("line 0"));
+
+    for (int i = 0; i < 150; i++) {
+        chart->removeSeries(series.at(i));
+        delete series.at(i);
+    }
+    QCOMPARE(legend->markers().count(), 150);
+    QApplication::processEvents();
+
+    legend->setAlignment(Qt::AlignTop);
+    QApplication::processEvents();
+    QCOMPARE(legend->markers().count(), 150);
+}
+
+void tst_QLegend::manyMarkersAlignments_data()
+{
+    QTest::addColumn<int>("alignment");
+    QTest::addColumn<bool>("attached");
+    QTest::addColumn<QPoint>("drag");
+
+    QTest::newRow("attached top") << int(Qt::AlignTop) << true << QPoint(-100000, 0);
+    QTest::newRow("attached bottom") << int(Qt::AlignBottom) << true << QPoint(-100000, 0);
+    QTest::newRow("detached top") << int(Qt::AlignTop) << false << QPoint(0, -100000);
+    QTest::newRow("detached bottom") << int(Qt::AlignBottom) << false << QPoint(0, 100000);
+    QTest::newRow("detached left") << int(Qt::AlignLeft) << false << QPoint(-100000, 0);
+    QTest::newRow("detached right") << int(Qt::AlignRight) << false << QPoint(100000, 0);
+}
+
+void tst_QLegend::manyMarkersAlignments()
+{
+    SKIP_ON_POLAR();
+
+    QFETCH(int, alignment);
+    QFETCH(bool, attached);
+    QFETCH(QPoint, drag);
+
+    QChart *chart = new QChart();
+    QLegend *legend = chart->legend();
+    legend->setAlignment(Qt::Alignment(alignment));
+    for (int i = 0; i < 300; i++) {
+        QLineSeries *line = new QLineSeries();
+        line->setName(QString("line %1").arg(i));
+        line->append(i, i);
+        chart->addSeries(line);
+    }
+
+    QChartView view(chart);
+    view.resize(400, 400);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+    if (!attached) {
+        legend->detachFromChart();
+        legend->setGeometry(QRectF(20, 20, 300, 200));
+        legend->update();
+        QApplication::processEvents();
+    }
+
+    // every marker has its item, but only the ones near the visible part are laid out
+    QCOMPARE(legend->markers().count(), 300);
+    QStringList labels = laidOutLabels(view.scene());
+    QVERIFY(labels.contains("line 0"));
+    QVERIFY(!labels.contains("line 299"));
+
+    // scrolling to the end lays them out
+    dragLegend(view.scene(), legend, drag);
+    QApplication::processEvents();
+    labels = laidOutLabels(view.scene());
+    QVERIFY(labels.contains("line 299"));
+}
+
 QTEST_MAIN(tst_QLegend)
 
 #include "tst_qlegend.moc"
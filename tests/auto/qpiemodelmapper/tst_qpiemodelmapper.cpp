@@ -37,6 +37,7 @@
 #include <QtCharts/QVPieModelMapper>
 #include <QtCharts/QHPieModelMapper>
 #include <QtGui/QStandardItemModel>
+#include "numerictablemodel.h"
 
 QT_CHARTS_USE_NAMESPACE
 
@@ -72,6 +73,7 @@ class tst_qpiemodelmapper : public QObject
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void backgroundLoading();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -538,6 +540,45 @@ void tst_qpiemodelmapper::modelUpdateCell()
     QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 44.0);
 }
 
+void tst_qpiemodelmapper::backgroundLoading()
+{
+    const int rowCount = 10000;
+    NumericTableModel *model = new NumericTableModel(rowCount, 2);
+
+    QPieSeries *series = new QPieSeries;
+    QVPieModelMapper *mapper = new QVPieModelMapper;
+    mapper->setBackgroundLoading(true);
+    QSignalSpy spy(mapper, SIGNAL(loadingFinished()));
+    QSignalSpy addedSpy(series, SIGNAL(added(QList<QPieSlice*>)));
+    mapper->setValuesColumn(0);
+    mapper->setLabelsColumn(1);
+    mapper->setSeries(series);
+    mapper->setModel(model);
+    QVERIFY(mapper->isLoading());
+
+    // the values are read in the background, the labels when the slices are created
+    QTRY_COMPARE(spy.count(), 1);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(model->m_dataCalls, rowCount);
+    QCOMPARE(addedSpy.count(), 1);
+    QCOMPARE(series->count(), rowCount);
+    QCOMPARE(series->slices().at(rowCount - 1)->value(), qreal(2 * rowCount - 2));
+    QCOMPARE(series->slices().at(rowCount - 1)->label(), QString::number(2 * rowCount - 1));
+
+    // a change to the series is written to the model and the loading restarts
+    mapper->setFirstRow(0);
+    QVERIFY(mapper->isLoading());
+    series->slices().at(0)->setValue(-5);
+    QVERIFY(mapper->isLoading());
+    QTRY_COMPARE(spy.count(), 2);
+    QCOMPARE(series->count(), rowCount);
+    QCOMPARE(series->slices().at(0)->value(), -5.0);
+
+    delete mapper;
+    delete series;
+    delete model;
+}
+
 void tst_qpiemodelmapper::verticalMapperSignals()
 {
     QVPieModelMapper *mapper = new QVPieModelMapper;
@@ -33,6 +33,7 @@
 #include <QtCharts/QPieSeries>
 #include <QtCharts/QPieSlice>
 #include <QtCharts/QPieModelMapper>
+#include <QtCharts/QLegend>
 #include <QtGui/QStandardItemModel>
 #include <tst_definitions.h>
 
@@ -62,7 +63,10 @@ private slots:
     void take();
     void takeAnimated();
     void calculatedValues();
+    void calculatedValuesValueChange();
+    void aggregation();
     void clickedSignal();
+    void aggregatedSliceClicked();
     void hoverSignal();
     void sliceSeries();
     void destruction();
@@ -478,6 +482,99 @@ void tst_qpieseries::calculatedValues()
     QCOMPARE(angleSpanSpy.count(), 6);
 }
 
+void tst_qpieseries::calculatedValuesValueChange()
+{
+    m_view->chart()->addSeries(m_series);
+
+    QPieSlice *big = m_series->append("big", 1000000);
+    QPieSlice *slice1 = m_series->append("slice 1", 1);
+    QPieSlice *slice2 = m_series->append("slice 2", 2);
+    QPieSlice *slice3 = m_series->append("slice 3", 3);
+    QSignalSpy sumSpy(m_series, SIGNAL(sumChanged()));
+    QSignalSpy slice3Spy(slice3, SIGNAL(startAngleChanged()));
+
+    // a value change moves the sum and updates every slice
+    slice2->setValue(500000);
+    bool ok;
+    verifyCalculatedData(*m_series, &ok);
+    if (!ok)
+        return;
+    QCOMPARE(sumSpy.count(), 1);
+    QCOMPARE(slice3Spy.count(), 1);
+
+    // the sum follows the slices down to zero
+    slice2->setValue(0);
+    big->setValue(0);
+    verifyCalculatedData(*m_series, &ok);
+    if (!ok)
+        return;
+    QCOMPARE(sumSpy.count(), 3);
+
+    // the running sum does not drift from the slice values after many changes of very
+    // different sizes, between and after the resummations
+    for (int i = 0; i < 1001; i++) {
+        big->setValue(i % 2 ? 1e16 : 0.1);
+        slice1->setValue(0.1 * i);
+    }
+    qreal sum = 0;
+    foreach (QPieSlice *slice, m_series->slices())
+        sum += slice->value();
+    QCOMPARE(m_series->sum(), sum);
+    verifyCalculatedData(*m_series, &ok);
+}
+
+void tst_qpieseries::aggregation()
+{
+    m_view->chart()->addSeries(m_series);
+    QSignalSpy thresholdSpy(m_series, SIGNAL(aggregationThresholdChanged()));
+
+    QPieSlice *big1 = m_series->append("big 1", 50);
+    QPieSlice *big2 = m_series->append("big 2", 45);
+    QPieSlice *small1 = m_series->append("small 1", 2);
+    QPieSlice *small2 = m_series->append("small 2", 3);
+    QPieSlice *aggregated = m_series->aggregatedSlice();
+    QVERIFY(aggregated);
+    QVERIFY(!m_series->slices().contains(aggregated));
+    QCOMPARE(aggregated->value(), 0.0);
+    QCOMPARE(m_view->chart()->legend()->markers(m_series).count(), 4);
+
+    // the small slices are merged to the end of the pie
+    m_series->setAggregationThreshold(0.04);
+    QCOMPARE(thresholdSpy.count(), 1);
+    QCOMPARE(m_series->aggregationThreshold(), 0.04);
+    QCOMPARE(aggregated->value(), 5.0);
+    QCOMPARE(aggregated->percentage(), 0.05);
+    QCOMPARE(small1->angleSpan(), 0.0);
+    QCOMPARE(small2->angleSpan(), 0.0);
+    QCOMPARE(small1->percentage(), 0.02);
+    QCOMPARE(big2->startAngle() + big2->angleSpan(), aggregated->startAngle());
+    QCOMPARE(aggregated->startAngle() + aggregated->angleSpan(), m_series->pieEndAngle());
+    QCOMPARE(m_view->chart()->legend()->markers(m_series).count(), 3);
+
+    // a single slice below the threshold is not aggregated
+    small2->setValue(10);
+    QCOMPARE(aggregated->value(), 0.0);
+    QVERIFY(small1->angleSpan() > 0.0);
+    QCOMPARE(m_view->chart()->legend()->markers(m_series).count(), 4);
+
+    // shrinking slices join the aggregated slice
+    small2->setValue(3);
+    QCOMPARE(aggregated->value(), 5.0);
+    big1->setValue(1);
+    QCOMPARE(aggregated->value(), 3.0);
+    QCOMPARE(big1->angleSpan(), 0.0);
+    QVERIFY(small2->angleSpan() > 0.0);
+
+    m_series->setAggregationThreshold(0.0);
+    QCOMPARE(thresholdSpy.count(), 2);
+    QCOMPARE(aggregated->value(), 0.0);
+    bool ok;
+    verifyCalculatedData(*m_series, &ok);
+    if (!ok)
+        return;
+    QCOMPARE(m_view->chart()->legend()->markers(m_series).count(), 4);
+}
+
 void tst_qpieseries::verifyCalculatedData(const QPieSeries &series, bool *ok)
 {
     *ok = false;
@@ -557,6 +654,35 @@ void tst_qpieseries::clickedSignal()
     QCOMPARE(qvariant_cast<QPieSlice*>(clickSpy.at(3).at(0)), s4);
 }
 
+void tst_qpieseries::aggregatedSliceClicked()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // the two small slices are merged into the last quarter of the pie
+    QPieSlice *s1 = m_series->append("slice 1", 2);
+    m_series->append("slice 2", 2);
+    m_series->append("slice 3", 2);
+    m_series->append("small 1", 1);
+    m_series->append("small 2", 1);
+    m_series->setAggregationThreshold(0.2);
+    QSignalSpy clickSpy(m_series, SIGNAL(clicked(QPieSlice*)));
+    QSignalSpy aggregatedClickSpy(m_series->aggregatedSlice(), SIGNAL(clicked()));
+
+    m_view->chart()->legend()->setVisible(false);
+    m_view->chart()->addSeries(m_series);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    m_series->setPieSize(1.0);
+    QList<QPoint> points = slicePoints(m_view->chart()->plotArea());
+    QTest::mouseClick(m_view->viewport(), Qt::LeftButton, 0, points.at(0));
+    QTest::mouseClick(m_view->viewport(), Qt::LeftButton, 0, points.at(3));
+    TRY_COMPARE(clickSpy.count(), 2);
+    QCOMPARE(qvariant_cast<QPieSlice*>(clickSpy.at(0).at(0)), s1);
+    QCOMPARE(qvariant_cast<QPieSlice*>(clickSpy.at(1).at(0)), m_series->aggregatedSlice());
+    QCOMPARE(aggregatedClickSpy.count(), 1);
+}
+
 void tst_qpieseries::hoverSignal()
 {
     // NOTE:
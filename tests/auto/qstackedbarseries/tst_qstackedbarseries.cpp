@@ -59,6 +59,9 @@ private slots:
     void setLabelsAngle();
     void mouseclicked_data();
     void mouseclicked();
+    void mouseclickedBatched();
+    void mouseclickedBucketed();
+    void stacksAfterValueChanges();
     void mousehovered_data();
     void mousehovered();
     void mousePressed();
@@ -317,6 +320,187 @@ void tst_QStackedBarSeries::mouseclicked()
     QVERIFY(seriesSpyArg.at(0).toInt() == 2);
 }
 
+void tst_QStackedBarSeries::mouseclickedBatched()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // Enough bars to have them painted in batches by the series item
+    const int setCount = 20;
+    const int categoryCount = 60;
+
+    QStackedBarSeries* series = new QStackedBarSeries();
+    for (int set = 0; set < setCount; set++) {
+        QBarSet *barSet = new QBarSet(QString("set %1").arg(set));
+        for (int i = 0; i < categoryCount; i++)
+            *barSet << 1;
+        series->append(barSet);
+    }
+    QList<QBarSet*> barSets = series->barSets();
+
+    QSignalSpy seriesSpy(series,SIGNAL(clicked(int,QBarSet*)));
+    QSignalSpy setSpy(barSets.at(7), SIGNAL(clicked(int)));
+
+    QChartView view(new QChart());
+    view.resize(1000,800);
+    view.chart()->addSeries(series);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    // Calculate expected centers of bars
+    QRectF plotArea = view.chart()->plotArea();
+    qreal scaleY = plotArea.height() / setCount;        // Each stack is as high as the set count
+    qreal scaleX = plotArea.width() / categoryCount;
+    qreal domainMinX = -0.5;
+
+    QList<QPair<int, int> > bars;
+    bars << qMakePair(0, 0) << qMakePair(7, 31) << qMakePair(19, 59);
+    for (int i = 0; i < bars.size(); i++) {
+        const int set = bars.at(i).first;
+        const int category = bars.at(i).second;
+        QPointF center((category - domainMinX) * scaleX + plotArea.left(),
+                       plotArea.bottom() - (set + 0.5) * scaleY);
+        QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, center.toPoint());
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+        QCOMPARE(seriesSpy.count(), 1);
+        QList<QVariant> seriesSpyArg = seriesSpy.takeFirst();
+        QCOMPARE(qvariant_cast<QBarSet*>(seriesSpyArg.at(1)), barSets.at(set));
+        QCOMPARE(seriesSpyArg.at(0).toInt(), category);
+    }
+    QCOMPARE(setSpy.count(), 1);
+    QCOMPARE(setSpy.takeFirst().at(0).toInt(), 31);
+
+    // Clicking between bars hits nothing
+    QPointF gap((0.5 - domainMinX) * scaleX + plotArea.left(), plotArea.bottom() - scaleY / 2);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, gap.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 0);
+}
+
+void tst_QStackedBarSeries::mouseclickedBucketed()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // Many more categories than pixels, so adjacent categories are merged into one bar
+    const int categoryCount = 3000;
+    const int spike = 1500;
+
+    QStackedBarSeries* series = new QStackedBarSeries();
+    QBarSet *set1 = new QBarSet(QString("set 1"));
+    QBarSet *set2 = new QBarSet(QString("set 2"));
+    for (int i = 0; i < categoryCount; i++) {
+        *set1 << 1;
+        *set2 << (i == spike ? 10 : 1);
+    }
+    series->append(set1);
+    series->append(set2);
+
+    QSignalSpy seriesSpy(series,SIGNAL(clicked(int,QBarSet*)));
+
+    QChartView view(new QChart());
+    view.resize(400,300);
+    view.chart()->addSeries(series);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    QRectF plotArea = view.chart()->plotArea();
+    QVERIFY(plotArea.width() < categoryCount);
+    qreal scaleY = plotArea.height() / 11;      // Highest stack is 11
+    qreal scaleX = plotArea.width() / categoryCount;
+    qreal domainMinX = -0.5;
+
+    // The merged bar keeps the spike, and clicking it reports the spiking category
+    QPointF point((spike - domainMinX) * scaleX + plotArea.left(),
+                  plotArea.bottom() - 6 * scaleY);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, point.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+    QCOMPARE(seriesSpy.count(), 1);
+    QList<QVariant> seriesSpyArg = seriesSpy.takeFirst();
+    QCOMPARE(qvariant_cast<QBarSet*>(seriesSpyArg.at(1)), set2);
+    QCOMPARE(seriesSpyArg.at(0).toInt(), spike);
+}
+
+// Clicks the stack of the given category at the given value and returns the clicked set
+static QBarSet *clickStack(QChartView &view, QSignalSpy &spy, int category, qreal value,
+                           int categoryCount, qreal maxValue)
+{
+    QRectF plotArea = view.chart()->plotArea();
+    qreal scaleX = plotArea.width() / categoryCount;
+    qreal scaleY = plotArea.height() / maxValue;
+    qreal domainMinX = -0.5;
+    QPointF point((category - domainMinX) * scaleX + plotArea.left(),
+                  plotArea.bottom() - value * scaleY);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, point.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+    if (spy.count() != 1)
+        return 0;
+    QList<QVariant> spyArg = spy.takeFirst();
+    if (spyArg.at(0).toInt() != category)
+        return 0;
+    return qvariant_cast<QBarSet*>(spyArg.at(1));
+}
+
+void tst_QStackedBarSeries::stacksAfterValueChanges()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    QStackedBarSeries* series = new QStackedBarSeries();
+    QBarSet* set1 = new QBarSet(QString("set 1"));
+    *set1 << 10 << 10 << 10;
+    QBarSet* set2 = new QBarSet(QString("set 2"));
+    *set2 << 10 << 5 << 5;
+    series->append(set1);
+    series->append(set2);
+
+    QSignalSpy seriesSpy(series,SIGNAL(clicked(int,QBarSet*)));
+
+    QChartView view(new QChart());
+    view.resize(400,300);
+    view.chart()->addSeries(series);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    // The domain is set up when the series is added, the first category keeps it from 0 to 20
+    const int categoryCount = 3;
+    const qreal maxValue = 20;
+
+    // Replace: set 1 is 0..4 and set 2 4..9 in category 1
+    set1->replace(1, 4);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(clickStack(view, seriesSpy, 1, 2, categoryCount, maxValue), set1);
+    QCOMPARE(clickStack(view, seriesSpy, 1, 6, categoryCount, maxValue), set2);
+    QVERIFY(!clickStack(view, seriesSpy, 1, 11, categoryCount, maxValue));
+    QCOMPARE(clickStack(view, seriesSpy, 0, 15, categoryCount, maxValue), set2);
+
+    // Insert: set 0 is 0..3, set 1 3..7 and set 2 7..12 in category 1
+    QBarSet* set0 = new QBarSet(QString("set 0"));
+    *set0 << 0 << 3 << 3;
+    QVERIFY(series->insert(0, set0));
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(clickStack(view, seriesSpy, 1, 2, categoryCount, maxValue), set0);
+    QCOMPARE(clickStack(view, seriesSpy, 1, 5, categoryCount, maxValue), set1);
+    QCOMPARE(clickStack(view, seriesSpy, 1, 10, categoryCount, maxValue), set2);
+    QCOMPARE(clickStack(view, seriesSpy, 0, 5, categoryCount, maxValue), set1);
+    QCOMPARE(clickStack(view, seriesSpy, 0, 15, categoryCount, maxValue), set2);
+
+    // Remove a value: set 1 has no value in category 2, so set 2 is 3..8 there
+    set1->remove(2);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(clickStack(view, seriesSpy, 2, 2, categoryCount, maxValue), set0);
+    QCOMPARE(clickStack(view, seriesSpy, 2, 5, categoryCount, maxValue), set2);
+    QVERIFY(!clickStack(view, seriesSpy, 2, 10, categoryCount, maxValue));
+
+    // Remove a set: set 1 is 0..4 and set 2 4..9 in category 1 again
+    QVERIFY(series->remove(set0));
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(clickStack(view, seriesSpy, 1, 2, categoryCount, maxValue), set1);
+    QCOMPARE(clickStack(view, seriesSpy, 1, 6, categoryCount, maxValue), set2);
+    QCOMPARE(clickStack(view, seriesSpy, 2, 2, categoryCount, maxValue), set2);
+    QCOMPARE(seriesSpy.count(), 0);
+}
+
 void tst_QStackedBarSeries::mousehovered_data()
 {
 
@@ -30,6 +30,7 @@
 #include "../qabstractaxis/tst_qabstractaxis.h"
 #include <QtCharts/QValueAxis>
 #include <QtCharts/QLineSeries>
+#include <QtCharts/QAxisSyncGroup>
 
 class tst_QValueAxis: public tst_QAbstractAxis
 {
@@ -70,7 +71,9 @@ private slots:
     void noautoscale();
     void autoscale_data();
     void autoscale();
+    void autoRange();
     void reverse();
+    void syncGroup();
 
 private:
     QValueAxis* m_valuesaxis;
@@ -420,6 +423,49 @@ void tst_QValueAxis::autoscale()
     QVERIFY2(qFuzzyCompare(m_valuesaxis->max(), 100), "Max not equal");
 }
 
+void tst_QValueAxis::autoRange()
+{
+    QCOMPARE(m_valuesaxis->isAutoRange(), false);
+    QVERIFY(qFuzzyCompare(m_valuesaxis->autoRangeHeadroom(), 0.1));
+    QVERIFY(qFuzzyCompare(m_valuesaxis->autoRangeHysteresis(), 0.5));
+
+    QSignalSpy autoRangeSpy(m_valuesaxis, SIGNAL(autoRangeChanged(bool)));
+    m_valuesaxis->setAutoRange(true);
+    QCOMPARE(autoRangeSpy.count(), 1);
+
+    m_chart->setAxisX(m_valuesaxis, m_series);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    // Data spans -100..100, so headroom is 20 on both sides
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->min(), -120), "Min not equal");
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->max(), 120), "Max not equal");
+
+    QSignalSpy rangeSpy(m_valuesaxis, SIGNAL(rangeChanged(qreal,qreal)));
+    QXYSeries *series = static_cast<QXYSeries *>(m_series);
+
+    // Leaving the range expands only the exceeded side
+    series->append(150, 0);
+    QCOMPARE(rangeSpy.count(), 1);
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->min(), -120), "Min not equal");
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->max(), 175), "Max not equal");
+
+    // Data within the range does not change it
+    series->append(160, 0);
+    series->remove(0);
+    QCOMPARE(rangeSpy.count(), 1);
+
+    // Data covering much less than the range shrinks it
+    series->replace(QVector<QPointF>() << QPointF(0, 0) << QPointF(10, 10));
+    QCOMPARE(rangeSpy.count(), 2);
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->min(), -1), "Min not equal");
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->max(), 11), "Max not equal");
+
+    m_valuesaxis->setAutoRange(false);
+    series->append(1000, 0);
+    QCOMPARE(rangeSpy.count(), 2);
+}
+
 void tst_QValueAxis::reverse()
 {
     QSignalSpy spy(m_valuesaxis, SIGNAL(reverseChanged(bool)));
@@ -436,6 +482,59 @@ void tst_QValueAxis::reverse()
     QCOMPARE(m_valuesaxis->isReverse(), true);
 }
 
+void tst_QValueAxis::syncGroup()
+{
+    m_chart->setAxisX(m_valuesaxis, m_series);
+    m_valuesaxis->setRange(0, 100);
+
+    QChartView otherView;
+    QLineSeries *otherSeries = new QLineSeries();
+    *otherSeries << QPointF(0, 0) << QPointF(1000, 1000);
+    otherView.chart()->addSeries(otherSeries);
+    QValueAxis *otherAxis = new QValueAxis();
+    otherView.chart()->setAxisX(otherAxis, otherSeries);
+    otherAxis->setRange(-5, 5);
+
+    // A new member takes over the range of the group
+    QAxisSyncGroup group;
+    group.addAxis(m_valuesaxis);
+    group.addAxis(otherAxis);
+    QCOMPARE(group.axes().count(), 2);
+    QCOMPARE(otherAxis->min(), 0.0);
+    QCOMPARE(otherAxis->max(), 100.0);
+
+    // Changes within one event loop iteration are applied once, with the last range
+    QSignalSpy otherSpy(otherAxis, SIGNAL(rangeChanged(qreal,qreal)));
+    QSignalSpy syncSpy(&group, SIGNAL(rangeSynchronized(qreal,qreal)));
+    m_valuesaxis->setRange(10, 110);
+    m_valuesaxis->setRange(20, 120);
+    m_valuesaxis->setRange(30, 130);
+    QCOMPARE(otherSpy.count(), 0);
+    TRY_COMPARE(syncSpy.count(), 1);
+    QCOMPARE(otherSpy.count(), 1);
+    QCOMPARE(otherAxis->min(), 30.0);
+    QCOMPARE(otherAxis->max(), 130.0);
+    QCOMPARE(m_valuesaxis->min(), 30.0);
+
+    // Synchronization works in both directions without feeding back
+    otherAxis->setRange(40, 60);
+    TRY_COMPARE(syncSpy.count(), 2);
+    QCOMPARE(m_valuesaxis->min(), 40.0);
+    QCOMPARE(m_valuesaxis->max(), 60.0);
+    QCOMPARE(otherSpy.count(), 2);
+
+    // Removed and deleted axes no longer take part
+    group.removeAxis(otherAxis);
+    m_valuesaxis->setRange(0, 10);
+    QTest::qWait(1);
+    QCOMPARE(otherAxis->min(), 40.0);
+
+    group.addAxis(otherAxis);
+    otherView.chart()->removeAxis(otherAxis);
+    delete otherAxis;
+    QCOMPARE(group.axes().count(), 1);
+}
+
 QTEST_MAIN(tst_QValueAxis)
 #include "tst_qvalueaxis.moc"
 
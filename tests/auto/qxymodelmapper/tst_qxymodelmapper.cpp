@@ -38,6 +38,7 @@
 #include <QtCharts/QHXYModelMapper>
 #include <QtGui/QStandardItemModel>
 #include "tst_definitions.h"
+#include "numerictablemodel.h"
 
 QT_CHARTS_USE_NAMESPACE
 
@@ -73,6 +74,10 @@ class tst_qxymodelmapper : public QObject
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void modelUpdateRange();
+    void modelUpdateSinglePoint();
+    void backgroundLoading();
+    void numericColumnAccess();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -544,6 +549,184 @@ void tst_qxymodelmapper::modelUpdateCell()
     QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 44.0);
 }
 
+void tst_qxymodelmapper::modelUpdateRange()
+{
+    // setup the mapper
+    createVerticalMapper();
+
+    QSignalSpy replacedSpy(m_series, SIGNAL(pointReplaced(int)));
+    QSignalSpy allReplacedSpy(m_series, SIGNAL(pointsReplaced()));
+
+    m_model->blockSignals(true);
+    for (int row = 2; row < 8; row++) {
+        m_model->setData(m_model->index(row, 0), row * 10);
+        m_model->setData(m_model->index(row, 1), row * 100);
+    }
+    m_model->blockSignals(false);
+    emit m_model->dataChanged(m_model->index(2, 0), m_model->index(7, 1));
+
+    QCOMPARE(replacedSpy.count(), 0);
+    QCOMPARE(allReplacedSpy.count(), 1);
+    QCOMPARE(m_series->count(), m_modelRowCount);
+    for (int row = 2; row < 8; row++)
+        QCOMPARE(m_series->at(row), QPointF(row * 10, row * 100));
+
+    // changes outside of the mapped columns are ignored
+    emit m_model->dataChanged(m_model->index(0, 4), m_model->index(9, 5));
+    QCOMPARE(allReplacedSpy.count(), 1);
+
+    // rows inserted and removed in one go are synchronized with a single notification each
+    QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    QSignalSpy removedSpy(m_series, SIGNAL(pointsRemoved(int,int)));
+    m_model->insertRows(3, 5);
+    QCOMPARE(m_series->count(), m_modelRowCount + 5);
+    QCOMPARE(addedSpy.count(), 0);
+    QCOMPARE(allReplacedSpy.count(), 2);
+    QCOMPARE(m_series->at(8), QPointF(30, 300));
+
+    m_model->removeRows(3, 5);
+    QCOMPARE(m_series->count(), m_modelRowCount);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(m_series->at(3), QPointF(30, 300));
+}
+
+void tst_qxymodelmapper::backgroundLoading()
+{
+    const int rowCount = 20000;
+    NumericTableModel *model = new NumericTableModel(rowCount, 2, this);
+
+    QVXYModelMapper *mapper = new QVXYModelMapper;
+    QVERIFY(!mapper->backgroundLoading());
+    mapper->setBackgroundLoading(true);
+    QSignalSpy spy(mapper, SIGNAL(loadingFinished()));
+    QSignalSpy replacedSpy(m_series, SIGNAL(pointsReplaced()));
+
+    mapper->setXColumn(0);
+    mapper->setYColumn(1);
+    mapper->setSeries(m_series);
+    mapper->setModel(model);
+    QVERIFY(mapper->isLoading());
+
+    QTRY_COMPARE(spy.count(), 1);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(m_series->count(), rowCount);
+    QCOMPARE(m_series->at(rowCount - 1), QPointF((rowCount - 1) * 2, (rowCount - 1) * 2 + 1));
+
+    // small ranges are still read right away
+    mapper->setRowCount(100);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(m_series->count(), 100);
+
+    // a change to the series is written to the model and the loading restarts
+    mapper->setRowCount(-1);
+    QVERIFY(mapper->isLoading());
+    m_series->append(-1, -2);
+    QVERIFY(mapper->isLoading());
+    QTRY_COMPARE(spy.count(), 2);
+    QCOMPARE(m_series->count(), rowCount + 1);
+    QCOMPARE(m_series->at(100), QPointF(-1, -2));
+
+    // the points are passed to the series before a structural change of the model is applied
+    mapper->setRowCount(100);
+    mapper->setRowCount(-1);
+    QVERIFY(mapper->isLoading());
+    replacedSpy.clear();
+    model->insertRows(0, 1);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(spy.count(), 3);
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(m_series->count(), rowCount + 2);
+    QCOMPARE(m_series->at(0), QPointF(0, 0));
+    QCOMPARE(m_series->at(101), QPointF(-1, -2));
+
+    // and before a data change
+    mapper->setRowCount(100);
+    mapper->setRowCount(-1);
+    QVERIFY(mapper->isLoading());
+    model->setData(model->index(1, 1), -7);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(spy.count(), 4);
+    QCOMPARE(m_series->count(), rowCount + 2);
+    QCOMPARE(m_series->at(1).y(), qreal(-7));
+
+    // models without numeric access are read at once
+    QStandardItemModel *standardModel = new QStandardItemModel(rowCount, 2, this);
+    mapper->setModel(standardModel);
+    QVERIFY(!mapper->isLoading());
+    QCOMPARE(m_series->count(), rowCount);
+    QCOMPARE(spy.count(), 4);
+
+    delete mapper;
+    delete standardModel;
+    delete model;
+}
+
+void tst_qxymodelmapper::numericColumnAccess()
+{
+    NumericTableModel *model = new NumericTableModel(10, 4);
+
+    QVXYModelMapper *vMapper = new QVXYModelMapper;
+    vMapper->setXColumn(1);
+    vMapper->setYColumn(3);
+    vMapper->setFirstRow(2);
+    vMapper->setRowCount(5);
+    vMapper->setSeries(m_series);
+    vMapper->setModel(model);
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(m_series->count(), 5);
+    QCOMPARE(m_series->at(0), QPointF(9, 11));
+    QCOMPARE(m_series->at(4), QPointF(25, 27));
+    delete vMapper;
+
+    QHXYModelMapper *hMapper = new QHXYModelMapper;
+    hMapper->setXRow(0);
+    hMapper->setYRow(9);
+    hMapper->setSeries(m_series);
+    hMapper->setModel(model);
+    QCOMPARE(model->m_dataCalls, 0);
+    QCOMPARE(m_series->count(), 4);
+    QCOMPARE(m_series->at(3), QPointF(3, 39));
+    delete hMapper;
+
+    delete model;
+}
+
+void tst_qxymodelmapper::modelUpdateSinglePoint()
+{
+    // setup the mapper
+    createVerticalMapper();
+
+    QSignalSpy replacedSpy(m_series, SIGNAL(pointReplaced(int)));
+    QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    QSignalSpy removedSpy(m_series, SIGNAL(pointRemoved(int)));
+    QSignalSpy allReplacedSpy(m_series, SIGNAL(pointsReplaced()));
+    QSignalSpy allRemovedSpy(m_series, SIGNAL(pointsRemoved(int,int)));
+
+    // changes of a single row keep the per-point signals
+    m_model->setData(m_model->index(2, 1), 44);
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(replacedSpy.at(0).at(0).toInt(), 2);
+    QCOMPARE(m_series->at(2).y(), 44.0);
+
+    m_model->insertRows(3, 1);
+    m_model->setData(m_model->index(3, 0), 30);
+    m_model->setData(m_model->index(3, 1), 300);
+    QCOMPARE(addedSpy.count(), 1);
+    QCOMPARE(addedSpy.at(0).at(0).toInt(), 3);
+    QCOMPARE(m_series->count(), m_modelRowCount + 1);
+    QCOMPARE(m_series->at(3), QPointF(30, 300));
+
+    m_model->removeRows(3, 1);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(removedSpy.at(0).at(0).toInt(), 3);
+    QCOMPARE(m_series->count(), m_modelRowCount);
+
+    QCOMPARE(allReplacedSpy.count(), 0);
+    QCOMPARE(allRemovedSpy.count(), 0);
+}
+
 void tst_qxymodelmapper::verticalMapperSignals()
 {
     QVXYModelMapper *mapper = new QVXYModelMapper;
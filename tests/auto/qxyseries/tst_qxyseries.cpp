@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include "tst_qxyseries.h"
+#include <QtCharts/QLineSeries>
 
 Q_DECLARE_METATYPE(QList<QPointF>)
 
@@ -653,3 +654,59 @@ void tst_QXYSeries::changedSignals()
     TRY_COMPARE(nameSpy.count(), 0);
     TRY_COMPARE(colorSpy.count(), 2);
 }
+
+void tst_QXYSeries::sharedData()
+{
+    m_chart->addSeries(m_series);
+    m_chart->createDefaultAxes();
+    m_series->append(0, 0);
+
+    QChartView otherView;
+    QLineSeries *other = new QLineSeries();
+    other->append(5, 5);
+    other->append(6, 6);
+    otherView.chart()->addSeries(other);
+    otherView.chart()->createDefaultAxes();
+
+    QSignalSpy replacedSpy(other, SIGNAL(pointsReplaced()));
+    other->shareData(m_series);
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(other->pointsVector(), m_series->pointsVector());
+    QCOMPARE(other->count(), 1);
+
+    // Changes made through either series are seen by both
+    QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    QSignalSpy otherAddedSpy(other, SIGNAL(pointAdded(int)));
+    other->append(10, 20);
+    QCOMPARE(addedSpy.count(), 1);
+    QCOMPARE(otherAddedSpy.count(), 1);
+    QCOMPARE(m_series->count(), 2);
+    QCOMPARE(m_series->at(1), QPointF(10, 20));
+
+    QSignalSpy removedSpy(other, SIGNAL(pointRemoved(int)));
+    m_series->remove(0);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(other->pointsVector(), QVector<QPointF>() << QPointF(10, 20));
+
+    QSignalSpy otherReplacedSpy(other, SIGNAL(pointReplaced(int)));
+    m_series->replace(0, QPointF(30, 40));
+    QCOMPARE(otherReplacedSpy.count(), 1);
+    QCOMPARE(other->at(0), QPointF(30, 40));
+
+    m_series->append(-10, -20);
+
+    // Detached series keep their points but no longer follow each other
+    other->detachData();
+    QCOMPARE(other->pointsVector(), m_series->pointsVector());
+    m_series->clear();
+    QCOMPARE(m_series->count(), 0);
+    QCOMPARE(other->count(), 2);
+
+    // Data outlives the series it was shared from
+    m_series->shareData(other);
+    otherView.chart()->removeSeries(other);
+    delete other;
+    QCOMPARE(m_series->count(), 2);
+    m_series->append(1, 1);
+    QCOMPARE(m_series->count(), 3);
+}
@@ -94,6 +94,7 @@ private slots:
     void insert_data();
     void insert();
     void changedSignals();
+    void sharedData();
 protected:
     void append_data();
     void count_data();
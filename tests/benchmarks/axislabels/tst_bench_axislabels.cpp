@@ -0,0 +1,147 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChart>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QValueAxis>
+#include <QtCharts/QLogValueAxis>
+#include <QtCharts/QDateTimeAxis>
+#include <QtCharts/QCategoryAxis>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QGraphicsScene>
+#include <bench_definitions.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Measures generating and laying out the labels of an axis after its range changes
+class tst_Bench_AxisLabels : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void rangeChanged_data();
+    void rangeChanged();
+};
+
+void tst_Bench_AxisLabels::rangeChanged_data()
+{
+    QTest::addColumn<QByteArray>("type");
+    QTest::addColumn<int>("ticks");
+    QTest::addColumn<QString>("format");
+    QTest::addColumn<bool>("widthChanges");
+
+    QTest::newRow("value 5") << QByteArray("value") << 5 << QString() << false;
+    QTest::newRow("value 50") << QByteArray("value") << 50 << QString() << false;
+    QTest::newRow("value 50 printf") << QByteArray("value") << 50 << QString("%.3f units") << false;
+    QTest::newRow("value 50 width changes") << QByteArray("value") << 50 << QString() << true;
+    QTest::newRow("log 5") << QByteArray("log") << 5 << QString() << false;
+    QTest::newRow("log 50") << QByteArray("log") << 50 << QString() << false;
+    QTest::newRow("log 50 width changes") << QByteArray("log") << 50 << QString() << true;
+    QTest::newRow("datetime 5") << QByteArray("datetime") << 5 << QString("dd.MM.yyyy") << false;
+    QTest::newRow("datetime 50") << QByteArray("datetime") << 50 << QString("hh:mm:ss.zzz") << false;
+    QTest::newRow("datetime 50 width changes") << QByteArray("datetime") << 50 << QString("d.M.yyyy h:mm") << true;
+    QTest::newRow("category 5") << QByteArray("category") << 5 << QString() << false;
+    QTest::newRow("category 50") << QByteArray("category") << 50 << QString() << false;
+}
+
+void tst_Bench_AxisLabels::rangeChanged()
+{
+    QFETCH(QByteArray, type);
+    QFETCH(int, ticks);
+    QFETCH(QString, format);
+    QFETCH(bool, widthChanges);
+
+    QGraphicsScene scene;
+    QChart *chart = new QChart();
+    chart->legend()->hide();
+    scene.addItem(chart);
+    chart->resize(4000, 800);
+
+    // Large enough values that labels need all of their digits
+    const qreal base = type == "datetime" ? QDateTime(QDate(2016, 1, 1)).toMSecsSinceEpoch() : 1000;
+    const qreal span = type == "datetime" ? 3600 * 1000 : 1000;
+
+    QLineSeries *series = new QLineSeries();
+    *series << QPointF(base, 0) << QPointF(base + span, 1);
+    chart->addSeries(series);
+
+    QAbstractAxis *axis;
+    if (type == "log") {
+        QLogValueAxis *logAxis = new QLogValueAxis();
+        logAxis->setBase(2);
+        if (!format.isEmpty())
+            logAxis->setLabelFormat(format);
+        axis = logAxis;
+    } else if (type == "datetime") {
+        QDateTimeAxis *dateTimeAxis = new QDateTimeAxis();
+        dateTimeAxis->setTickCount(ticks);
+        dateTimeAxis->setFormat(format);
+        axis = dateTimeAxis;
+    } else if (type == "category") {
+        QCategoryAxis *categoryAxis = new QCategoryAxis();
+        for (int i = 1; i <= ticks; i++)
+            categoryAxis->append(QString("Category %1").arg(i), base + span * i / ticks);
+        axis = categoryAxis;
+    } else {
+        QValueAxis *valueAxis = new QValueAxis();
+        valueAxis->setTickCount(ticks);
+        if (!format.isEmpty())
+            valueAxis->setLabelFormat(format);
+        axis = valueAxis;
+    }
+    chart->setAxisX(axis, series);
+    QApplication::processEvents();
+
+    // For a log axis, the number of labels follows from the range
+    const qreal rangeSpan = type == "log" ? qPow(2, ticks) : span;
+    const bool dateTime = type == "datetime";
+    // Either shift the range slightly so that the labels keep their widths, or far enough that
+    // the labels gain digits and the axis has to be laid out again
+    qreal shift = 1;
+    if (widthChanges)
+        shift = dateTime ? 9 * 24 * 3600 * 1000 + 9 * 3600 * 1000 : base * 1000;
+    bool shifted = false;
+    QBENCHMARK {
+        shifted = !shifted;
+        const qreal min = shifted ? base + shift : base;
+        if (dateTime) {
+            axis->setRange(QDateTime::fromMSecsSinceEpoch(qint64(min)),
+                           QDateTime::fromMSecsSinceEpoch(qint64(min + rangeSpan)));
+        } else {
+            axis->setRange(min, min + rangeSpan);
+        }
+        // The layout is scheduled on the event loop, so let it run to measure the label geometry
+        QApplication::processEvents();
+    }
+}
+
+QTEST_MAIN(tst_Bench_AxisLabels)
+
+#include "tst_bench_axislabels.moc"
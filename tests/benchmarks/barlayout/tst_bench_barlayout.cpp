@@ -0,0 +1,162 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChart>
+#include <QtCharts/QBarSeries>
+#include <QtCharts/QStackedBarSeries>
+#include <QtCharts/QPercentBarSeries>
+#include <QtCharts/QBarSet>
+#include <QtCharts/QValueAxis>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QGraphicsScene>
+#include <bench_definitions.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Measures the layout of bar, stacked bar, and percent bar items after a domain change
+class tst_Bench_BarLayout : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void layout_data();
+    void layout();
+    void replaceValues_data();
+    void replaceValues();
+
+private:
+    QAbstractBarSeries *createSeries(const QByteArray &type, int sets, int categories);
+};
+
+QAbstractBarSeries *tst_Bench_BarLayout::createSeries(const QByteArray &type, int sets,
+                                                      int categories)
+{
+    QAbstractBarSeries *series;
+    if (type == "stacked")
+        series = new QStackedBarSeries();
+    else if (type == "percent")
+        series = new QPercentBarSeries();
+    else
+        series = new QBarSeries();
+
+    QList<QBarSet *> barSets;
+    for (int i = 0; i < sets; i++) {
+        QBarSet *set = new QBarSet(QString::number(i));
+        for (int j = 0; j < categories; j++)
+            set->append(1 + (i * 7 + j * 3) % 11);
+        barSets << set;
+    }
+    series->append(barSets);
+    return series;
+}
+
+static void addBarRows(const QByteArray &type)
+{
+    static const int sizes[][2] = { { 5, 10 }, { 5, 1000 }, { 50, 100 }, { 10, 10000 } };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        const QByteArray name = type + ' ' + QByteArray::number(sizes[i][0]) + 'x'
+                + QByteArray::number(sizes[i][1]);
+        QTest::newRow(name.constData()) << type << sizes[i][0] << sizes[i][1];
+    }
+}
+
+void tst_Bench_BarLayout::layout_data()
+{
+    QTest::addColumn<QByteArray>("type");
+    QTest::addColumn<int>("sets");
+    QTest::addColumn<int>("categories");
+    addBarRows("bar");
+    addBarRows("stacked");
+    addBarRows("percent");
+}
+
+void tst_Bench_BarLayout::layout()
+{
+    QFETCH(QByteArray, type);
+    QFETCH(int, sets);
+    QFETCH(int, categories);
+
+    QGraphicsScene scene;
+    QChart *chart = new QChart();
+    chart->legend()->hide();
+    scene.addItem(chart);
+    chart->resize(1000, 800);
+
+    QAbstractBarSeries *series = createSeries(type, sets, categories);
+    chart->addSeries(series);
+    QValueAxis *axisY = new QValueAxis();
+    chart->setAxisY(axisY, series);
+    axisY->setRange(0, type == "percent" ? 100 : sets * 12);
+    QApplication::processEvents();
+
+    // Alternating between two value ranges makes every iteration lay out all bars again
+    const qreal max = axisY->max();
+    bool zoomed = false;
+    QBENCHMARK {
+        zoomed = !zoomed;
+        axisY->setRange(0, zoomed ? max / 2 : max);
+    }
+}
+
+void tst_Bench_BarLayout::replaceValues_data()
+{
+    layout_data();
+}
+
+// Measures changing a value in every set, each of which triggers a layout of its own
+void tst_Bench_BarLayout::replaceValues()
+{
+    QFETCH(QByteArray, type);
+    QFETCH(int, sets);
+    QFETCH(int, categories);
+
+    QGraphicsScene scene;
+    QChart *chart = new QChart();
+    chart->legend()->hide();
+    scene.addItem(chart);
+    chart->resize(1000, 800);
+
+    QAbstractBarSeries *series = createSeries(type, sets, categories);
+    chart->addSeries(series);
+    chart->createDefaultAxes();
+    QApplication::processEvents();
+
+    const QList<QBarSet *> barSets = series->barSets();
+    int iteration = 0;
+    QBENCHMARK {
+        iteration++;
+        foreach (QBarSet *set, barSets)
+            set->replace(iteration % categories, 1 + iteration % 5);
+    }
+}
+
+QTEST_MAIN(tst_Bench_BarLayout)
+
+#include "tst_bench_barlayout.moc"
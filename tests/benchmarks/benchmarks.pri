@@ -0,0 +1,11 @@
+!include( ../tests.pri ) {
+    error( "Couldn't find the tests.pri file!" )
+}
+
+CONFIG += testcase benchmark
+QT += testlib widgets
+
+!contains(TARGET, ^tst_bench_.*):TARGET = $$join(TARGET,,"tst_bench_")
+
+INCLUDEPATH += ../inc
+HEADERS += ../inc/bench_definitions.h
@@ -0,0 +1,11 @@
+TEMPLATE = subdirs
+SUBDIRS += \
+           xychartitems \
+           barlayout \
+           axislabels \
+           legendlayout \
+           rendering \
+           domain
+
+!contains(QT_CONFIG, private_tests): SUBDIRS -= \
+    domain
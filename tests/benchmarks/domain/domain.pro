@@ -0,0 +1,7 @@
+!include( ../benchmarks.pri ) {
+    error( "Couldn't find the benchmarks.pri file!" )
+}
+
+QT += charts-private
+
+SOURCES += tst_bench_domain.cpp
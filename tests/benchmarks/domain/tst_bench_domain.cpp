@@ -0,0 +1,122 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <private/xydomain_p.h>
+#include <private/logxydomain_p.h>
+#include <bench_definitions.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_Bench_Domain : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void calculateGeometryPoints_data();
+    void calculateGeometryPoints();
+    void calculateGeometryPoint_data();
+    void calculateGeometryPoint();
+
+private:
+    AbstractDomain *createDomain(const QByteArray &type, int count);
+};
+
+AbstractDomain *tst_Bench_Domain::createDomain(const QByteArray &type, int count)
+{
+    AbstractDomain *domain;
+    if (type == "logxy")
+        domain = new LogXYDomain(this);
+    else
+        domain = new XYDomain(this);
+    domain->setSize(QSizeF(1000, 800));
+    domain->setRange(1, count, -100, 106);
+    return domain;
+}
+
+void tst_Bench_Domain::calculateGeometryPoints_data()
+{
+    QTest::addColumn<QByteArray>("type");
+    QTest::addColumn<int>("count");
+    addPointCountRows("xy");
+    addPointCountRows("logxy");
+}
+
+void tst_Bench_Domain::calculateGeometryPoints()
+{
+    QFETCH(QByteArray, type);
+    QFETCH(int, count);
+
+    const QVector<QPointF> points = benchmarkPoints(count);
+    AbstractDomain *domain = createDomain(type, count);
+
+    QVector<QPointF> geometryPoints;
+    QBENCHMARK {
+        geometryPoints = domain->calculateGeometryPoints(points);
+    }
+    QCOMPARE(geometryPoints.count(), count);
+
+    delete domain;
+}
+
+void tst_Bench_Domain::calculateGeometryPoint_data()
+{
+    QTest::addColumn<QByteArray>("type");
+    QTest::addColumn<int>("count");
+    addPointCountRows("xy", 1000000);
+    addPointCountRows("logxy", 1000000);
+}
+
+// The per point path taken by items that map points one at a time, such as scatter markers
+void tst_Bench_Domain::calculateGeometryPoint()
+{
+    QFETCH(QByteArray, type);
+    QFETCH(int, count);
+
+    const QVector<QPointF> points = benchmarkPoints(count);
+    AbstractDomain *domain = createDomain(type, count);
+
+    int valid = 0;
+    QBENCHMARK {
+        valid = 0;
+        bool ok;
+        for (int i = 0; i < points.count(); i++) {
+            domain->calculateGeometryPoint(points.at(i), ok);
+            if (ok)
+                valid++;
+        }
+    }
+    QCOMPARE(valid, count);
+
+    delete domain;
+}
+
+QTEST_MAIN(tst_Bench_Domain)
+
+#include "tst_bench_domain.moc"
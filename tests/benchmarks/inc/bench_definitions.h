@@ -0,0 +1,61 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef BENCH_DEFINITIONS_H
+#define BENCH_DEFINITIONS_H
+
+#include <QtTest/QtTest>
+#include <QtCore/QVector>
+#include <QtCore/QPointF>
+#include <QtCore/qmath.h>
+
+// Point counts the XY benchmarks run with, up to maxCount
+static inline void addPointCountRows(const QByteArray &name, int maxCount = 10000000)
+{
+    static const int counts[] = { 1000, 10000, 100000, 1000000, 10000000 };
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+        if (counts[i] > maxCount)
+            break;
+        QTest::newRow((name + ' ' + QByteArray::number(counts[i])).constData())
+                << name << counts[i];
+    }
+}
+
+// Deterministic data with both smooth and jagged parts, with all x values above zero so that the
+// points can be used with logarithmic axes as well
+static inline QVector<QPointF> benchmarkPoints(int count)
+{
+    QVector<QPointF> points;
+    points.reserve(count);
+    for (int i = 0; i < count; i++)
+        points << QPointF(i + 1, 100.0 * qSin(i * 0.01) + (i % 7));
+    return points;
+}
+
+#endif // BENCH_DEFINITIONS_H
@@ -0,0 +1,133 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChart>
+#include <QtCharts/QLegend>
+#include <QtCharts/QLineSeries>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QGraphicsScene>
+#include <QtWidgets/QGraphicsLayout>
+#include <bench_definitions.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Measures laying out the markers of a legend, which happens whenever the chart is resized or
+// series are added or removed
+class tst_Bench_LegendLayout : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void setGeometry_data();
+    void setGeometry();
+    void addRemoveSeries_data();
+    void addRemoveSeries();
+};
+
+void tst_Bench_LegendLayout::setGeometry_data()
+{
+    QTest::addColumn<int>("alignment");
+    QTest::addColumn<int>("markers");
+
+    static const int counts[] = { 10, 100, 1000 };
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+        QTest::newRow(QByteArray("bottom " + QByteArray::number(counts[i])).constData())
+                << int(Qt::AlignBottom) << counts[i];
+        QTest::newRow(QByteArray("left " + QByteArray::number(counts[i])).constData())
+                << int(Qt::AlignLeft) << counts[i];
+    }
+}
+
+void tst_Bench_LegendLayout::setGeometry()
+{
+    QFETCH(int, alignment);
+    QFETCH(int, markers);
+
+    QGraphicsScene scene;
+    QChart *chart = new QChart();
+    scene.addItem(chart);
+    chart->resize(1000, 800);
+    chart->legend()->setAlignment(Qt::Alignment(alignment));
+
+    for (int i = 0; i < markers; i++) {
+        QLineSeries *series = new QLineSeries();
+        series->setName(QString("Series %1").arg(i));
+        *series << QPointF(0, i) << QPointF(1, i + 1);
+        chart->addSeries(series);
+    }
+    QApplication::processEvents();
+
+    QGraphicsLayout *layout = chart->legend()->layout();
+    QVERIFY(layout);
+    const QRectF geometry = chart->legend()->geometry();
+    QBENCHMARK {
+        layout->setGeometry(geometry);
+    }
+}
+
+void tst_Bench_LegendLayout::addRemoveSeries_data()
+{
+    setGeometry_data();
+}
+
+// Measures the marker bookkeeping and relayout caused by adding and removing one series next to
+// the markers of all other series
+void tst_Bench_LegendLayout::addRemoveSeries()
+{
+    QFETCH(int, alignment);
+    QFETCH(int, markers);
+
+    QGraphicsScene scene;
+    QChart *chart = new QChart();
+    scene.addItem(chart);
+    chart->resize(1000, 800);
+    chart->legend()->setAlignment(Qt::Alignment(alignment));
+
+    for (int i = 0; i < markers; i++) {
+        QLineSeries *series = new QLineSeries();
+        series->setName(QString("Series %1").arg(i));
+        chart->addSeries(series);
+    }
+    QApplication::processEvents();
+
+    QLineSeries *extra = new QLineSeries();
+    extra->setName("Extra");
+    QBENCHMARK {
+        chart->addSeries(extra);
+        QApplication::processEvents();
+        chart->removeSeries(extra);
+        QApplication::processEvents();
+    }
+    delete extra;
+}
+
+QTEST_MAIN(tst_Bench_LegendLayout)
+
+#include "tst_bench_legendlayout.moc"
@@ -0,0 +1,5 @@
+!include( ../benchmarks.pri ) {
+    error( "Couldn't find the benchmarks.pri file!" )
+}
+
+SOURCES += tst_bench_rendering.cpp
@@ -0,0 +1,140 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChart>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QSplineSeries>
+#include <QtCharts/QScatterSeries>
+#include <QtCharts/QAreaSeries>
+#include <QtCharts/QBarSeries>
+#include <QtCharts/QBarSet>
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QGraphicsScene>
+#include <bench_definitions.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Measures painting a complete chart offscreen, as done when exporting charts to images
+class tst_Bench_Rendering : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void render_data();
+    void render();
+
+private:
+    QAbstractSeries *createSeries(const QByteArray &type, int count);
+};
+
+QAbstractSeries *tst_Bench_Rendering::createSeries(const QByteArray &type, int count)
+{
+    if (type == "bar") {
+        QBarSeries *series = new QBarSeries();
+        QBarSet *set = new QBarSet("Set");
+        for (int i = 0; i < count; i++)
+            set->append(1 + i % 11);
+        series->append(set);
+        return series;
+    }
+
+    QXYSeries *series;
+    if (type == "spline")
+        series = new QSplineSeries();
+    else if (type == "scatter")
+        series = new QScatterSeries();
+    else
+        series = new QLineSeries();
+    series->replace(benchmarkPoints(count));
+
+    if (type == "area")
+        return new QAreaSeries(static_cast<QLineSeries *>(series));
+    return series;
+}
+
+void tst_Bench_Rendering::render_data()
+{
+    QTest::addColumn<QByteArray>("type");
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("antialiasing");
+
+    static const struct {
+        const char *type;
+        int maxCount;
+    } types[] = {
+        { "line", 1000000 },
+        { "spline", 100000 },
+        { "scatter", 10000 },
+        { "area", 100000 },
+        { "bar", 1000 }
+    };
+    static const int counts[] = { 1000, 10000, 100000, 1000000 };
+
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+        for (size_t j = 0; j < sizeof(counts) / sizeof(counts[0]); j++) {
+            if (counts[j] > types[i].maxCount)
+                break;
+            const QByteArray name = QByteArray(types[i].type) + ' ' + QByteArray::number(counts[j]);
+            QTest::newRow(name.constData()) << QByteArray(types[i].type) << counts[j] << false;
+            QTest::newRow((name + " antialiased").constData())
+                    << QByteArray(types[i].type) << counts[j] << true;
+        }
+    }
+}
+
+void tst_Bench_Rendering::render()
+{
+    QFETCH(QByteArray, type);
+    QFETCH(int, count);
+    QFETCH(bool, antialiasing);
+
+    QGraphicsScene scene;
+    QChart *chart = new QChart();
+    chart->setAnimationOptions(QChart::NoAnimation);
+    scene.addItem(chart);
+    chart->resize(1000, 800);
+    chart->addSeries(createSeries(type, count));
+    chart->createDefaultAxes();
+    QApplication::processEvents();
+
+    QImage image(chart->size().toSize(), QImage::Format_ARGB32_Premultiplied);
+    QBENCHMARK {
+        image.fill(Qt::white);
+        QPainter painter(&image);
+        painter.setRenderHint(QPainter::Antialiasing, antialiasing);
+        scene.render(&painter, QRectF(), chart->geometry());
+    }
+}
+
+QTEST_MAIN(tst_Bench_Rendering)
+
+#include "tst_bench_rendering.moc"
@@ -0,0 +1,137 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChart>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QSplineSeries>
+#include <QtCharts/QScatterSeries>
+#include <QtCharts/QValueAxis>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QGraphicsScene>
+#include <bench_definitions.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Measures how long line, spline, and scatter items take to recalculate their geometry after
+// a domain change, such as a zoom or scroll
+class tst_Bench_XYChartItems : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void updateGeometry_data();
+    void updateGeometry();
+    void replacePoints_data();
+    void replacePoints();
+
+private:
+    QXYSeries *createSeries(const QByteArray &type);
+};
+
+QXYSeries *tst_Bench_XYChartItems::createSeries(const QByteArray &type)
+{
+    if (type == "spline")
+        return new QSplineSeries();
+    if (type == "scatter")
+        return new QScatterSeries();
+    return new QLineSeries();
+}
+
+void tst_Bench_XYChartItems::updateGeometry_data()
+{
+    QTest::addColumn<QByteArray>("type");
+    QTest::addColumn<int>("count");
+    addPointCountRows("line");
+    addPointCountRows("spline", 1000000);
+    // Every scatter point is a graphics item of its own
+    addPointCountRows("scatter", 100000);
+}
+
+void tst_Bench_XYChartItems::updateGeometry()
+{
+    QFETCH(QByteArray, type);
+    QFETCH(int, count);
+
+    QGraphicsScene scene;
+    QChart *chart = new QChart();
+    scene.addItem(chart);
+    chart->resize(1000, 800);
+
+    QXYSeries *series = createSeries(type);
+    series->replace(benchmarkPoints(count));
+    chart->addSeries(series);
+    chart->createDefaultAxes();
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(chart->axisX(series));
+    QVERIFY(axisX);
+    QApplication::processEvents();
+
+    // Alternating between two ranges makes every iteration recalculate the whole geometry
+    bool zoomed = false;
+    QBENCHMARK {
+        zoomed = !zoomed;
+        axisX->setRange(1, zoomed ? count / 2 : count);
+    }
+}
+
+void tst_Bench_XYChartItems::replacePoints_data()
+{
+    updateGeometry_data();
+}
+
+void tst_Bench_XYChartItems::replacePoints()
+{
+    QFETCH(QByteArray, type);
+    QFETCH(int, count);
+
+    QGraphicsScene scene;
+    QChart *chart = new QChart();
+    scene.addItem(chart);
+    chart->resize(1000, 800);
+
+    QXYSeries *series = createSeries(type);
+    chart->addSeries(series);
+    chart->createDefaultAxes();
+    chart->axisX(series)->setRange(1, count);
+    chart->axisY(series)->setRange(-100, 106);
+    QApplication::processEvents();
+
+    // Replacing all points is the path taken by streaming data and model mappers
+    const QVector<QPointF> points[2] = { benchmarkPoints(count), benchmarkPoints(count) };
+    int i = 0;
+    QBENCHMARK {
+        series->replace(points[i]);
+        i = 1 - i;
+    }
+    QCOMPARE(series->count(), count);
+}
+
+QTEST_MAIN(tst_Bench_XYChartItems)
+
+#include "tst_bench_xychartitems.moc"